@@ -45,6 +45,8 @@
 
 #include "simd_common.hpp"
 
+#include "sse.hpp"
+
 #ifdef __AVX__
 
 #include <immintrin.h>
@@ -57,6 +59,84 @@ class avx {};
 
 }
 
+namespace impl {
+
+/* AVX without AVX2 has no 256-bit integer shifts,
+   so these apply the 128-bit ones to each half. */
+
+#ifndef __AVX2__
+template <int Shift>
+SIMD_ALWAYS_INLINE inline __m256 slli_epi32(__m256 const& a) {
+  __m128i const lo = _mm_slli_epi32(_mm_castps_si128(_mm256_castps256_ps128(a)), Shift);
+  __m128i const hi = _mm_slli_epi32(_mm_castps_si128(_mm256_extractf128_ps(a, 1)), Shift);
+  return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_castsi128_ps(lo)), _mm_castsi128_ps(hi), 1);
+}
+
+template <int Shift>
+SIMD_ALWAYS_INLINE inline __m256 srli_epi32(__m256 const& a) {
+  __m128i const lo = _mm_srli_epi32(_mm_castps_si128(_mm256_castps256_ps128(a)), Shift);
+  __m128i const hi = _mm_srli_epi32(_mm_castps_si128(_mm256_extractf128_ps(a, 1)), Shift);
+  return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_castsi128_ps(lo)), _mm_castsi128_ps(hi), 1);
+}
+
+template <int Shift>
+SIMD_ALWAYS_INLINE inline __m256d slli_epi64(__m256d const& a) {
+  __m128i const lo = _mm_slli_epi64(_mm_castpd_si128(_mm256_castpd256_pd128(a)), Shift);
+  __m128i const hi = _mm_slli_epi64(_mm_castpd_si128(_mm256_extractf128_pd(a, 1)), Shift);
+  return _mm256_insertf128_pd(_mm256_castpd128_pd256(_mm_castsi128_pd(lo)), _mm_castsi128_pd(hi), 1);
+}
+
+template <int Shift>
+SIMD_ALWAYS_INLINE inline __m256d srli_epi64(__m256d const& a) {
+  __m128i const lo = _mm_srli_epi64(_mm_castpd_si128(_mm256_castpd256_pd128(a)), Shift);
+  __m128i const hi = _mm_srli_epi64(_mm_castpd_si128(_mm256_extractf128_pd(a, 1)), Shift);
+  return _mm256_insertf128_pd(_mm256_castpd128_pd256(_mm_castsi128_pd(lo)), _mm_castsi128_pd(hi), 1);
+}
+#else
+template <int Shift>
+SIMD_ALWAYS_INLINE inline __m256 slli_epi32(__m256 const& a) {
+  return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(a), Shift));
+}
+
+template <int Shift>
+SIMD_ALWAYS_INLINE inline __m256 srli_epi32(__m256 const& a) {
+  return _mm256_castsi256_ps(_mm256_srli_epi32(_mm256_castps_si256(a), Shift));
+}
+
+template <int Shift>
+SIMD_ALWAYS_INLINE inline __m256d slli_epi64(__m256d const& a) {
+  return _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_castpd_si256(a), Shift));
+}
+
+template <int Shift>
+SIMD_ALWAYS_INLINE inline __m256d srli_epi64(__m256d const& a) {
+  return _mm256_castsi256_pd(_mm256_srli_epi64(_mm256_castpd_si256(a), Shift));
+}
+#endif
+
+/* The integer types without AVX2 run each operation on the two
+   128-bit halves, through the sse types of the same lanes. */
+
+#ifndef __AVX2__
+template <class T, class Op>
+SIMD_ALWAYS_INLINE inline __m256i apply_halves(__m256i const& a, Op const& op) {
+  using half_type = simd<T, simd_abi::sse>;
+  __m128i const lo = op(half_type(_mm256_castsi256_si128(a))).get();
+  __m128i const hi = op(half_type(_mm256_extractf128_si256(a, 1))).get();
+  return _mm256_insertf128_si256(_mm256_castsi128_si256(lo), hi, 1);
+}
+
+template <class T, class Op>
+SIMD_ALWAYS_INLINE inline __m256i apply_halves(__m256i const& a, __m256i const& b, Op const& op) {
+  using half_type = simd<T, simd_abi::sse>;
+  __m128i const lo = op(half_type(_mm256_castsi256_si128(a)), half_type(_mm256_castsi256_si128(b))).get();
+  __m128i const hi = op(half_type(_mm256_extractf128_si256(a, 1)), half_type(_mm256_extractf128_si256(b, 1))).get();
+  return _mm256_insertf128_si256(_mm256_castsi128_si256(lo), hi, 1);
+}
+#endif
+
+}
+
 template <>
 class simd_mask<float, simd_abi::avx> {
   __m256 m_value;
@@ -92,6 +172,18 @@ SIMD_ALWAYS_INLINE inline bool any_of(simd_mask<float, simd_abi::avx> const& a)
   return !_mm256_testc_ps(simd_mask<float, simd_abi::avx>(false).get(), a.get());
 }
 
+SIMD_ALWAYS_INLINE inline std::uint64_t to_bitmask(simd_mask<float, simd_abi::avx> const& a) {
+  return std::uint64_t(_mm256_movemask_ps(a.get()));
+}
+
+#ifdef __AVX2__
+SIMD_ALWAYS_INLINE inline simd_mask<float, simd_abi::avx> from_bitmask(std::uint64_t bits, simd_mask<float, simd_abi::avx> const*) {
+  __m256i const lane_bits = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+  __m256i const set = _mm256_and_si256(_mm256_set1_epi32(int(bits)), lane_bits);
+  return simd_mask<float, simd_abi::avx>(_mm256_castsi256_ps(_mm256_cmpeq_epi32(set, lane_bits)));
+}
+#endif
+
 template <>
 class simd<float, simd_abi::avx> {
   __m256 m_value;
@@ -112,21 +204,27 @@ class simd<float, simd_abi::avx> {
   {}
   SIMD_ALWAYS_INLINE inline
   simd(storage_type const& value) {
-    copy_from(value.data(), element_aligned_tag());
+    copy_from(value.data(), vector_aligned_tag());
   }
   SIMD_ALWAYS_INLINE inline
   simd& operator=(storage_type const& value) {
-    copy_from(value.data(), element_aligned_tag());
+    copy_from(value.data(), vector_aligned_tag());
     return *this;
   }
   template <class Flags>
-  SIMD_ALWAYS_INLINE inline simd(float const* ptr, Flags /*flags*/)
-    :m_value(_mm256_loadu_ps(ptr))
+  SIMD_ALWAYS_INLINE inline simd(float const* ptr, Flags flags) {
+    copy_from(ptr, flags);
+  }
+#ifdef __AVX2__
+  SIMD_ALWAYS_INLINE inline simd(float const* ptr, int stride)
+    :m_value(_mm256_i32gather_ps(ptr, _mm256_mullo_epi32(_mm256_set1_epi32(stride), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)), 4))
   {}
+#else
   SIMD_ALWAYS_INLINE inline simd(float const* ptr, int stride)
     :simd(ptr[0],        ptr[stride],   ptr[2*stride], ptr[3*stride],
           ptr[4*stride], ptr[5*stride], ptr[6*stride], ptr[7*stride])
   {}
+#endif
   SIMD_ALWAYS_INLINE inline constexpr simd(__m256 const& value_in)
     :m_value(value_in)
   {}
@@ -151,6 +249,31 @@ class simd<float, simd_abi::avx> {
   SIMD_ALWAYS_INLINE inline void copy_to(float* ptr, element_aligned_tag) const {
     _mm256_storeu_ps(ptr, m_value);
   }
+  SIMD_ALWAYS_INLINE inline void copy_from(float const* ptr, vector_aligned_tag) {
+    m_value = _mm256_load_ps(ptr);
+  }
+  SIMD_ALWAYS_INLINE inline void copy_to(float* ptr, vector_aligned_tag) const {
+    _mm256_store_ps(ptr, m_value);
+  }
+  SIMD_ALWAYS_INLINE inline void copy_to(float* ptr, nontemporal_tag) const {
+    _mm256_stream_ps(ptr, m_value);
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline void copy_from(float const* ptr, mask_type const& mask, Flags /*flags*/) {
+    m_value = _mm256_blendv_ps(m_value, _mm256_maskload_ps(ptr, _mm256_castps_si256(mask.get())), mask.get());
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline void copy_to(float* ptr, mask_type const& mask, Flags /*flags*/) const {
+    _mm256_maskstore_ps(ptr, _mm256_castps_si256(mask.get()), m_value);
+  }
+  template <std::size_t N>
+  SIMD_ALWAYS_INLINE inline void copy_from(float const* ptr, overaligned_tag<N>) {
+    copy_from(ptr, impl::overaligned_as<N, alignof(simd)>());
+  }
+  template <std::size_t N>
+  SIMD_ALWAYS_INLINE inline void copy_to(float* ptr, overaligned_tag<N>) const {
+    copy_to(ptr, impl::overaligned_as<N, alignof(simd)>());
+  }
   SIMD_ALWAYS_INLINE inline constexpr __m256 get() const { return m_value; }
   SIMD_ALWAYS_INLINE inline simd_mask<float, simd_abi::avx> operator<(simd const& other) const {
     return simd_mask<float, simd_abi::avx>(_mm256_cmp_ps(m_value, other.m_value, _CMP_LT_OS));
@@ -158,6 +281,18 @@ class simd<float, simd_abi::avx> {
   SIMD_ALWAYS_INLINE inline simd_mask<float, simd_abi::avx> operator==(simd const& other) const {
     return simd_mask<float, simd_abi::avx>(_mm256_cmp_ps(m_value, other.m_value, _CMP_EQ_OS));
   }
+  SIMD_ALWAYS_INLINE inline simd_mask<float, simd_abi::avx> operator>(simd const& other) const {
+    return simd_mask<float, simd_abi::avx>(_mm256_cmp_ps(m_value, other.m_value, _CMP_GT_OQ));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<float, simd_abi::avx> operator<=(simd const& other) const {
+    return simd_mask<float, simd_abi::avx>(_mm256_cmp_ps(m_value, other.m_value, _CMP_LE_OQ));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<float, simd_abi::avx> operator>=(simd const& other) const {
+    return simd_mask<float, simd_abi::avx>(_mm256_cmp_ps(m_value, other.m_value, _CMP_GE_OQ));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<float, simd_abi::avx> operator!=(simd const& other) const {
+    return simd_mask<float, simd_abi::avx>(_mm256_cmp_ps(m_value, other.m_value, _CMP_NEQ_UQ));
+  }
 };
 
 SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx> multiplysign(simd<float, simd_abi::avx> const& a, simd<float, simd_abi::avx> const& b) {
@@ -179,6 +314,17 @@ SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx> sqrt(simd<float, simd_abi::
   return simd<float, simd_abi::avx>(_mm256_sqrt_ps(a.get()));
 }
 
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx> rcp_estimate(simd<float, simd_abi::avx> const& a) {
+  return simd<float, simd_abi::avx>(_mm256_rcp_ps(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx> rsqrt_estimate(simd<float, simd_abi::avx> const& a) {
+  return simd<float, simd_abi::avx>(_mm256_rsqrt_ps(a.get()));
+}
+
+// rcpps and rsqrtps have a relative error of at most 1.5 * 2^-12
+SIMD_ALWAYS_INLINE inline constexpr int reciprocal_estimate_bits(simd<float, simd_abi::avx> const*) { return 11; }
+
 #ifdef __INTEL_COMPILER
 SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx> cbrt(simd<float, simd_abi::avx> const& a) {
   return simd<float, simd_abi::avx>(_mm256_cbrt_ps(a.get()));
@@ -200,6 +346,13 @@ SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx> fma(
     simd<float, simd_abi::avx> const& c) {
   return simd<float, simd_abi::avx>(_mm256_fmadd_ps(a.get(), b.get(), c.get()));
 }
+#else
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx> fma(
+    simd<float, simd_abi::avx> const& a,
+    simd<float, simd_abi::avx> const& b,
+    simd<float, simd_abi::avx> const& c) {
+  return simd<float, simd_abi::avx>(_mm256_add_ps(_mm256_mul_ps(a.get(), b.get()), c.get()));
+}
 #endif
 
 SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx> max(
@@ -217,6 +370,43 @@ SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx> choose(
   return simd<float, simd_abi::avx>(_mm256_blendv_ps(c.get(), b.get(), a.get()));
 }
 
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx> roundeven(simd<float, simd_abi::avx> const& a) {
+  return simd<float, simd_abi::avx>(_mm256_round_ps(a.get(), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx> floor(simd<float, simd_abi::avx> const& a) {
+  return simd<float, simd_abi::avx>(_mm256_round_ps(a.get(), _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx> ceil(simd<float, simd_abi::avx> const& a) {
+  return simd<float, simd_abi::avx>(_mm256_round_ps(a.get(), _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx> trunc(simd<float, simd_abi::avx> const& a) {
+  return simd<float, simd_abi::avx>(_mm256_round_ps(a.get(), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx> nearbyint(simd<float, simd_abi::avx> const& a) {
+  return simd<float, simd_abi::avx>(_mm256_round_ps(a.get(), _MM_FROUND_CUR_DIRECTION | _MM_FROUND_NO_EXC));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx> pow2i(simd<float, simd_abi::avx> const& n) {
+  // the low bits of 2^23 + 127 + n hold the biased exponent of 2^n
+  __m256 const biased = _mm256_add_ps(n.get(), _mm256_set1_ps(8388735.f));
+  return simd<float, simd_abi::avx>(impl::slli_epi32<23>(biased));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx> getexp(simd<float, simd_abi::avx> const& a) {
+  __m256 const biased = impl::srli_epi32<24>(impl::slli_epi32<1>(a.get()));
+  __m256 const two23 = _mm256_set1_ps(8388608.f);
+  return simd<float, simd_abi::avx>(_mm256_sub_ps(_mm256_or_ps(biased, two23), _mm256_set1_ps(8388735.f)));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx> getmant(simd<float, simd_abi::avx> const& a) {
+  __m256 const mantissa_mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x007FFFFF));
+  return simd<float, simd_abi::avx>(_mm256_or_ps(_mm256_and_ps(mantissa_mask, a.get()), _mm256_set1_ps(1.f)));
+}
+
 template <>
 class simd_mask<double, simd_abi::avx> {
   __m256d m_value;
@@ -254,6 +444,18 @@ SIMD_ALWAYS_INLINE inline bool any_of(simd_mask<double, simd_abi::avx> const& a)
       simd_mask<double, simd_abi::avx>(false).get(), a.get());
 }
 
+SIMD_ALWAYS_INLINE inline std::uint64_t to_bitmask(simd_mask<double, simd_abi::avx> const& a) {
+  return std::uint64_t(_mm256_movemask_pd(a.get()));
+}
+
+#ifdef __AVX2__
+SIMD_ALWAYS_INLINE inline simd_mask<double, simd_abi::avx> from_bitmask(std::uint64_t bits, simd_mask<double, simd_abi::avx> const*) {
+  __m256i const lane_bits = _mm256_setr_epi64x(1, 2, 4, 8);
+  __m256i const set = _mm256_and_si256(_mm256_set1_epi64x(std::int64_t(bits)), lane_bits);
+  return simd_mask<double, simd_abi::avx>(_mm256_castsi256_pd(_mm256_cmpeq_epi64(set, lane_bits)));
+}
+#endif
+
 template <>
 class simd<double, simd_abi::avx> {
   __m256d m_value;
@@ -277,7 +479,7 @@ class simd<double, simd_abi::avx> {
   {}
   SIMD_ALWAYS_INLINE inline
   simd(storage_type const& value) {
-    copy_from(value.data(), element_aligned_tag());
+    copy_from(value.data(), vector_aligned_tag());
   }
 #ifdef STK_VOLATILE_SIMD
   SIMD_ALWAYS_INLINE inline
@@ -287,16 +489,22 @@ class simd<double, simd_abi::avx> {
 #endif
   SIMD_ALWAYS_INLINE inline
   simd& operator=(storage_type const& value) {
-    copy_from(value.data(), element_aligned_tag());
+    copy_from(value.data(), vector_aligned_tag());
     return *this;
   }
   template <class Flags>
-  SIMD_ALWAYS_INLINE inline simd(double const* ptr, Flags flags)
-    :m_value(_mm256_loadu_pd(ptr))
+  SIMD_ALWAYS_INLINE inline simd(double const* ptr, Flags flags) {
+    copy_from(ptr, flags);
+  }
+#ifdef __AVX2__
+  SIMD_ALWAYS_INLINE inline simd(double const* ptr, int stride)
+    :m_value(_mm256_i32gather_pd(ptr, _mm_mullo_epi32(_mm_set1_epi32(stride), _mm_setr_epi32(0, 1, 2, 3)), 8))
   {}
+#else
   SIMD_ALWAYS_INLINE inline simd(double const* ptr, int stride)
     :simd(ptr[0], ptr[stride], ptr[2*stride], ptr[3*stride])
   {}
+#endif
   SIMD_ALWAYS_INLINE inline constexpr simd(__m256d const& value_in)
     :m_value(value_in)
   {}
@@ -326,6 +534,31 @@ class simd<double, simd_abi::avx> {
   SIMD_ALWAYS_INLINE inline void copy_to(double* ptr, element_aligned_tag) const {
     _mm256_storeu_pd(ptr, m_value);
   }
+  SIMD_ALWAYS_INLINE inline void copy_from(double const* ptr, vector_aligned_tag) {
+    m_value = _mm256_load_pd(ptr);
+  }
+  SIMD_ALWAYS_INLINE inline void copy_to(double* ptr, vector_aligned_tag) const {
+    _mm256_store_pd(ptr, m_value);
+  }
+  SIMD_ALWAYS_INLINE inline void copy_to(double* ptr, nontemporal_tag) const {
+    _mm256_stream_pd(ptr, m_value);
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline void copy_from(double const* ptr, mask_type const& mask, Flags /*flags*/) {
+    m_value = _mm256_blendv_pd(m_value, _mm256_maskload_pd(ptr, _mm256_castpd_si256(mask.get())), mask.get());
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline void copy_to(double* ptr, mask_type const& mask, Flags /*flags*/) const {
+    _mm256_maskstore_pd(ptr, _mm256_castpd_si256(mask.get()), m_value);
+  }
+  template <std::size_t N>
+  SIMD_ALWAYS_INLINE inline void copy_from(double const* ptr, overaligned_tag<N>) {
+    copy_from(ptr, impl::overaligned_as<N, alignof(simd)>());
+  }
+  template <std::size_t N>
+  SIMD_ALWAYS_INLINE inline void copy_to(double* ptr, overaligned_tag<N>) const {
+    copy_to(ptr, impl::overaligned_as<N, alignof(simd)>());
+  }
   SIMD_ALWAYS_INLINE inline constexpr __m256d get() const { return m_value; }
   SIMD_ALWAYS_INLINE inline simd_mask<double, simd_abi::avx> operator<(simd const& other) const {
     return simd_mask<double, simd_abi::avx>(_mm256_cmp_pd(m_value, other.m_value, _CMP_LT_OS));
@@ -333,6 +566,18 @@ class simd<double, simd_abi::avx> {
   SIMD_ALWAYS_INLINE inline simd_mask<double, simd_abi::avx> operator==(simd const& other) const {
     return simd_mask<double, simd_abi::avx>(_mm256_cmp_pd(m_value, other.m_value, _CMP_EQ_OS));
   }
+  SIMD_ALWAYS_INLINE inline simd_mask<double, simd_abi::avx> operator>(simd const& other) const {
+    return simd_mask<double, simd_abi::avx>(_mm256_cmp_pd(m_value, other.m_value, _CMP_GT_OQ));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<double, simd_abi::avx> operator<=(simd const& other) const {
+    return simd_mask<double, simd_abi::avx>(_mm256_cmp_pd(m_value, other.m_value, _CMP_LE_OQ));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<double, simd_abi::avx> operator>=(simd const& other) const {
+    return simd_mask<double, simd_abi::avx>(_mm256_cmp_pd(m_value, other.m_value, _CMP_GE_OQ));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<double, simd_abi::avx> operator!=(simd const& other) const {
+    return simd_mask<double, simd_abi::avx>(_mm256_cmp_pd(m_value, other.m_value, _CMP_NEQ_UQ));
+  }
 };
 
 SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx> multiplysign(simd<double, simd_abi::avx> const& a, simd<double, simd_abi::avx> const& b) {
@@ -375,6 +620,13 @@ SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx> fma(
     simd<double, simd_abi::avx> const& c) {
   return simd<double, simd_abi::avx>(_mm256_fmadd_pd(a.get(), b.get(), c.get()));
 }
+#else
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx> fma(
+    simd<double, simd_abi::avx> const& a,
+    simd<double, simd_abi::avx> const& b,
+    simd<double, simd_abi::avx> const& c) {
+  return simd<double, simd_abi::avx>(_mm256_add_pd(_mm256_mul_pd(a.get(), b.get()), c.get()));
+}
 #endif
 
 SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx> max(
@@ -392,6 +644,945 @@ SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx> choose(
   return simd<double, simd_abi::avx>(_mm256_blendv_pd(c.get(), b.get(), a.get()));
 }
 
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx> roundeven(simd<double, simd_abi::avx> const& a) {
+  return simd<double, simd_abi::avx>(_mm256_round_pd(a.get(), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx> floor(simd<double, simd_abi::avx> const& a) {
+  return simd<double, simd_abi::avx>(_mm256_round_pd(a.get(), _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx> ceil(simd<double, simd_abi::avx> const& a) {
+  return simd<double, simd_abi::avx>(_mm256_round_pd(a.get(), _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx> trunc(simd<double, simd_abi::avx> const& a) {
+  return simd<double, simd_abi::avx>(_mm256_round_pd(a.get(), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx> nearbyint(simd<double, simd_abi::avx> const& a) {
+  return simd<double, simd_abi::avx>(_mm256_round_pd(a.get(), _MM_FROUND_CUR_DIRECTION | _MM_FROUND_NO_EXC));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx> pow2i(simd<double, simd_abi::avx> const& n) {
+  // the low bits of 2^52 + 1023 + n hold the biased exponent of 2^n
+  __m256d const biased = _mm256_add_pd(n.get(), _mm256_set1_pd(4503599627371519.));
+  return simd<double, simd_abi::avx>(impl::slli_epi64<52>(biased));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx> getexp(simd<double, simd_abi::avx> const& a) {
+  __m256d const biased = impl::srli_epi64<53>(impl::slli_epi64<1>(a.get()));
+  __m256d const two52 = _mm256_set1_pd(4503599627370496.);
+  return simd<double, simd_abi::avx>(_mm256_sub_pd(_mm256_or_pd(biased, two52), _mm256_set1_pd(4503599627371519.)));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx> getmant(simd<double, simd_abi::avx> const& a) {
+  __m256d const mantissa_mask = _mm256_castsi256_pd(_mm256_set1_epi64x(0x000FFFFFFFFFFFFF));
+  return simd<double, simd_abi::avx>(_mm256_or_pd(_mm256_and_pd(mantissa_mask, a.get()), _mm256_set1_pd(1.)));
+}
+
+
+template <>
+class simd_mask<std::int32_t, simd_abi::avx> {
+  __m256i m_value;
+ public:
+  using value_type = bool;
+  using simd_type = simd<std::int32_t, simd_abi::avx>;
+  using abi_type = simd_abi::avx;
+  SIMD_ALWAYS_INLINE inline simd_mask() = default;
+  SIMD_ALWAYS_INLINE inline simd_mask(bool value)
+    :m_value(_mm256_set1_epi32(-int(value)))
+  {}
+  SIMD_ALWAYS_INLINE inline static constexpr int size() { return 8; }
+  SIMD_ALWAYS_INLINE inline constexpr simd_mask(__m256i const& value_in)
+    :m_value(value_in)
+  {}
+  SIMD_ALWAYS_INLINE inline constexpr __m256i get() const { return m_value; }
+  SIMD_ALWAYS_INLINE inline simd_mask operator||(simd_mask const& other) const {
+    return simd_mask(_mm256_castps_si256(_mm256_or_ps(_mm256_castsi256_ps(m_value), _mm256_castsi256_ps(other.m_value))));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask operator&&(simd_mask const& other) const {
+    return simd_mask(_mm256_castps_si256(_mm256_and_ps(_mm256_castsi256_ps(m_value), _mm256_castsi256_ps(other.m_value))));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask operator!() const {
+    return simd_mask(_mm256_castps_si256(_mm256_andnot_ps(_mm256_castsi256_ps(m_value), _mm256_castsi256_ps(simd_mask(true).get()))));
+  }
+};
+
+SIMD_ALWAYS_INLINE inline bool all_of(simd_mask<std::int32_t, simd_abi::avx> const& a) {
+  return _mm256_testc_ps(_mm256_castsi256_ps(a.get()),
+      _mm256_castsi256_ps(simd_mask<std::int32_t, simd_abi::avx>(true).get()));
+}
+
+SIMD_ALWAYS_INLINE inline bool any_of(simd_mask<std::int32_t, simd_abi::avx> const& a) {
+  return !_mm256_testc_ps(
+      _mm256_castsi256_ps(simd_mask<std::int32_t, simd_abi::avx>(false).get()), _mm256_castsi256_ps(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline std::uint64_t to_bitmask(simd_mask<std::int32_t, simd_abi::avx> const& a) {
+  return std::uint64_t(_mm256_movemask_ps(_mm256_castsi256_ps(a.get())));
+}
+
+#ifdef __AVX2__
+SIMD_ALWAYS_INLINE inline simd_mask<std::int32_t, simd_abi::avx> from_bitmask(std::uint64_t bits, simd_mask<std::int32_t, simd_abi::avx> const*) {
+  __m256i const lane_bits = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+  __m256i const set = _mm256_and_si256(_mm256_set1_epi32(int(bits)), lane_bits);
+  return simd_mask<std::int32_t, simd_abi::avx>(_mm256_cmpeq_epi32(set, lane_bits));
+}
+#endif
+
+template <>
+class simd<std::int32_t, simd_abi::avx> {
+  __m256i m_value;
+ public:
+  using value_type = std::int32_t;
+  using abi_type = simd_abi::avx;
+  using mask_type = simd_mask<std::int32_t, abi_type>;
+  using storage_type = simd_storage<std::int32_t, abi_type>;
+  SIMD_ALWAYS_INLINE inline simd() = default;
+  SIMD_ALWAYS_INLINE inline static constexpr int size() { return 8; }
+  SIMD_ALWAYS_INLINE inline simd(std::int32_t value)
+    :m_value(_mm256_set1_epi32(value))
+  {}
+  SIMD_ALWAYS_INLINE inline simd(
+      std::int32_t a, std::int32_t b, std::int32_t c, std::int32_t d,
+      std::int32_t e, std::int32_t f, std::int32_t g, std::int32_t h)
+    :m_value(_mm256_setr_epi32(a, b, c, d, e, f, g, h))
+  {}
+  SIMD_ALWAYS_INLINE inline
+  simd(storage_type const& value) {
+    copy_from(value.data(), vector_aligned_tag());
+  }
+  SIMD_ALWAYS_INLINE inline
+  simd& operator=(storage_type const& value) {
+    copy_from(value.data(), vector_aligned_tag());
+    return *this;
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline simd(std::int32_t const* ptr, Flags flags) {
+    copy_from(ptr, flags);
+  }
+#ifdef __AVX2__
+  SIMD_ALWAYS_INLINE inline simd(std::int32_t const* ptr, int stride)
+    :m_value(_mm256_i32gather_epi32(ptr, _mm256_mullo_epi32(_mm256_set1_epi32(stride), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)), 4))
+  {}
+#else
+  SIMD_ALWAYS_INLINE inline simd(std::int32_t const* ptr, int stride)
+    :simd(ptr[0], ptr[stride], ptr[2*stride], ptr[3*stride],
+          ptr[4*stride], ptr[5*stride], ptr[6*stride], ptr[7*stride])
+  {}
+#endif
+  SIMD_ALWAYS_INLINE inline constexpr simd(__m256i const& value_in)
+    :m_value(value_in)
+  {}
+  SIMD_ALWAYS_INLINE inline simd operator*(simd const& other) const {
+#ifdef __AVX2__
+    return simd(_mm256_mullo_epi32(m_value, other.m_value));
+#else
+    return simd(impl::apply_halves<std::int32_t>(m_value, other.m_value, [](auto const& a, auto const& b) { return a * b; }));
+#endif
+  }
+  SIMD_ALWAYS_INLINE inline simd operator/(simd const& other) const {
+    std::int32_t a[8], b[8];
+    copy_to(a, element_aligned_tag());
+    other.copy_to(b, element_aligned_tag());
+    for (int i = 0; i < 8; ++i) a[i] /= b[i];
+    return simd(a, element_aligned_tag());
+  }
+  SIMD_ALWAYS_INLINE inline simd operator+(simd const& other) const {
+#ifdef __AVX2__
+    return simd(_mm256_add_epi32(m_value, other.m_value));
+#else
+    return simd(impl::apply_halves<std::int32_t>(m_value, other.m_value, [](auto const& a, auto const& b) { return a + b; }));
+#endif
+  }
+  SIMD_ALWAYS_INLINE inline simd operator-(simd const& other) const {
+#ifdef __AVX2__
+    return simd(_mm256_sub_epi32(m_value, other.m_value));
+#else
+    return simd(impl::apply_halves<std::int32_t>(m_value, other.m_value, [](auto const& a, auto const& b) { return a - b; }));
+#endif
+  }
+  SIMD_ALWAYS_INLINE inline simd operator-() const {
+    return simd(_mm256_setzero_si256()) - *this;
+  }
+  SIMD_ALWAYS_INLINE inline simd operator&(simd const& other) const {
+    return simd(_mm256_castps_si256(_mm256_and_ps(_mm256_castsi256_ps(m_value), _mm256_castsi256_ps(other.m_value))));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator|(simd const& other) const {
+    return simd(_mm256_castps_si256(_mm256_or_ps(_mm256_castsi256_ps(m_value), _mm256_castsi256_ps(other.m_value))));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator^(simd const& other) const {
+    return simd(_mm256_castps_si256(_mm256_xor_ps(_mm256_castsi256_ps(m_value), _mm256_castsi256_ps(other.m_value))));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator~() const {
+    return *this ^ simd(-1);
+  }
+  SIMD_ALWAYS_INLINE inline simd operator<<(int shift) const {
+#ifdef __AVX2__
+    return simd(_mm256_sll_epi32(m_value, _mm_cvtsi32_si128(shift)));
+#else
+    return simd(impl::apply_halves<std::int32_t>(m_value, [=](auto const& a) { return a << shift; }));
+#endif
+  }
+  SIMD_ALWAYS_INLINE inline simd operator>>(int shift) const {
+#ifdef __AVX2__
+    return simd(_mm256_sra_epi32(m_value, _mm_cvtsi32_si128(shift)));
+#else
+    return simd(impl::apply_halves<std::int32_t>(m_value, [=](auto const& a) { return a >> shift; }));
+#endif
+  }
+  SIMD_ALWAYS_INLINE inline void copy_from(std::int32_t const* ptr, element_aligned_tag) {
+    m_value = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(ptr));
+  }
+  SIMD_ALWAYS_INLINE inline void copy_to(std::int32_t* ptr, element_aligned_tag) const {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), m_value);
+  }
+  SIMD_ALWAYS_INLINE inline void copy_from(std::int32_t const* ptr, vector_aligned_tag) {
+    m_value = _mm256_load_si256(reinterpret_cast<__m256i const*>(ptr));
+  }
+  SIMD_ALWAYS_INLINE inline void copy_to(std::int32_t* ptr, vector_aligned_tag) const {
+    _mm256_store_si256(reinterpret_cast<__m256i*>(ptr), m_value);
+  }
+  SIMD_ALWAYS_INLINE inline void copy_to(std::int32_t* ptr, nontemporal_tag) const {
+    _mm256_stream_si256(reinterpret_cast<__m256i*>(ptr), m_value);
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline void copy_from(std::int32_t const* ptr, mask_type const& mask, Flags /*flags*/) {
+    __m256 const loaded = _mm256_maskload_ps(reinterpret_cast<float const*>(ptr), mask.get());
+    m_value = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(m_value), loaded, _mm256_castsi256_ps(mask.get())));
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline void copy_to(std::int32_t* ptr, mask_type const& mask, Flags /*flags*/) const {
+    _mm256_maskstore_ps(reinterpret_cast<float*>(ptr), mask.get(), _mm256_castsi256_ps(m_value));
+  }
+  template <std::size_t N>
+  SIMD_ALWAYS_INLINE inline void copy_from(std::int32_t const* ptr, overaligned_tag<N>) {
+    copy_from(ptr, impl::overaligned_as<N, alignof(simd)>());
+  }
+  template <std::size_t N>
+  SIMD_ALWAYS_INLINE inline void copy_to(std::int32_t* ptr, overaligned_tag<N>) const {
+    copy_to(ptr, impl::overaligned_as<N, alignof(simd)>());
+  }
+  SIMD_ALWAYS_INLINE inline constexpr __m256i get() const { return m_value; }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int32_t, simd_abi::avx> operator<(simd const& other) const {
+#ifdef __AVX2__
+    return simd_mask<std::int32_t, simd_abi::avx>(_mm256_cmpgt_epi32(other.m_value, m_value));
+#else
+    return simd_mask<std::int32_t, simd_abi::avx>(
+        impl::apply_halves<std::int32_t>(m_value, other.m_value, [](auto const& a, auto const& b) { return a < b; }));
+#endif
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int32_t, simd_abi::avx> operator==(simd const& other) const {
+#ifdef __AVX2__
+    return simd_mask<std::int32_t, simd_abi::avx>(_mm256_cmpeq_epi32(m_value, other.m_value));
+#else
+    return simd_mask<std::int32_t, simd_abi::avx>(
+        impl::apply_halves<std::int32_t>(m_value, other.m_value, [](auto const& a, auto const& b) { return a == b; }));
+#endif
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int32_t, simd_abi::avx> operator>(simd const& other) const {
+    return other < *this;
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int32_t, simd_abi::avx> operator<=(simd const& other) const {
+    return !(other < *this);
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int32_t, simd_abi::avx> operator>=(simd const& other) const {
+    return !(*this < other);
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int32_t, simd_abi::avx> operator!=(simd const& other) const {
+    return !(*this == other);
+  }
+};
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx> choose(
+    simd_mask<std::int32_t, simd_abi::avx> const& a, simd<std::int32_t, simd_abi::avx> const& b, simd<std::int32_t, simd_abi::avx> const& c) {
+  return simd<std::int32_t, simd_abi::avx>(_mm256_castps_si256(
+        _mm256_blendv_ps(_mm256_castsi256_ps(c.get()), _mm256_castsi256_ps(b.get()), _mm256_castsi256_ps(a.get()))));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx> abs(simd<std::int32_t, simd_abi::avx> const& a) {
+#ifdef __AVX2__
+  return simd<std::int32_t, simd_abi::avx>(_mm256_abs_epi32(a.get()));
+#else
+  return simd<std::int32_t, simd_abi::avx>(impl::apply_halves<std::int32_t>(a.get(), [](auto const& x) { return abs(x); }));
+#endif
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx> max(
+    simd<std::int32_t, simd_abi::avx> const& a, simd<std::int32_t, simd_abi::avx> const& b) {
+#ifdef __AVX2__
+  return simd<std::int32_t, simd_abi::avx>(_mm256_max_epi32(a.get(), b.get()));
+#else
+  return choose(b < a, a, b);
+#endif
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx> min(
+    simd<std::int32_t, simd_abi::avx> const& a, simd<std::int32_t, simd_abi::avx> const& b) {
+#ifdef __AVX2__
+  return simd<std::int32_t, simd_abi::avx>(_mm256_min_epi32(a.get(), b.get()));
+#else
+  return choose(a < b, a, b);
+#endif
+}
+
+template <>
+class simd_mask<std::int64_t, simd_abi::avx> {
+  __m256i m_value;
+ public:
+  using value_type = bool;
+  using simd_type = simd<std::int64_t, simd_abi::avx>;
+  using abi_type = simd_abi::avx;
+  SIMD_ALWAYS_INLINE inline simd_mask() = default;
+  SIMD_ALWAYS_INLINE inline simd_mask(bool value)
+    :m_value(_mm256_set1_epi64x(-std::int64_t(value)))
+  {}
+  SIMD_ALWAYS_INLINE inline static constexpr int size() { return 4; }
+  SIMD_ALWAYS_INLINE inline constexpr simd_mask(__m256i const& value_in)
+    :m_value(value_in)
+  {}
+  SIMD_ALWAYS_INLINE inline constexpr __m256i get() const { return m_value; }
+  SIMD_ALWAYS_INLINE inline simd_mask operator||(simd_mask const& other) const {
+    return simd_mask(_mm256_castpd_si256(_mm256_or_pd(_mm256_castsi256_pd(m_value), _mm256_castsi256_pd(other.m_value))));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask operator&&(simd_mask const& other) const {
+    return simd_mask(_mm256_castpd_si256(_mm256_and_pd(_mm256_castsi256_pd(m_value), _mm256_castsi256_pd(other.m_value))));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask operator!() const {
+    return simd_mask(_mm256_castpd_si256(_mm256_andnot_pd(_mm256_castsi256_pd(m_value), _mm256_castsi256_pd(simd_mask(true).get()))));
+  }
+};
+
+SIMD_ALWAYS_INLINE inline bool all_of(simd_mask<std::int64_t, simd_abi::avx> const& a) {
+  return _mm256_testc_pd(_mm256_castsi256_pd(a.get()),
+      _mm256_castsi256_pd(simd_mask<std::int64_t, simd_abi::avx>(true).get()));
+}
+
+SIMD_ALWAYS_INLINE inline bool any_of(simd_mask<std::int64_t, simd_abi::avx> const& a) {
+  return !_mm256_testc_pd(
+      _mm256_castsi256_pd(simd_mask<std::int64_t, simd_abi::avx>(false).get()), _mm256_castsi256_pd(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline std::uint64_t to_bitmask(simd_mask<std::int64_t, simd_abi::avx> const& a) {
+  return std::uint64_t(_mm256_movemask_pd(_mm256_castsi256_pd(a.get())));
+}
+
+#ifdef __AVX2__
+SIMD_ALWAYS_INLINE inline simd_mask<std::int64_t, simd_abi::avx> from_bitmask(std::uint64_t bits, simd_mask<std::int64_t, simd_abi::avx> const*) {
+  __m256i const lane_bits = _mm256_setr_epi64x(1, 2, 4, 8);
+  __m256i const set = _mm256_and_si256(_mm256_set1_epi64x(std::int64_t(bits)), lane_bits);
+  return simd_mask<std::int64_t, simd_abi::avx>(_mm256_cmpeq_epi64(set, lane_bits));
+}
+#endif
+
+template <>
+class simd<std::int64_t, simd_abi::avx> {
+  __m256i m_value;
+ public:
+  using value_type = std::int64_t;
+  using abi_type = simd_abi::avx;
+  using mask_type = simd_mask<std::int64_t, abi_type>;
+  using storage_type = simd_storage<std::int64_t, abi_type>;
+  SIMD_ALWAYS_INLINE inline simd() = default;
+  SIMD_ALWAYS_INLINE inline static constexpr int size() { return 4; }
+  SIMD_ALWAYS_INLINE inline simd(std::int64_t value)
+    :m_value(_mm256_set1_epi64x(value))
+  {}
+  SIMD_ALWAYS_INLINE inline simd(
+      std::int64_t a, std::int64_t b, std::int64_t c, std::int64_t d)
+    :m_value(_mm256_setr_epi64x(a, b, c, d))
+  {}
+  SIMD_ALWAYS_INLINE inline
+  simd(storage_type const& value) {
+    copy_from(value.data(), vector_aligned_tag());
+  }
+  SIMD_ALWAYS_INLINE inline
+  simd& operator=(storage_type const& value) {
+    copy_from(value.data(), vector_aligned_tag());
+    return *this;
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline simd(std::int64_t const* ptr, Flags flags) {
+    copy_from(ptr, flags);
+  }
+#ifdef __AVX2__
+  SIMD_ALWAYS_INLINE inline simd(std::int64_t const* ptr, int stride)
+    :m_value(_mm256_i32gather_epi64(reinterpret_cast<long long const*>(ptr), _mm_mullo_epi32(_mm_set1_epi32(stride), _mm_setr_epi32(0, 1, 2, 3)), 8))
+  {}
+#else
+  SIMD_ALWAYS_INLINE inline simd(std::int64_t const* ptr, int stride)
+    :simd(ptr[0], ptr[stride], ptr[2*stride], ptr[3*stride])
+  {}
+#endif
+  SIMD_ALWAYS_INLINE inline constexpr simd(__m256i const& value_in)
+    :m_value(value_in)
+  {}
+  SIMD_ALWAYS_INLINE inline simd operator*(simd const& other) const {
+#if defined(__AVX512DQ__) && defined(__AVX512VL__)
+    return simd(_mm256_mullo_epi64(m_value, other.m_value));
+#elif defined(__AVX2__)
+    // lo*lo + ((hi*lo + lo*hi) << 32), the hi*hi term falls off the top
+    __m256i const cross = _mm256_add_epi64(
+        _mm256_mul_epu32(_mm256_srli_epi64(m_value, 32), other.m_value),
+        _mm256_mul_epu32(m_value, _mm256_srli_epi64(other.m_value, 32)));
+    return simd(_mm256_add_epi64(_mm256_mul_epu32(m_value, other.m_value), _mm256_slli_epi64(cross, 32)));
+#else
+    return simd(impl::apply_halves<std::int64_t>(m_value, other.m_value, [](auto const& a, auto const& b) { return a * b; }));
+#endif
+  }
+  SIMD_ALWAYS_INLINE inline simd operator/(simd const& other) const {
+    std::int64_t a[4], b[4];
+    copy_to(a, element_aligned_tag());
+    other.copy_to(b, element_aligned_tag());
+    for (int i = 0; i < 4; ++i) a[i] /= b[i];
+    return simd(a, element_aligned_tag());
+  }
+  SIMD_ALWAYS_INLINE inline simd operator+(simd const& other) const {
+#ifdef __AVX2__
+    return simd(_mm256_add_epi64(m_value, other.m_value));
+#else
+    return simd(impl::apply_halves<std::int64_t>(m_value, other.m_value, [](auto const& a, auto const& b) { return a + b; }));
+#endif
+  }
+  SIMD_ALWAYS_INLINE inline simd operator-(simd const& other) const {
+#ifdef __AVX2__
+    return simd(_mm256_sub_epi64(m_value, other.m_value));
+#else
+    return simd(impl::apply_halves<std::int64_t>(m_value, other.m_value, [](auto const& a, auto const& b) { return a - b; }));
+#endif
+  }
+  SIMD_ALWAYS_INLINE inline simd operator-() const {
+    return simd(_mm256_setzero_si256()) - *this;
+  }
+  SIMD_ALWAYS_INLINE inline simd operator&(simd const& other) const {
+    return simd(_mm256_castpd_si256(_mm256_and_pd(_mm256_castsi256_pd(m_value), _mm256_castsi256_pd(other.m_value))));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator|(simd const& other) const {
+    return simd(_mm256_castpd_si256(_mm256_or_pd(_mm256_castsi256_pd(m_value), _mm256_castsi256_pd(other.m_value))));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator^(simd const& other) const {
+    return simd(_mm256_castpd_si256(_mm256_xor_pd(_mm256_castsi256_pd(m_value), _mm256_castsi256_pd(other.m_value))));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator~() const {
+    return *this ^ simd(std::int64_t(-1));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator<<(int shift) const {
+#ifdef __AVX2__
+    return simd(_mm256_sll_epi64(m_value, _mm_cvtsi32_si128(shift)));
+#else
+    return simd(impl::apply_halves<std::int64_t>(m_value, [=](auto const& a) { return a << shift; }));
+#endif
+  }
+  SIMD_ALWAYS_INLINE inline simd operator>>(int shift) const {
+#ifdef __AVX512VL__
+    return simd(_mm256_sra_epi64(m_value, _mm_cvtsi32_si128(shift)));
+#elif defined(__AVX2__)
+    // shift in copies of the sign from the left; a shift by 64 gives zero
+    __m256i const sign = _mm256_cmpgt_epi64(_mm256_setzero_si256(), m_value);
+    return simd(_mm256_or_si256(
+          _mm256_srl_epi64(m_value, _mm_cvtsi32_si128(shift)),
+          _mm256_sll_epi64(sign, _mm_cvtsi32_si128(64 - shift))));
+#else
+    return simd(impl::apply_halves<std::int64_t>(m_value, [=](auto const& a) { return a >> shift; }));
+#endif
+  }
+  SIMD_ALWAYS_INLINE inline void copy_from(std::int64_t const* ptr, element_aligned_tag) {
+    m_value = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(ptr));
+  }
+  SIMD_ALWAYS_INLINE inline void copy_to(std::int64_t* ptr, element_aligned_tag) const {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), m_value);
+  }
+  SIMD_ALWAYS_INLINE inline void copy_from(std::int64_t const* ptr, vector_aligned_tag) {
+    m_value = _mm256_load_si256(reinterpret_cast<__m256i const*>(ptr));
+  }
+  SIMD_ALWAYS_INLINE inline void copy_to(std::int64_t* ptr, vector_aligned_tag) const {
+    _mm256_store_si256(reinterpret_cast<__m256i*>(ptr), m_value);
+  }
+  SIMD_ALWAYS_INLINE inline void copy_to(std::int64_t* ptr, nontemporal_tag) const {
+    _mm256_stream_si256(reinterpret_cast<__m256i*>(ptr), m_value);
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline void copy_from(std::int64_t const* ptr, mask_type const& mask, Flags /*flags*/) {
+    __m256d const loaded = _mm256_maskload_pd(reinterpret_cast<double const*>(ptr), mask.get());
+    m_value = _mm256_castpd_si256(_mm256_blendv_pd(_mm256_castsi256_pd(m_value), loaded, _mm256_castsi256_pd(mask.get())));
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline void copy_to(std::int64_t* ptr, mask_type const& mask, Flags /*flags*/) const {
+    _mm256_maskstore_pd(reinterpret_cast<double*>(ptr), mask.get(), _mm256_castsi256_pd(m_value));
+  }
+  template <std::size_t N>
+  SIMD_ALWAYS_INLINE inline void copy_from(std::int64_t const* ptr, overaligned_tag<N>) {
+    copy_from(ptr, impl::overaligned_as<N, alignof(simd)>());
+  }
+  template <std::size_t N>
+  SIMD_ALWAYS_INLINE inline void copy_to(std::int64_t* ptr, overaligned_tag<N>) const {
+    copy_to(ptr, impl::overaligned_as<N, alignof(simd)>());
+  }
+  SIMD_ALWAYS_INLINE inline constexpr __m256i get() const { return m_value; }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int64_t, simd_abi::avx> operator<(simd const& other) const {
+#ifdef __AVX2__
+    return simd_mask<std::int64_t, simd_abi::avx>(_mm256_cmpgt_epi64(other.m_value, m_value));
+#else
+    return simd_mask<std::int64_t, simd_abi::avx>(
+        impl::apply_halves<std::int64_t>(m_value, other.m_value, [](auto const& a, auto const& b) { return a < b; }));
+#endif
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int64_t, simd_abi::avx> operator==(simd const& other) const {
+#ifdef __AVX2__
+    return simd_mask<std::int64_t, simd_abi::avx>(_mm256_cmpeq_epi64(m_value, other.m_value));
+#else
+    return simd_mask<std::int64_t, simd_abi::avx>(
+        impl::apply_halves<std::int64_t>(m_value, other.m_value, [](auto const& a, auto const& b) { return a == b; }));
+#endif
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int64_t, simd_abi::avx> operator>(simd const& other) const {
+    return other < *this;
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int64_t, simd_abi::avx> operator<=(simd const& other) const {
+    return !(other < *this);
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int64_t, simd_abi::avx> operator>=(simd const& other) const {
+    return !(*this < other);
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int64_t, simd_abi::avx> operator!=(simd const& other) const {
+    return !(*this == other);
+  }
+};
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::avx> choose(
+    simd_mask<std::int64_t, simd_abi::avx> const& a, simd<std::int64_t, simd_abi::avx> const& b, simd<std::int64_t, simd_abi::avx> const& c) {
+  return simd<std::int64_t, simd_abi::avx>(_mm256_castpd_si256(
+        _mm256_blendv_pd(_mm256_castsi256_pd(c.get()), _mm256_castsi256_pd(b.get()), _mm256_castsi256_pd(a.get()))));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::avx> abs(simd<std::int64_t, simd_abi::avx> const& a) {
+#ifdef __AVX512VL__
+  return simd<std::int64_t, simd_abi::avx>(_mm256_abs_epi64(a.get()));
+#elif defined(__AVX2__)
+  __m256i const sign = _mm256_cmpgt_epi64(_mm256_setzero_si256(), a.get());
+  return simd<std::int64_t, simd_abi::avx>(_mm256_sub_epi64(_mm256_xor_si256(a.get(), sign), sign));
+#else
+  return simd<std::int64_t, simd_abi::avx>(impl::apply_halves<std::int64_t>(a.get(), [](auto const& x) { return abs(x); }));
+#endif
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::avx> max(
+    simd<std::int64_t, simd_abi::avx> const& a, simd<std::int64_t, simd_abi::avx> const& b) {
+#ifdef __AVX512VL__
+  return simd<std::int64_t, simd_abi::avx>(_mm256_max_epi64(a.get(), b.get()));
+#else
+  return choose(b < a, a, b);
+#endif
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::avx> min(
+    simd<std::int64_t, simd_abi::avx> const& a, simd<std::int64_t, simd_abi::avx> const& b) {
+#ifdef __AVX512VL__
+  return simd<std::int64_t, simd_abi::avx>(_mm256_min_epi64(a.get(), b.get()));
+#else
+  return choose(a < b, a, b);
+#endif
+}
+
+
+/* AVX2 gathers with one index per lane: int32_t indices for float and
+   int32_t, int64_t indices for double and int64_t.  There are no
+   scatters before AVX-512.
+ */
+
+#ifdef __AVX2__
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx> gather(float const* ptr, simd<std::int32_t, simd_abi::avx> const& idx) {
+  return simd<float, simd_abi::avx>(_mm256_i32gather_ps(ptr, idx.get(), 4));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx> gather(
+    float const* ptr, simd<std::int32_t, simd_abi::avx> const& idx, simd_mask<float, simd_abi::avx> const& mask, simd<float, simd_abi::avx> const& other) {
+  return simd<float, simd_abi::avx>(_mm256_mask_i32gather_ps(other.get(), ptr, idx.get(), mask.get(), 4));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx> gather(double const* ptr, simd<std::int64_t, simd_abi::avx> const& idx) {
+  return simd<double, simd_abi::avx>(_mm256_i64gather_pd(ptr, idx.get(), 8));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx> gather(
+    double const* ptr, simd<std::int64_t, simd_abi::avx> const& idx, simd_mask<double, simd_abi::avx> const& mask, simd<double, simd_abi::avx> const& other) {
+  return simd<double, simd_abi::avx>(_mm256_mask_i64gather_pd(other.get(), ptr, idx.get(), mask.get(), 8));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx> gather(std::int32_t const* ptr, simd<std::int32_t, simd_abi::avx> const& idx) {
+  return simd<std::int32_t, simd_abi::avx>(_mm256_i32gather_epi32(ptr, idx.get(), 4));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx> gather(
+    std::int32_t const* ptr, simd<std::int32_t, simd_abi::avx> const& idx, simd_mask<std::int32_t, simd_abi::avx> const& mask, simd<std::int32_t, simd_abi::avx> const& other) {
+  return simd<std::int32_t, simd_abi::avx>(_mm256_mask_i32gather_epi32(other.get(), ptr, idx.get(), mask.get(), 4));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::avx> gather(std::int64_t const* ptr, simd<std::int64_t, simd_abi::avx> const& idx) {
+  return simd<std::int64_t, simd_abi::avx>(_mm256_i64gather_epi64(reinterpret_cast<long long const*>(ptr), idx.get(), 8));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::avx> gather(
+    std::int64_t const* ptr, simd<std::int64_t, simd_abi::avx> const& idx, simd_mask<std::int64_t, simd_abi::avx> const& mask, simd<std::int64_t, simd_abi::avx> const& other) {
+  return simd<std::int64_t, simd_abi::avx>(_mm256_mask_i64gather_epi64(other.get(), reinterpret_cast<long long const*>(ptr), idx.get(), mask.get(), 8));
+}
+#endif
+
+/* Horizontal sums, minima and maxima: the two halves are combined and
+   reduced as SSE registers.
+ */
+
+SIMD_ALWAYS_INLINE inline float reduce(simd<float, simd_abi::avx> const& a, std::plus<>) {
+  simd<float, simd_abi::sse> const h(_mm_add_ps(_mm256_castps256_ps128(a.get()), _mm256_extractf128_ps(a.get(), 1)));
+  return reduce(h, std::plus<>());
+}
+
+SIMD_ALWAYS_INLINE inline float hmin(simd<float, simd_abi::avx> const& a) {
+  simd<float, simd_abi::sse> const h(_mm_min_ps(_mm256_castps256_ps128(a.get()), _mm256_extractf128_ps(a.get(), 1)));
+  return hmin(h);
+}
+
+SIMD_ALWAYS_INLINE inline float hmax(simd<float, simd_abi::avx> const& a) {
+  simd<float, simd_abi::sse> const h(_mm_max_ps(_mm256_castps256_ps128(a.get()), _mm256_extractf128_ps(a.get(), 1)));
+  return hmax(h);
+}
+
+SIMD_ALWAYS_INLINE inline double reduce(simd<double, simd_abi::avx> const& a, std::plus<>) {
+  simd<double, simd_abi::sse> const h(_mm_add_pd(_mm256_castpd256_pd128(a.get()), _mm256_extractf128_pd(a.get(), 1)));
+  return reduce(h, std::plus<>());
+}
+
+SIMD_ALWAYS_INLINE inline double hmin(simd<double, simd_abi::avx> const& a) {
+  simd<double, simd_abi::sse> const h(_mm_min_pd(_mm256_castpd256_pd128(a.get()), _mm256_extractf128_pd(a.get(), 1)));
+  return hmin(h);
+}
+
+SIMD_ALWAYS_INLINE inline double hmax(simd<double, simd_abi::avx> const& a) {
+  simd<double, simd_abi::sse> const h(_mm_max_pd(_mm256_castpd256_pd128(a.get()), _mm256_extractf128_pd(a.get(), 1)));
+  return hmax(h);
+}
+
+/* Conversions, the building blocks of static_simd_cast and friends.
+   cvtt* truncate and cvt* round in the current rounding mode; both give
+   0x80000000 for lanes that do not fit in an int32_t.
+ */
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx> convert(
+    simd<std::int32_t, simd_abi::avx> const& a, simd<float, simd_abi::avx> const*, impl::truncating_tag) {
+  return simd<float, simd_abi::avx>(_mm256_cvtepi32_ps(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx> convert(
+    simd<float, simd_abi::avx> const& a, simd<std::int32_t, simd_abi::avx> const*, impl::truncating_tag) {
+  return simd<std::int32_t, simd_abi::avx>(_mm256_cvttps_epi32(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx> convert(
+    simd<float, simd_abi::avx> const& a, simd<std::int32_t, simd_abi::avx> const*, impl::rounding_tag) {
+  return simd<std::int32_t, simd_abi::avx>(_mm256_cvtps_epi32(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx> convert(
+    simd<float, simd_abi::avx> const& a, simd<std::int32_t, simd_abi::avx> const*, impl::saturating_tag) {
+  // flip 0x80000000 to 0x7FFFFFFF where a is too large, and clear NaN lanes
+  __m256 const too_large = _mm256_cmp_ps(a.get(), _mm256_set1_ps(2147483648.0f), _CMP_GE_OQ);
+  __m256 const r = _mm256_xor_ps(_mm256_castsi256_ps(_mm256_cvttps_epi32(a.get())), too_large);
+  return simd<std::int32_t, simd_abi::avx>(
+      _mm256_castps_si256(_mm256_and_ps(r, _mm256_cmp_ps(a.get(), a.get(), _CMP_ORD_Q))));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx> convert(
+    simd<double, simd_abi::avx> const& lo, simd<double, simd_abi::avx> const& hi,
+    simd<float, simd_abi::avx> const*, impl::truncating_tag) {
+  return simd<float, simd_abi::avx>(
+      _mm256_insertf128_ps(_mm256_castps128_ps256(_mm256_cvtpd_ps(lo.get())), _mm256_cvtpd_ps(hi.get()), 1));
+}
+
+SIMD_ALWAYS_INLINE inline void convert(
+    simd<float, simd_abi::avx> const& a, simd<double, simd_abi::avx>* lo, simd<double, simd_abi::avx>* hi,
+    impl::truncating_tag) {
+  *lo = simd<double, simd_abi::avx>(_mm256_cvtps_pd(_mm256_castps256_ps128(a.get())));
+  *hi = simd<double, simd_abi::avx>(_mm256_cvtps_pd(_mm256_extractf128_ps(a.get(), 1)));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx> convert(
+    simd<double, simd_abi::avx> const& lo, simd<double, simd_abi::avx> const& hi,
+    simd<std::int32_t, simd_abi::avx> const*, impl::truncating_tag) {
+  return simd<std::int32_t, simd_abi::avx>(
+      _mm256_insertf128_si256(_mm256_castsi128_si256(_mm256_cvttpd_epi32(lo.get())), _mm256_cvttpd_epi32(hi.get()), 1));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx> convert(
+    simd<double, simd_abi::avx> const& lo, simd<double, simd_abi::avx> const& hi,
+    simd<std::int32_t, simd_abi::avx> const*, impl::rounding_tag) {
+  return simd<std::int32_t, simd_abi::avx>(
+      _mm256_insertf128_si256(_mm256_castsi128_si256(_mm256_cvtpd_epi32(lo.get())), _mm256_cvtpd_epi32(hi.get()), 1));
+}
+
+SIMD_ALWAYS_INLINE inline void convert(
+    simd<std::int32_t, simd_abi::avx> const& a, simd<double, simd_abi::avx>* lo, simd<double, simd_abi::avx>* hi,
+    impl::truncating_tag) {
+  *lo = simd<double, simd_abi::avx>(_mm256_cvtepi32_pd(_mm256_castsi256_si128(a.get())));
+  *hi = simd<double, simd_abi::avx>(_mm256_cvtepi32_pd(_mm256_extractf128_si256(a.get(), 1)));
+}
+
+// the low halves of the int64_t lanes, gathered one 128-bit half at a time
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx> convert(
+    simd<std::int64_t, simd_abi::avx> const& lo, simd<std::int64_t, simd_abi::avx> const& hi,
+    simd<std::int32_t, simd_abi::avx> const*, impl::truncating_tag tag) {
+  using half_type = simd<std::int64_t, simd_abi::sse>;
+  simd<std::int32_t, simd_abi::sse> const* const to = nullptr;
+  __m128i const r_lo =
+      convert(half_type(_mm256_castsi256_si128(lo.get())), half_type(_mm256_extractf128_si256(lo.get(), 1)), to, tag).get();
+  __m128i const r_hi =
+      convert(half_type(_mm256_castsi256_si128(hi.get())), half_type(_mm256_extractf128_si256(hi.get(), 1)), to, tag).get();
+  return simd<std::int32_t, simd_abi::avx>(_mm256_insertf128_si256(_mm256_castsi128_si256(r_lo), r_hi, 1));
+}
+
+SIMD_ALWAYS_INLINE inline void convert(
+    simd<std::int32_t, simd_abi::avx> const& a, simd<std::int64_t, simd_abi::avx>* lo, simd<std::int64_t, simd_abi::avx>* hi,
+    impl::truncating_tag) {
+  __m128i const a_lo = _mm256_castsi256_si128(a.get());
+  __m128i const a_hi = _mm256_extractf128_si256(a.get(), 1);
+#ifdef __AVX2__
+  *lo = simd<std::int64_t, simd_abi::avx>(_mm256_cvtepi32_epi64(a_lo));
+  *hi = simd<std::int64_t, simd_abi::avx>(_mm256_cvtepi32_epi64(a_hi));
+#else
+  __m128i const lo_lo = _mm_cvtepi32_epi64(a_lo);
+  __m128i const lo_hi = _mm_cvtepi32_epi64(_mm_unpackhi_epi64(a_lo, a_lo));
+  __m128i const hi_lo = _mm_cvtepi32_epi64(a_hi);
+  __m128i const hi_hi = _mm_cvtepi32_epi64(_mm_unpackhi_epi64(a_hi, a_hi));
+  *lo = simd<std::int64_t, simd_abi::avx>(_mm256_insertf128_si256(_mm256_castsi128_si256(lo_lo), lo_hi, 1));
+  *hi = simd<std::int64_t, simd_abi::avx>(_mm256_insertf128_si256(_mm256_castsi128_si256(hi_lo), hi_hi, 1));
+#endif
+}
+
+
+/* Interleaving unpacks within each 128-bit half and then puts the
+   halves in order.  Permutations and shift_in across the halves need
+   the AVX2 cross-lane permutes and fall back to memory without them.
+ */
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx> interleave_lo(
+    simd<float, simd_abi::avx> const& a, simd<float, simd_abi::avx> const& b) {
+  return simd<float, simd_abi::avx>(_mm256_permute2f128_ps(
+      _mm256_unpacklo_ps(a.get(), b.get()), _mm256_unpackhi_ps(a.get(), b.get()), 0x20));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx> interleave_hi(
+    simd<float, simd_abi::avx> const& a, simd<float, simd_abi::avx> const& b) {
+  return simd<float, simd_abi::avx>(_mm256_permute2f128_ps(
+      _mm256_unpacklo_ps(a.get(), b.get()), _mm256_unpackhi_ps(a.get(), b.get()), 0x31));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx> interleave_lo(
+    simd<double, simd_abi::avx> const& a, simd<double, simd_abi::avx> const& b) {
+  return simd<double, simd_abi::avx>(_mm256_permute2f128_pd(
+      _mm256_unpacklo_pd(a.get(), b.get()), _mm256_unpackhi_pd(a.get(), b.get()), 0x20));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx> interleave_hi(
+    simd<double, simd_abi::avx> const& a, simd<double, simd_abi::avx> const& b) {
+  return simd<double, simd_abi::avx>(_mm256_permute2f128_pd(
+      _mm256_unpacklo_pd(a.get(), b.get()), _mm256_unpackhi_pd(a.get(), b.get()), 0x31));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx> interleave_lo(
+    simd<std::int32_t, simd_abi::avx> const& a, simd<std::int32_t, simd_abi::avx> const& b) {
+  return simd<std::int32_t, simd_abi::avx>(_mm256_castps_si256(interleave_lo(
+      simd<float, simd_abi::avx>(_mm256_castsi256_ps(a.get())), simd<float, simd_abi::avx>(_mm256_castsi256_ps(b.get()))).get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx> interleave_hi(
+    simd<std::int32_t, simd_abi::avx> const& a, simd<std::int32_t, simd_abi::avx> const& b) {
+  return simd<std::int32_t, simd_abi::avx>(_mm256_castps_si256(interleave_hi(
+      simd<float, simd_abi::avx>(_mm256_castsi256_ps(a.get())), simd<float, simd_abi::avx>(_mm256_castsi256_ps(b.get()))).get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::avx> interleave_lo(
+    simd<std::int64_t, simd_abi::avx> const& a, simd<std::int64_t, simd_abi::avx> const& b) {
+  return simd<std::int64_t, simd_abi::avx>(_mm256_castpd_si256(interleave_lo(
+      simd<double, simd_abi::avx>(_mm256_castsi256_pd(a.get())), simd<double, simd_abi::avx>(_mm256_castsi256_pd(b.get()))).get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::avx> interleave_hi(
+    simd<std::int64_t, simd_abi::avx> const& a, simd<std::int64_t, simd_abi::avx> const& b) {
+  return simd<std::int64_t, simd_abi::avx>(_mm256_castpd_si256(interleave_hi(
+      simd<double, simd_abi::avx>(_mm256_castsi256_pd(a.get())), simd<double, simd_abi::avx>(_mm256_castsi256_pd(b.get()))).get()));
+}
+
+#ifdef __AVX2__
+
+template <int... Idx>
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx> permute(
+    simd<float, simd_abi::avx> const& a, std::integer_sequence<int, Idx...>) {
+  return simd<float, simd_abi::avx>(_mm256_permutevar8x32_ps(a.get(), _mm256_setr_epi32(Idx...)));
+}
+
+template <int I0, int I1, int I2, int I3>
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx> permute(
+    simd<double, simd_abi::avx> const& a, std::integer_sequence<int, I0, I1, I2, I3>) {
+  return simd<double, simd_abi::avx>(_mm256_permute4x64_pd(a.get(), _MM_SHUFFLE(I3, I2, I1, I0)));
+}
+
+template <int... Idx>
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx> permute(
+    simd<std::int32_t, simd_abi::avx> const& a, std::integer_sequence<int, Idx...>) {
+  return simd<std::int32_t, simd_abi::avx>(_mm256_permutevar8x32_epi32(a.get(), _mm256_setr_epi32(Idx...)));
+}
+
+template <int I0, int I1, int I2, int I3>
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::avx> permute(
+    simd<std::int64_t, simd_abi::avx> const& a, std::integer_sequence<int, I0, I1, I2, I3>) {
+  return simd<std::int64_t, simd_abi::avx>(_mm256_permute4x64_epi64(a.get(), _MM_SHUFFLE(I3, I2, I1, I0)));
+}
+
+namespace impl {
+
+// the 32-bit lanes k32 through k32 + 7 of a followed by b, permuting both and blending
+SIMD_ALWAYS_INLINE inline __m256 shift_in_ps(__m256 const& a, __m256 const& b, int k32) {
+  __m256i const idx = _mm256_add_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(k32));
+  __m256 const from_b = _mm256_castsi256_ps(_mm256_cmpgt_epi32(idx, _mm256_set1_epi32(7)));
+  return _mm256_blendv_ps(_mm256_permutevar8x32_ps(a, idx), _mm256_permutevar8x32_ps(b, idx), from_b);
+}
+
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx> shift_in(
+    simd<float, simd_abi::avx> const& a, simd<float, simd_abi::avx> const& b, int k) {
+  return simd<float, simd_abi::avx>(impl::shift_in_ps(a.get(), b.get(), k));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx> shift_in(
+    simd<double, simd_abi::avx> const& a, simd<double, simd_abi::avx> const& b, int k) {
+  return simd<double, simd_abi::avx>(_mm256_castps_pd(
+      impl::shift_in_ps(_mm256_castpd_ps(a.get()), _mm256_castpd_ps(b.get()), 2 * k)));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx> shift_in(
+    simd<std::int32_t, simd_abi::avx> const& a, simd<std::int32_t, simd_abi::avx> const& b, int k) {
+  return simd<std::int32_t, simd_abi::avx>(_mm256_castps_si256(
+      impl::shift_in_ps(_mm256_castsi256_ps(a.get()), _mm256_castsi256_ps(b.get()), k)));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::avx> shift_in(
+    simd<std::int64_t, simd_abi::avx> const& a, simd<std::int64_t, simd_abi::avx> const& b, int k) {
+  return simd<std::int64_t, simd_abi::avx>(_mm256_castps_si256(
+      impl::shift_in_ps(_mm256_castsi256_ps(a.get()), _mm256_castsi256_ps(b.get()), 2 * k)));
+}
+
+
+/* Without compress and expand instructions, compress_store permutes the
+   lanes of the mask to the front with vpermps and stores the first
+   count of them, and expand_load loads count values and permutes them
+   out to the lanes of the mask.  The permutations come from tables with
+   one entry per 8-bit mask, each the 8 byte-sized lane indices.
+ */
+
+namespace impl {
+
+class compress_tables {
+ public:
+  std::uint64_t compress[256];
+  std::uint64_t expand[256];
+  constexpr compress_tables() : compress(), expand() {
+    for (int mask = 0; mask < 256; ++mask) {
+      int count = 0;
+      for (int i = 0; i < 8; ++i) {
+        if ((mask >> i) & 1) {
+          compress[mask] |= std::uint64_t(i) << (8 * count);
+          expand[mask] |= std::uint64_t(count) << (8 * i);
+          ++count;
+        }
+      }
+    }
+  }
+};
+
+SIMD_ALWAYS_INLINE inline compress_tables const& get_compress_tables() {
+  static constexpr compress_tables tables;
+  return tables;
+}
+
+// the 32-bit lane indices of a table entry for 32-bit lanes
+SIMD_ALWAYS_INLINE inline __m256i lane_indices_32(std::uint64_t entry) {
+  return _mm256_cvtepu8_epi32(_mm_cvtsi64_si128(std::int64_t(entry)));
+}
+
+// the 32-bit lane indices of a table entry for 64-bit lanes, each lane d becoming 2d and 2d + 1
+SIMD_ALWAYS_INLINE inline __m256i lane_indices_64(std::uint64_t entry) {
+  __m256i const twice = _mm256_slli_epi64(_mm256_cvtepu8_epi64(_mm_cvtsi64_si128(std::int64_t(entry))), 1);
+  return _mm256_or_si256(_mm256_or_si256(twice, _mm256_slli_epi64(twice, 32)), _mm256_set1_epi64x(std::int64_t(1) << 32));
+}
+
+// the first count 32-bit lanes of a ps mask, or the first count / 2 64-bit lanes
+SIMD_ALWAYS_INLINE inline __m256i first_lanes_32(int count) {
+  return _mm256_cmpgt_epi32(_mm256_set1_epi32(count), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+}
+
+}
+
+SIMD_ALWAYS_INLINE inline int compress_store(
+    float* ptr, simd_mask<float, simd_abi::avx> const& mask, simd<float, simd_abi::avx> const& a) {
+  int const bits = _mm256_movemask_ps(mask.get());
+  int const count = popcount(mask);
+  __m256 const packed = _mm256_permutevar8x32_ps(a.get(), impl::lane_indices_32(impl::get_compress_tables().compress[bits]));
+  _mm256_maskstore_ps(ptr, impl::first_lanes_32(count), packed);
+  return count;
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx> expand_load(
+    float const* ptr, simd_mask<float, simd_abi::avx> const& mask) {
+  int const bits = _mm256_movemask_ps(mask.get());
+  __m256 const packed = _mm256_maskload_ps(ptr, impl::first_lanes_32(popcount(mask)));
+  __m256 const spread = _mm256_permutevar8x32_ps(packed, impl::lane_indices_32(impl::get_compress_tables().expand[bits]));
+  return simd<float, simd_abi::avx>(_mm256_and_ps(spread, mask.get()));
+}
+
+SIMD_ALWAYS_INLINE inline int compress_store(
+    double* ptr, simd_mask<double, simd_abi::avx> const& mask, simd<double, simd_abi::avx> const& a) {
+  int const bits = _mm256_movemask_pd(mask.get());
+  int const count = popcount(mask);
+  __m256 const packed = _mm256_permutevar8x32_ps(_mm256_castpd_ps(a.get()), impl::lane_indices_64(impl::get_compress_tables().compress[bits]));
+  _mm256_maskstore_ps(reinterpret_cast<float*>(ptr), impl::first_lanes_32(2 * count), packed);
+  return count;
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx> expand_load(
+    double const* ptr, simd_mask<double, simd_abi::avx> const& mask) {
+  int const bits = _mm256_movemask_pd(mask.get());
+  __m256 const packed = _mm256_maskload_ps(reinterpret_cast<float const*>(ptr), impl::first_lanes_32(2 * popcount(mask)));
+  __m256 const spread = _mm256_permutevar8x32_ps(packed, impl::lane_indices_64(impl::get_compress_tables().expand[bits]));
+  return simd<double, simd_abi::avx>(_mm256_and_pd(_mm256_castps_pd(spread), mask.get()));
+}
+
+SIMD_ALWAYS_INLINE inline int compress_store(
+    std::int32_t* ptr, simd_mask<std::int32_t, simd_abi::avx> const& mask, simd<std::int32_t, simd_abi::avx> const& a) {
+  return compress_store(reinterpret_cast<float*>(ptr),
+      simd_mask<float, simd_abi::avx>(_mm256_castsi256_ps(mask.get())), simd<float, simd_abi::avx>(_mm256_castsi256_ps(a.get())));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx> expand_load(
+    std::int32_t const* ptr, simd_mask<std::int32_t, simd_abi::avx> const& mask) {
+  return simd<std::int32_t, simd_abi::avx>(_mm256_castps_si256(expand_load(reinterpret_cast<float const*>(ptr),
+      simd_mask<float, simd_abi::avx>(_mm256_castsi256_ps(mask.get()))).get()));
+}
+
+SIMD_ALWAYS_INLINE inline int compress_store(
+    std::int64_t* ptr, simd_mask<std::int64_t, simd_abi::avx> const& mask, simd<std::int64_t, simd_abi::avx> const& a) {
+  return compress_store(reinterpret_cast<double*>(ptr),
+      simd_mask<double, simd_abi::avx>(_mm256_castsi256_pd(mask.get())), simd<double, simd_abi::avx>(_mm256_castsi256_pd(a.get())));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::avx> expand_load(
+    std::int64_t const* ptr, simd_mask<std::int64_t, simd_abi::avx> const& mask) {
+  return simd<std::int64_t, simd_abi::avx>(_mm256_castpd_si256(expand_load(reinterpret_cast<double const*>(ptr),
+      simd_mask<double, simd_abi::avx>(_mm256_castsi256_pd(mask.get()))).get()));
+}
+
+#endif
+
 }
 
 #endif
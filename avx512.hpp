@@ -94,6 +94,14 @@ SIMD_ALWAYS_INLINE inline bool any_of(simd_mask<float, simd_abi::avx512> const&
   return !_kortestc_mask16_u8(~a.get(), false_value);
 }
 
+SIMD_ALWAYS_INLINE inline std::uint64_t to_bitmask(simd_mask<float, simd_abi::avx512> const& a) {
+  return std::uint64_t(a.get());
+}
+
+SIMD_ALWAYS_INLINE inline simd_mask<float, simd_abi::avx512> from_bitmask(std::uint64_t bits, simd_mask<float, simd_abi::avx512> const*) {
+  return simd_mask<float, simd_abi::avx512>(static_cast<__mmask16>(bits));
+}
+
 template <>
 class simd<float, simd_abi::avx512> {
   __m512 m_value;
@@ -118,22 +126,19 @@ class simd<float, simd_abi::avx512> {
   {}
   SIMD_ALWAYS_INLINE inline
   simd(storage_type const& value) {
-    copy_from(value.data(), element_aligned_tag());
+    copy_from(value.data(), vector_aligned_tag());
   }
   SIMD_ALWAYS_INLINE inline
   simd& operator=(storage_type const& value) {
-    copy_from(value.data(), element_aligned_tag());
+    copy_from(value.data(), vector_aligned_tag());
     return *this;
   }
   template <class Flags>
-  SIMD_ALWAYS_INLINE inline simd(float const* ptr, Flags /*flags*/)
-    :m_value(_mm512_loadu_ps(ptr))
-  {}
+  SIMD_ALWAYS_INLINE inline simd(float const* ptr, Flags flags) {
+    copy_from(ptr, flags);
+  }
   SIMD_ALWAYS_INLINE inline simd(float const* ptr, int stride)
-    :simd(ptr[0],        ptr[stride],   ptr[2*stride], ptr[3*stride],
-          ptr[4*stride], ptr[5*stride], ptr[6*stride], ptr[7*stride],
-          ptr[8*stride], ptr[9*stride], ptr[10*stride], ptr[11*stride],
-          ptr[12*stride], ptr[13*stride], ptr[14*stride], ptr[15*stride])
+    :m_value(_mm512_i32gather_ps(_mm512_mullo_epi32(_mm512_set1_epi32(stride), _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15)), ptr, 4))
   {}
   SIMD_ALWAYS_INLINE inline constexpr simd(__m512 const& value_in)
     :m_value(value_in)
@@ -159,6 +164,31 @@ class simd<float, simd_abi::avx512> {
   SIMD_ALWAYS_INLINE inline void copy_to(float* ptr, element_aligned_tag) const {
     _mm512_storeu_ps(ptr, m_value);
   }
+  SIMD_ALWAYS_INLINE inline void copy_from(float const* ptr, vector_aligned_tag) {
+    m_value = _mm512_load_ps(ptr);
+  }
+  SIMD_ALWAYS_INLINE inline void copy_to(float* ptr, vector_aligned_tag) const {
+    _mm512_store_ps(ptr, m_value);
+  }
+  SIMD_ALWAYS_INLINE inline void copy_to(float* ptr, nontemporal_tag) const {
+    _mm512_stream_ps(ptr, m_value);
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline void copy_from(float const* ptr, mask_type const& mask, Flags /*flags*/) {
+    m_value = _mm512_mask_loadu_ps(m_value, mask.get(), ptr);
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline void copy_to(float* ptr, mask_type const& mask, Flags /*flags*/) const {
+    _mm512_mask_storeu_ps(ptr, mask.get(), m_value);
+  }
+  template <std::size_t N>
+  SIMD_ALWAYS_INLINE inline void copy_from(float const* ptr, overaligned_tag<N>) {
+    copy_from(ptr, impl::overaligned_as<N, alignof(simd)>());
+  }
+  template <std::size_t N>
+  SIMD_ALWAYS_INLINE inline void copy_to(float* ptr, overaligned_tag<N>) const {
+    copy_to(ptr, impl::overaligned_as<N, alignof(simd)>());
+  }
   SIMD_ALWAYS_INLINE inline constexpr __m512 get() const { return m_value; }
   SIMD_ALWAYS_INLINE inline simd_mask<float, simd_abi::avx512> operator<(simd const& other) const {
     return simd_mask<float, simd_abi::avx512>(_mm512_cmplt_ps_mask(m_value, other.m_value));
@@ -166,6 +196,18 @@ class simd<float, simd_abi::avx512> {
   SIMD_ALWAYS_INLINE inline simd_mask<float, simd_abi::avx512> operator==(simd const& other) const {
     return simd_mask<float, simd_abi::avx512>(_mm512_cmpeq_ps_mask(m_value, other.m_value));
   }
+  SIMD_ALWAYS_INLINE inline simd_mask<float, simd_abi::avx512> operator>(simd const& other) const {
+    return simd_mask<float, simd_abi::avx512>(_mm512_cmp_ps_mask(m_value, other.m_value, _CMP_GT_OQ));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<float, simd_abi::avx512> operator<=(simd const& other) const {
+    return simd_mask<float, simd_abi::avx512>(_mm512_cmp_ps_mask(m_value, other.m_value, _CMP_LE_OQ));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<float, simd_abi::avx512> operator>=(simd const& other) const {
+    return simd_mask<float, simd_abi::avx512>(_mm512_cmp_ps_mask(m_value, other.m_value, _CMP_GE_OQ));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<float, simd_abi::avx512> operator!=(simd const& other) const {
+    return simd_mask<float, simd_abi::avx512>(_mm512_cmp_ps_mask(m_value, other.m_value, _CMP_NEQ_UQ));
+  }
 };
 
 SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512> multiplysign(simd<float, simd_abi::avx512> const& a, simd<float, simd_abi::avx512> const& b) {
@@ -197,6 +239,17 @@ SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512> sqrt(simd<float, simd_ab
   return simd<float, simd_abi::avx512>(_mm512_sqrt_ps(a.get()));
 }
 
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512> rcp_estimate(simd<float, simd_abi::avx512> const& a) {
+  return simd<float, simd_abi::avx512>(_mm512_rcp14_ps(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512> rsqrt_estimate(simd<float, simd_abi::avx512> const& a) {
+  return simd<float, simd_abi::avx512>(_mm512_rsqrt14_ps(a.get()));
+}
+
+// the 14-bit estimates have a relative error below 2^-14
+SIMD_ALWAYS_INLINE inline constexpr int reciprocal_estimate_bits(simd<float, simd_abi::avx512> const*) { return 14; }
+
 #ifdef __INTEL_COMPILER
 SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512> cbrt(simd<float, simd_abi::avx512> const& a) {
   return simd<float, simd_abi::avx512>(_mm512_cbrt_ps(a.get()));
@@ -233,6 +286,54 @@ SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512> choose(
   return simd<float, simd_abi::avx512>(_mm512_mask_blend_ps(a.get(), c.get(), b.get()));
 }
 
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512> roundeven(simd<float, simd_abi::avx512> const& a) {
+  return simd<float, simd_abi::avx512>(_mm512_roundscale_ps(a.get(), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512> floor(simd<float, simd_abi::avx512> const& a) {
+  return simd<float, simd_abi::avx512>(_mm512_roundscale_ps(a.get(), _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512> ceil(simd<float, simd_abi::avx512> const& a) {
+  return simd<float, simd_abi::avx512>(_mm512_roundscale_ps(a.get(), _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512> trunc(simd<float, simd_abi::avx512> const& a) {
+  return simd<float, simd_abi::avx512>(_mm512_roundscale_ps(a.get(), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512> nearbyint(simd<float, simd_abi::avx512> const& a) {
+  return simd<float, simd_abi::avx512>(_mm512_roundscale_ps(a.get(), _MM_FROUND_CUR_DIRECTION | _MM_FROUND_NO_EXC));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512> pow2i(simd<float, simd_abi::avx512> const& n) {
+  return simd<float, simd_abi::avx512>(_mm512_scalef_ps(_mm512_set1_ps(1.f), n.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512> getexp(simd<float, simd_abi::avx512> const& a) {
+  return simd<float, simd_abi::avx512>(_mm512_getexp_ps(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512> getmant(simd<float, simd_abi::avx512> const& a) {
+  return simd<float, simd_abi::avx512>(_mm512_getmant_ps(a.get(), _MM_MANT_NORM_1_2, _MM_MANT_SIGN_zero));
+}
+
+// getexp, getmant and scalef cover subnormals themselves
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512> frexp(simd<float, simd_abi::avx512> const& a, simd<float, simd_abi::avx512>* e) {
+  __mmask16 const is_finite_nonzero = _mm512_cmp_ps_mask(_mm512_abs_ps(a.get()), _mm512_set1_ps(std::numeric_limits<float>::infinity()), _CMP_LT_OQ)
+    & _mm512_cmp_ps_mask(a.get(), _mm512_setzero_ps(), _CMP_NEQ_OQ);
+  *e = simd<float, simd_abi::avx512>(_mm512_maskz_add_ps(is_finite_nonzero, _mm512_getexp_ps(a.get()), _mm512_set1_ps(1.f)));
+  return simd<float, simd_abi::avx512>(_mm512_mask_getmant_ps(a.get(), is_finite_nonzero, a.get(), _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512> ldexp(simd<float, simd_abi::avx512> const& a, simd<float, simd_abi::avx512> const& n) {
+  return simd<float, simd_abi::avx512>(_mm512_scalef_ps(a.get(), n.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512> logb(simd<float, simd_abi::avx512> const& a) {
+  return simd<float, simd_abi::avx512>(_mm512_getexp_ps(a.get()));
+}
+
 template <>
 class simd_mask<double, simd_abi::avx512> {
   __mmask8 m_value;
@@ -271,6 +372,14 @@ SIMD_ALWAYS_INLINE inline bool any_of(simd_mask<double, simd_abi::avx512> const&
   return !_kortestc_mask16_u8(~a_value, false_value);
 }
 
+SIMD_ALWAYS_INLINE inline std::uint64_t to_bitmask(simd_mask<double, simd_abi::avx512> const& a) {
+  return std::uint64_t(a.get());
+}
+
+SIMD_ALWAYS_INLINE inline simd_mask<double, simd_abi::avx512> from_bitmask(std::uint64_t bits, simd_mask<double, simd_abi::avx512> const*) {
+  return simd_mask<double, simd_abi::avx512>(static_cast<__mmask8>(bits));
+}
+
 template <>
 class simd<double, simd_abi::avx512> {
   __m512d m_value;
@@ -295,7 +404,7 @@ class simd<double, simd_abi::avx512> {
   {}
   SIMD_ALWAYS_INLINE inline
   simd(storage_type const& value) {
-    copy_from(value.data(), element_aligned_tag());
+    copy_from(value.data(), vector_aligned_tag());
   }
 #ifdef STK_VOLATILE_SIMD
   SIMD_ALWAYS_INLINE inline
@@ -305,16 +414,15 @@ class simd<double, simd_abi::avx512> {
 #endif
   SIMD_ALWAYS_INLINE inline
   simd& operator=(storage_type const& value) {
-    copy_from(value.data(), element_aligned_tag());
+    copy_from(value.data(), vector_aligned_tag());
     return *this;
   }
   template <class Flags>
-  SIMD_ALWAYS_INLINE inline simd(double const* ptr, Flags /*flags*/)
-    :m_value(_mm512_loadu_pd(ptr))
-  {}
+  SIMD_ALWAYS_INLINE inline simd(double const* ptr, Flags flags) {
+    copy_from(ptr, flags);
+  }
   SIMD_ALWAYS_INLINE inline simd(double const* ptr, int stride)
-    :simd(ptr[0],        ptr[stride],   ptr[2*stride], ptr[3*stride],
-          ptr[4*stride], ptr[5*stride], ptr[6*stride], ptr[7*stride])
+    :m_value(_mm512_i32gather_pd(_mm256_mullo_epi32(_mm256_set1_epi32(stride), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)), ptr, 8))
   {}
   SIMD_ALWAYS_INLINE inline constexpr simd(__m512d const& value_in)
     :m_value(value_in)
@@ -345,6 +453,31 @@ class simd<double, simd_abi::avx512> {
   SIMD_ALWAYS_INLINE inline void copy_to(double* ptr, element_aligned_tag) const {
     _mm512_storeu_pd(ptr, m_value);
   }
+  SIMD_ALWAYS_INLINE inline void copy_from(double const* ptr, vector_aligned_tag) {
+    m_value = _mm512_load_pd(ptr);
+  }
+  SIMD_ALWAYS_INLINE inline void copy_to(double* ptr, vector_aligned_tag) const {
+    _mm512_store_pd(ptr, m_value);
+  }
+  SIMD_ALWAYS_INLINE inline void copy_to(double* ptr, nontemporal_tag) const {
+    _mm512_stream_pd(ptr, m_value);
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline void copy_from(double const* ptr, mask_type const& mask, Flags /*flags*/) {
+    m_value = _mm512_mask_loadu_pd(m_value, mask.get(), ptr);
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline void copy_to(double* ptr, mask_type const& mask, Flags /*flags*/) const {
+    _mm512_mask_storeu_pd(ptr, mask.get(), m_value);
+  }
+  template <std::size_t N>
+  SIMD_ALWAYS_INLINE inline void copy_from(double const* ptr, overaligned_tag<N>) {
+    copy_from(ptr, impl::overaligned_as<N, alignof(simd)>());
+  }
+  template <std::size_t N>
+  SIMD_ALWAYS_INLINE inline void copy_to(double* ptr, overaligned_tag<N>) const {
+    copy_to(ptr, impl::overaligned_as<N, alignof(simd)>());
+  }
   SIMD_ALWAYS_INLINE inline constexpr __m512d get() const { return m_value; }
   SIMD_ALWAYS_INLINE inline simd_mask<double, simd_abi::avx512> operator<(simd const& other) const {
     return simd_mask<double, simd_abi::avx512>(_mm512_cmplt_pd_mask(m_value, other.m_value));
@@ -352,6 +485,18 @@ class simd<double, simd_abi::avx512> {
   SIMD_ALWAYS_INLINE inline simd_mask<double, simd_abi::avx512> operator==(simd const& other) const {
     return simd_mask<double, simd_abi::avx512>(_mm512_cmpeq_pd_mask(m_value, other.m_value));
   }
+  SIMD_ALWAYS_INLINE inline simd_mask<double, simd_abi::avx512> operator>(simd const& other) const {
+    return simd_mask<double, simd_abi::avx512>(_mm512_cmp_pd_mask(m_value, other.m_value, _CMP_GT_OQ));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<double, simd_abi::avx512> operator<=(simd const& other) const {
+    return simd_mask<double, simd_abi::avx512>(_mm512_cmp_pd_mask(m_value, other.m_value, _CMP_LE_OQ));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<double, simd_abi::avx512> operator>=(simd const& other) const {
+    return simd_mask<double, simd_abi::avx512>(_mm512_cmp_pd_mask(m_value, other.m_value, _CMP_GE_OQ));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<double, simd_abi::avx512> operator!=(simd const& other) const {
+    return simd_mask<double, simd_abi::avx512>(_mm512_cmp_pd_mask(m_value, other.m_value, _CMP_NEQ_UQ));
+  }
 };
 
 SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512> multiplysign(simd<double, simd_abi::avx512> const& a, simd<double, simd_abi::avx512> const& b) {
@@ -384,6 +529,17 @@ SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512> sqrt(simd<double, simd_
   return simd<double, simd_abi::avx512>(_mm512_sqrt_pd(a.get()));
 }
 
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512> rcp_estimate(simd<double, simd_abi::avx512> const& a) {
+  return simd<double, simd_abi::avx512>(_mm512_rcp14_pd(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512> rsqrt_estimate(simd<double, simd_abi::avx512> const& a) {
+  return simd<double, simd_abi::avx512>(_mm512_rsqrt14_pd(a.get()));
+}
+
+// the 14-bit estimates have a relative error below 2^-14
+SIMD_ALWAYS_INLINE inline constexpr int reciprocal_estimate_bits(simd<double, simd_abi::avx512> const*) { return 14; }
+
 #ifdef __INTEL_COMPILER
 SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512> cbrt(simd<double, simd_abi::avx512> const& a) {
   return simd<double, simd_abi::avx512>(_mm512_cbrt_pd(a.get()));
@@ -420,6 +576,919 @@ SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512> choose(
   return simd<double, simd_abi::avx512>(_mm512_mask_blend_pd(a.get(), c.get(), b.get()));
 }
 
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512> roundeven(simd<double, simd_abi::avx512> const& a) {
+  return simd<double, simd_abi::avx512>(_mm512_roundscale_pd(a.get(), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512> floor(simd<double, simd_abi::avx512> const& a) {
+  return simd<double, simd_abi::avx512>(_mm512_roundscale_pd(a.get(), _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512> ceil(simd<double, simd_abi::avx512> const& a) {
+  return simd<double, simd_abi::avx512>(_mm512_roundscale_pd(a.get(), _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512> trunc(simd<double, simd_abi::avx512> const& a) {
+  return simd<double, simd_abi::avx512>(_mm512_roundscale_pd(a.get(), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512> nearbyint(simd<double, simd_abi::avx512> const& a) {
+  return simd<double, simd_abi::avx512>(_mm512_roundscale_pd(a.get(), _MM_FROUND_CUR_DIRECTION | _MM_FROUND_NO_EXC));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512> pow2i(simd<double, simd_abi::avx512> const& n) {
+  return simd<double, simd_abi::avx512>(_mm512_scalef_pd(_mm512_set1_pd(1.), n.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512> getexp(simd<double, simd_abi::avx512> const& a) {
+  return simd<double, simd_abi::avx512>(_mm512_getexp_pd(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512> getmant(simd<double, simd_abi::avx512> const& a) {
+  return simd<double, simd_abi::avx512>(_mm512_getmant_pd(a.get(), _MM_MANT_NORM_1_2, _MM_MANT_SIGN_zero));
+}
+
+// getexp, getmant and scalef cover subnormals themselves
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512> frexp(simd<double, simd_abi::avx512> const& a, simd<double, simd_abi::avx512>* e) {
+  __mmask8 const is_finite_nonzero = _mm512_cmp_pd_mask(_mm512_abs_pd(a.get()), _mm512_set1_pd(std::numeric_limits<double>::infinity()), _CMP_LT_OQ)
+    & _mm512_cmp_pd_mask(a.get(), _mm512_setzero_pd(), _CMP_NEQ_OQ);
+  *e = simd<double, simd_abi::avx512>(_mm512_maskz_add_pd(is_finite_nonzero, _mm512_getexp_pd(a.get()), _mm512_set1_pd(1.)));
+  return simd<double, simd_abi::avx512>(_mm512_mask_getmant_pd(a.get(), is_finite_nonzero, a.get(), _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512> ldexp(simd<double, simd_abi::avx512> const& a, simd<double, simd_abi::avx512> const& n) {
+  return simd<double, simd_abi::avx512>(_mm512_scalef_pd(a.get(), n.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512> logb(simd<double, simd_abi::avx512> const& a) {
+  return simd<double, simd_abi::avx512>(_mm512_getexp_pd(a.get()));
+}
+
+
+template <>
+class simd_mask<std::int32_t, simd_abi::avx512> {
+  __mmask16 m_value;
+ public:
+  using value_type = bool;
+  using simd_type = simd<std::int32_t, simd_abi::avx512>;
+  using abi_type = simd_abi::avx512;
+  SIMD_ALWAYS_INLINE inline simd_mask() = default;
+  SIMD_ALWAYS_INLINE inline simd_mask(bool value)
+    :m_value(-std::int16_t(value))
+  {}
+  SIMD_ALWAYS_INLINE inline static constexpr int size() { return 16; }
+  SIMD_ALWAYS_INLINE inline constexpr simd_mask(__mmask16 const& value_in)
+    :m_value(value_in)
+  {}
+  SIMD_ALWAYS_INLINE inline constexpr __mmask16 get() const { return m_value; }
+  SIMD_ALWAYS_INLINE inline simd_mask operator||(simd_mask const& other) const {
+    return simd_mask(_kor_mask16(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask operator&&(simd_mask const& other) const {
+    return simd_mask(_kand_mask16(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask operator!() const {
+    return simd_mask(_knot_mask16(m_value));
+  }
+};
+
+SIMD_ALWAYS_INLINE inline bool all_of(simd_mask<std::int32_t, simd_abi::avx512> const& a) {
+  static const __mmask16 false_value(-std::int16_t(false));
+  return _kortestc_mask16_u8(a.get(), false_value);
+}
+
+SIMD_ALWAYS_INLINE inline bool any_of(simd_mask<std::int32_t, simd_abi::avx512> const& a) {
+  static const __mmask16 false_value(-std::int16_t(false));
+  return !_kortestc_mask16_u8(~a.get(), false_value);
+}
+
+SIMD_ALWAYS_INLINE inline std::uint64_t to_bitmask(simd_mask<std::int32_t, simd_abi::avx512> const& a) {
+  return std::uint64_t(a.get());
+}
+
+SIMD_ALWAYS_INLINE inline simd_mask<std::int32_t, simd_abi::avx512> from_bitmask(std::uint64_t bits, simd_mask<std::int32_t, simd_abi::avx512> const*) {
+  return simd_mask<std::int32_t, simd_abi::avx512>(static_cast<__mmask16>(bits));
+}
+
+template <>
+class simd<std::int32_t, simd_abi::avx512> {
+  __m512i m_value;
+ public:
+  SIMD_ALWAYS_INLINE simd() = default;
+  using value_type = std::int32_t;
+  using abi_type = simd_abi::avx512;
+  using mask_type = simd_mask<std::int32_t, abi_type>;
+  using storage_type = simd_storage<std::int32_t, abi_type>;
+  SIMD_ALWAYS_INLINE inline static constexpr int size() { return 16; }
+  SIMD_ALWAYS_INLINE inline simd(std::int32_t value)
+    :m_value(_mm512_set1_epi32(value))
+  {}
+  SIMD_ALWAYS_INLINE inline simd(
+      std::int32_t a, std::int32_t b, std::int32_t c, std::int32_t d,
+      std::int32_t e, std::int32_t f, std::int32_t g, std::int32_t h,
+      std::int32_t i, std::int32_t j, std::int32_t k, std::int32_t l,
+      std::int32_t m, std::int32_t n, std::int32_t o, std::int32_t p)
+    :m_value(_mm512_setr_epi32(
+          a, b, c, d, e, f, g, h,
+          i, j, k, l, m, n, o, p))
+  {}
+  SIMD_ALWAYS_INLINE inline
+  simd(storage_type const& value) {
+    copy_from(value.data(), vector_aligned_tag());
+  }
+  SIMD_ALWAYS_INLINE inline
+  simd& operator=(storage_type const& value) {
+    copy_from(value.data(), vector_aligned_tag());
+    return *this;
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline simd(std::int32_t const* ptr, Flags flags) {
+    copy_from(ptr, flags);
+  }
+  SIMD_ALWAYS_INLINE inline simd(std::int32_t const* ptr, int stride)
+    :m_value(_mm512_i32gather_epi32(_mm512_mullo_epi32(_mm512_set1_epi32(stride), _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15)), ptr, 4))
+  {}
+  SIMD_ALWAYS_INLINE inline constexpr simd(__m512i const& value_in)
+    :m_value(value_in)
+  {}
+  SIMD_ALWAYS_INLINE inline simd operator*(simd const& other) const {
+    return simd(_mm512_mullo_epi32(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator/(simd const& other) const {
+    std::int32_t a[16], b[16];
+    copy_to(a, element_aligned_tag());
+    other.copy_to(b, element_aligned_tag());
+    for (int i = 0; i < 16; ++i) a[i] /= b[i];
+    return simd(a, element_aligned_tag());
+  }
+  SIMD_ALWAYS_INLINE inline simd operator+(simd const& other) const {
+    return simd(_mm512_add_epi32(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator-(simd const& other) const {
+    return simd(_mm512_sub_epi32(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator-() const {
+    return simd(_mm512_sub_epi32(_mm512_setzero_si512(), m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator&(simd const& other) const {
+    return simd(_mm512_and_epi32(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator|(simd const& other) const {
+    return simd(_mm512_or_epi32(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator^(simd const& other) const {
+    return simd(_mm512_xor_epi32(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator~() const {
+    return simd(_mm512_xor_epi32(m_value, _mm512_set1_epi32(-1)));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator<<(int shift) const {
+    return simd(_mm512_sll_epi32(m_value, _mm_cvtsi32_si128(shift)));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator>>(int shift) const {
+    return simd(_mm512_sra_epi32(m_value, _mm_cvtsi32_si128(shift)));
+  }
+  SIMD_ALWAYS_INLINE inline void copy_from(std::int32_t const* ptr, element_aligned_tag) {
+    m_value = _mm512_loadu_si512(ptr);
+  }
+  SIMD_ALWAYS_INLINE inline void copy_to(std::int32_t* ptr, element_aligned_tag) const {
+    _mm512_storeu_si512(ptr, m_value);
+  }
+  SIMD_ALWAYS_INLINE inline void copy_from(std::int32_t const* ptr, vector_aligned_tag) {
+    m_value = _mm512_load_si512(ptr);
+  }
+  SIMD_ALWAYS_INLINE inline void copy_to(std::int32_t* ptr, vector_aligned_tag) const {
+    _mm512_store_si512(ptr, m_value);
+  }
+  SIMD_ALWAYS_INLINE inline void copy_to(std::int32_t* ptr, nontemporal_tag) const {
+    _mm512_stream_si512(reinterpret_cast<__m512i*>(ptr), m_value);
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline void copy_from(std::int32_t const* ptr, mask_type const& mask, Flags /*flags*/) {
+    m_value = _mm512_mask_loadu_epi32(m_value, mask.get(), ptr);
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline void copy_to(std::int32_t* ptr, mask_type const& mask, Flags /*flags*/) const {
+    _mm512_mask_storeu_epi32(ptr, mask.get(), m_value);
+  }
+  template <std::size_t N>
+  SIMD_ALWAYS_INLINE inline void copy_from(std::int32_t const* ptr, overaligned_tag<N>) {
+    copy_from(ptr, impl::overaligned_as<N, alignof(simd)>());
+  }
+  template <std::size_t N>
+  SIMD_ALWAYS_INLINE inline void copy_to(std::int32_t* ptr, overaligned_tag<N>) const {
+    copy_to(ptr, impl::overaligned_as<N, alignof(simd)>());
+  }
+  SIMD_ALWAYS_INLINE inline constexpr __m512i get() const { return m_value; }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int32_t, simd_abi::avx512> operator<(simd const& other) const {
+    return simd_mask<std::int32_t, simd_abi::avx512>(_mm512_cmplt_epi32_mask(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int32_t, simd_abi::avx512> operator==(simd const& other) const {
+    return simd_mask<std::int32_t, simd_abi::avx512>(_mm512_cmpeq_epi32_mask(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int32_t, simd_abi::avx512> operator>(simd const& other) const {
+    return simd_mask<std::int32_t, simd_abi::avx512>(_mm512_cmpgt_epi32_mask(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int32_t, simd_abi::avx512> operator<=(simd const& other) const {
+    return simd_mask<std::int32_t, simd_abi::avx512>(_mm512_cmple_epi32_mask(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int32_t, simd_abi::avx512> operator>=(simd const& other) const {
+    return simd_mask<std::int32_t, simd_abi::avx512>(_mm512_cmpge_epi32_mask(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int32_t, simd_abi::avx512> operator!=(simd const& other) const {
+    return simd_mask<std::int32_t, simd_abi::avx512>(_mm512_cmpneq_epi32_mask(m_value, other.m_value));
+  }
+};
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx512> choose(
+    simd_mask<std::int32_t, simd_abi::avx512> const& a, simd<std::int32_t, simd_abi::avx512> const& b, simd<std::int32_t, simd_abi::avx512> const& c) {
+  return simd<std::int32_t, simd_abi::avx512>(_mm512_mask_blend_epi32(a.get(), c.get(), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx512> abs(simd<std::int32_t, simd_abi::avx512> const& a) {
+  return simd<std::int32_t, simd_abi::avx512>(_mm512_abs_epi32(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx512> max(
+    simd<std::int32_t, simd_abi::avx512> const& a, simd<std::int32_t, simd_abi::avx512> const& b) {
+  return simd<std::int32_t, simd_abi::avx512>(_mm512_max_epi32(a.get(), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx512> min(
+    simd<std::int32_t, simd_abi::avx512> const& a, simd<std::int32_t, simd_abi::avx512> const& b) {
+  return simd<std::int32_t, simd_abi::avx512>(_mm512_min_epi32(a.get(), b.get()));
+}
+
+template <>
+class simd_mask<std::int64_t, simd_abi::avx512> {
+  __mmask8 m_value;
+ public:
+  using value_type = bool;
+  using simd_type = simd<std::int64_t, simd_abi::avx512>;
+  using abi_type = simd_abi::avx512;
+  SIMD_ALWAYS_INLINE inline simd_mask() = default;
+  SIMD_ALWAYS_INLINE inline simd_mask(bool value)
+    :m_value(-std::int16_t(value))
+  {}
+  SIMD_ALWAYS_INLINE inline static constexpr int size() { return 8; }
+  SIMD_ALWAYS_INLINE inline constexpr simd_mask(__mmask8 const& value_in)
+    :m_value(value_in)
+  {}
+  SIMD_ALWAYS_INLINE inline constexpr __mmask8 get() const { return m_value; }
+  SIMD_ALWAYS_INLINE simd_mask operator||(simd_mask const& other) const {
+    return simd_mask(static_cast<__mmask8>(_mm512_kor(m_value, other.m_value)));
+  }
+  SIMD_ALWAYS_INLINE simd_mask operator&&(simd_mask const& other) const {
+    return simd_mask(static_cast<__mmask8>(_mm512_kand(m_value, other.m_value)));
+  }
+  SIMD_ALWAYS_INLINE simd_mask operator!() const {
+    static const __mmask8 true_value(simd_mask<std::int64_t, simd_abi::avx512>(true).get());
+    return simd_mask(static_cast<__mmask8>(_mm512_kxor(true_value, m_value)));
+  }
+};
+
+SIMD_ALWAYS_INLINE inline bool all_of(simd_mask<std::int64_t, simd_abi::avx512> const& a) {
+  static const __mmask16 false_value(-std::int16_t(false));
+  const __mmask16 a_value(0xFF00 | a.get());
+  return _kortestc_mask16_u8(a_value, false_value);
+}
+
+SIMD_ALWAYS_INLINE inline bool any_of(simd_mask<std::int64_t, simd_abi::avx512> const& a) {
+  static const __mmask16 false_value(-std::int16_t(false));
+  const __mmask16 a_value(0x0000 | a.get());
+  return !_kortestc_mask16_u8(~a_value, false_value);
+}
+
+SIMD_ALWAYS_INLINE inline std::uint64_t to_bitmask(simd_mask<std::int64_t, simd_abi::avx512> const& a) {
+  return std::uint64_t(a.get());
+}
+
+SIMD_ALWAYS_INLINE inline simd_mask<std::int64_t, simd_abi::avx512> from_bitmask(std::uint64_t bits, simd_mask<std::int64_t, simd_abi::avx512> const*) {
+  return simd_mask<std::int64_t, simd_abi::avx512>(static_cast<__mmask8>(bits));
+}
+
+template <>
+class simd<std::int64_t, simd_abi::avx512> {
+  __m512i m_value;
+ public:
+  SIMD_ALWAYS_INLINE simd() = default;
+  using value_type = std::int64_t;
+  using abi_type = simd_abi::avx512;
+  using mask_type = simd_mask<std::int64_t, abi_type>;
+  using storage_type = simd_storage<std::int64_t, abi_type>;
+  SIMD_ALWAYS_INLINE inline static constexpr int size() { return 8; }
+  SIMD_ALWAYS_INLINE inline simd(std::int64_t value)
+    :m_value(_mm512_set1_epi64(value))
+  {}
+  SIMD_ALWAYS_INLINE inline simd(
+      std::int64_t a, std::int64_t b, std::int64_t c, std::int64_t d,
+      std::int64_t e, std::int64_t f, std::int64_t g, std::int64_t h)
+    :m_value(_mm512_setr_epi64(a, b, c, d, e, f, g, h))
+  {}
+  SIMD_ALWAYS_INLINE inline
+  simd(storage_type const& value) {
+    copy_from(value.data(), vector_aligned_tag());
+  }
+  SIMD_ALWAYS_INLINE inline
+  simd& operator=(storage_type const& value) {
+    copy_from(value.data(), vector_aligned_tag());
+    return *this;
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline simd(std::int64_t const* ptr, Flags flags) {
+    copy_from(ptr, flags);
+  }
+  SIMD_ALWAYS_INLINE inline simd(std::int64_t const* ptr, int stride)
+    :m_value(_mm512_i32gather_epi64(_mm256_mullo_epi32(_mm256_set1_epi32(stride), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)), ptr, 8))
+  {}
+  SIMD_ALWAYS_INLINE inline constexpr simd(__m512i const& value_in)
+    :m_value(value_in)
+  {}
+  SIMD_ALWAYS_INLINE inline simd operator*(simd const& other) const {
+#ifdef __AVX512DQ__
+    return simd(_mm512_mullo_epi64(m_value, other.m_value));
+#else
+    // lo*lo + ((hi*lo + lo*hi) << 32), the hi*hi term falls off the top
+    __m512i const cross = _mm512_add_epi64(
+        _mm512_mul_epu32(_mm512_srli_epi64(m_value, 32), other.m_value),
+        _mm512_mul_epu32(m_value, _mm512_srli_epi64(other.m_value, 32)));
+    return simd(_mm512_add_epi64(_mm512_mul_epu32(m_value, other.m_value), _mm512_slli_epi64(cross, 32)));
+#endif
+  }
+  SIMD_ALWAYS_INLINE inline simd operator/(simd const& other) const {
+    std::int64_t a[8], b[8];
+    copy_to(a, element_aligned_tag());
+    other.copy_to(b, element_aligned_tag());
+    for (int i = 0; i < 8; ++i) a[i] /= b[i];
+    return simd(a, element_aligned_tag());
+  }
+  SIMD_ALWAYS_INLINE inline simd operator+(simd const& other) const {
+    return simd(_mm512_add_epi64(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator-(simd const& other) const {
+    return simd(_mm512_sub_epi64(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator-() const {
+    return simd(_mm512_sub_epi64(_mm512_setzero_si512(), m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator&(simd const& other) const {
+    return simd(_mm512_and_epi64(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator|(simd const& other) const {
+    return simd(_mm512_or_epi64(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator^(simd const& other) const {
+    return simd(_mm512_xor_epi64(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator~() const {
+    return simd(_mm512_xor_epi64(m_value, _mm512_set1_epi64(-1)));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator<<(int shift) const {
+    return simd(_mm512_sll_epi64(m_value, _mm_cvtsi32_si128(shift)));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator>>(int shift) const {
+    return simd(_mm512_sra_epi64(m_value, _mm_cvtsi32_si128(shift)));
+  }
+  SIMD_ALWAYS_INLINE inline void copy_from(std::int64_t const* ptr, element_aligned_tag) {
+    m_value = _mm512_loadu_si512(ptr);
+  }
+  SIMD_ALWAYS_INLINE inline void copy_to(std::int64_t* ptr, element_aligned_tag) const {
+    _mm512_storeu_si512(ptr, m_value);
+  }
+  SIMD_ALWAYS_INLINE inline void copy_from(std::int64_t const* ptr, vector_aligned_tag) {
+    m_value = _mm512_load_si512(ptr);
+  }
+  SIMD_ALWAYS_INLINE inline void copy_to(std::int64_t* ptr, vector_aligned_tag) const {
+    _mm512_store_si512(ptr, m_value);
+  }
+  SIMD_ALWAYS_INLINE inline void copy_to(std::int64_t* ptr, nontemporal_tag) const {
+    _mm512_stream_si512(reinterpret_cast<__m512i*>(ptr), m_value);
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline void copy_from(std::int64_t const* ptr, mask_type const& mask, Flags /*flags*/) {
+    m_value = _mm512_mask_loadu_epi64(m_value, mask.get(), ptr);
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline void copy_to(std::int64_t* ptr, mask_type const& mask, Flags /*flags*/) const {
+    _mm512_mask_storeu_epi64(ptr, mask.get(), m_value);
+  }
+  template <std::size_t N>
+  SIMD_ALWAYS_INLINE inline void copy_from(std::int64_t const* ptr, overaligned_tag<N>) {
+    copy_from(ptr, impl::overaligned_as<N, alignof(simd)>());
+  }
+  template <std::size_t N>
+  SIMD_ALWAYS_INLINE inline void copy_to(std::int64_t* ptr, overaligned_tag<N>) const {
+    copy_to(ptr, impl::overaligned_as<N, alignof(simd)>());
+  }
+  SIMD_ALWAYS_INLINE inline constexpr __m512i get() const { return m_value; }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int64_t, simd_abi::avx512> operator<(simd const& other) const {
+    return simd_mask<std::int64_t, simd_abi::avx512>(_mm512_cmplt_epi64_mask(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int64_t, simd_abi::avx512> operator==(simd const& other) const {
+    return simd_mask<std::int64_t, simd_abi::avx512>(_mm512_cmpeq_epi64_mask(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int64_t, simd_abi::avx512> operator>(simd const& other) const {
+    return simd_mask<std::int64_t, simd_abi::avx512>(_mm512_cmpgt_epi64_mask(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int64_t, simd_abi::avx512> operator<=(simd const& other) const {
+    return simd_mask<std::int64_t, simd_abi::avx512>(_mm512_cmple_epi64_mask(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int64_t, simd_abi::avx512> operator>=(simd const& other) const {
+    return simd_mask<std::int64_t, simd_abi::avx512>(_mm512_cmpge_epi64_mask(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int64_t, simd_abi::avx512> operator!=(simd const& other) const {
+    return simd_mask<std::int64_t, simd_abi::avx512>(_mm512_cmpneq_epi64_mask(m_value, other.m_value));
+  }
+};
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::avx512> choose(
+    simd_mask<std::int64_t, simd_abi::avx512> const& a, simd<std::int64_t, simd_abi::avx512> const& b, simd<std::int64_t, simd_abi::avx512> const& c) {
+  return simd<std::int64_t, simd_abi::avx512>(_mm512_mask_blend_epi64(a.get(), c.get(), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::avx512> abs(simd<std::int64_t, simd_abi::avx512> const& a) {
+  return simd<std::int64_t, simd_abi::avx512>(_mm512_abs_epi64(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::avx512> max(
+    simd<std::int64_t, simd_abi::avx512> const& a, simd<std::int64_t, simd_abi::avx512> const& b) {
+  return simd<std::int64_t, simd_abi::avx512>(_mm512_max_epi64(a.get(), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::avx512> min(
+    simd<std::int64_t, simd_abi::avx512> const& a, simd<std::int64_t, simd_abi::avx512> const& b) {
+  return simd<std::int64_t, simd_abi::avx512>(_mm512_min_epi64(a.get(), b.get()));
+}
+
+
+/* The first n lanes of a mask register are its low n bits. */
+
+SIMD_ALWAYS_INLINE inline simd_mask<float, simd_abi::avx512> first_n_mask(int n, simd<float, simd_abi::avx512> const*) {
+  return simd_mask<float, simd_abi::avx512>(static_cast<__mmask16>(n <= 0 ? 0 : n >= 16 ? 0xFFFF : (1u << n) - 1));
+}
+
+SIMD_ALWAYS_INLINE inline simd_mask<double, simd_abi::avx512> first_n_mask(int n, simd<double, simd_abi::avx512> const*) {
+  return simd_mask<double, simd_abi::avx512>(static_cast<__mmask8>(n <= 0 ? 0 : n >= 8 ? 0xFF : (1u << n) - 1));
+}
+
+SIMD_ALWAYS_INLINE inline simd_mask<std::int32_t, simd_abi::avx512> first_n_mask(int n, simd<std::int32_t, simd_abi::avx512> const*) {
+  return simd_mask<std::int32_t, simd_abi::avx512>(static_cast<__mmask16>(n <= 0 ? 0 : n >= 16 ? 0xFFFF : (1u << n) - 1));
+}
+
+SIMD_ALWAYS_INLINE inline simd_mask<std::int64_t, simd_abi::avx512> first_n_mask(int n, simd<std::int64_t, simd_abi::avx512> const*) {
+  return simd_mask<std::int64_t, simd_abi::avx512>(static_cast<__mmask8>(n <= 0 ? 0 : n >= 8 ? 0xFF : (1u << n) - 1));
+}
+
+/* Masked arithmetic with merge masking: lanes outside the mask keep a. */
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512> masked_plus(
+    simd_mask<float, simd_abi::avx512> const& mask, simd<float, simd_abi::avx512> const& a, simd<float, simd_abi::avx512> const& b) {
+  return simd<float, simd_abi::avx512>(_mm512_mask_add_ps(a.get(), mask.get(), a.get(), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512> masked_minus(
+    simd_mask<float, simd_abi::avx512> const& mask, simd<float, simd_abi::avx512> const& a, simd<float, simd_abi::avx512> const& b) {
+  return simd<float, simd_abi::avx512>(_mm512_mask_sub_ps(a.get(), mask.get(), a.get(), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512> masked_multiplies(
+    simd_mask<float, simd_abi::avx512> const& mask, simd<float, simd_abi::avx512> const& a, simd<float, simd_abi::avx512> const& b) {
+  return simd<float, simd_abi::avx512>(_mm512_mask_mul_ps(a.get(), mask.get(), a.get(), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512> masked_divides(
+    simd_mask<float, simd_abi::avx512> const& mask, simd<float, simd_abi::avx512> const& a, simd<float, simd_abi::avx512> const& b) {
+  return simd<float, simd_abi::avx512>(_mm512_mask_div_ps(a.get(), mask.get(), a.get(), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512> masked_plus(
+    simd_mask<double, simd_abi::avx512> const& mask, simd<double, simd_abi::avx512> const& a, simd<double, simd_abi::avx512> const& b) {
+  return simd<double, simd_abi::avx512>(_mm512_mask_add_pd(a.get(), mask.get(), a.get(), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512> masked_minus(
+    simd_mask<double, simd_abi::avx512> const& mask, simd<double, simd_abi::avx512> const& a, simd<double, simd_abi::avx512> const& b) {
+  return simd<double, simd_abi::avx512>(_mm512_mask_sub_pd(a.get(), mask.get(), a.get(), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512> masked_multiplies(
+    simd_mask<double, simd_abi::avx512> const& mask, simd<double, simd_abi::avx512> const& a, simd<double, simd_abi::avx512> const& b) {
+  return simd<double, simd_abi::avx512>(_mm512_mask_mul_pd(a.get(), mask.get(), a.get(), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512> masked_divides(
+    simd_mask<double, simd_abi::avx512> const& mask, simd<double, simd_abi::avx512> const& a, simd<double, simd_abi::avx512> const& b) {
+  return simd<double, simd_abi::avx512>(_mm512_mask_div_pd(a.get(), mask.get(), a.get(), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx512> masked_plus(
+    simd_mask<std::int32_t, simd_abi::avx512> const& mask, simd<std::int32_t, simd_abi::avx512> const& a, simd<std::int32_t, simd_abi::avx512> const& b) {
+  return simd<std::int32_t, simd_abi::avx512>(_mm512_mask_add_epi32(a.get(), mask.get(), a.get(), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx512> masked_minus(
+    simd_mask<std::int32_t, simd_abi::avx512> const& mask, simd<std::int32_t, simd_abi::avx512> const& a, simd<std::int32_t, simd_abi::avx512> const& b) {
+  return simd<std::int32_t, simd_abi::avx512>(_mm512_mask_sub_epi32(a.get(), mask.get(), a.get(), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx512> masked_multiplies(
+    simd_mask<std::int32_t, simd_abi::avx512> const& mask, simd<std::int32_t, simd_abi::avx512> const& a, simd<std::int32_t, simd_abi::avx512> const& b) {
+  return simd<std::int32_t, simd_abi::avx512>(_mm512_mask_mullo_epi32(a.get(), mask.get(), a.get(), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::avx512> masked_plus(
+    simd_mask<std::int64_t, simd_abi::avx512> const& mask, simd<std::int64_t, simd_abi::avx512> const& a, simd<std::int64_t, simd_abi::avx512> const& b) {
+  return simd<std::int64_t, simd_abi::avx512>(_mm512_mask_add_epi64(a.get(), mask.get(), a.get(), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::avx512> masked_minus(
+    simd_mask<std::int64_t, simd_abi::avx512> const& mask, simd<std::int64_t, simd_abi::avx512> const& a, simd<std::int64_t, simd_abi::avx512> const& b) {
+  return simd<std::int64_t, simd_abi::avx512>(_mm512_mask_sub_epi64(a.get(), mask.get(), a.get(), b.get()));
+}
+
+/* Gathers and scatters with one index per lane: int32_t indices for
+   float and int32_t, int64_t indices for double and int64_t.
+ */
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512> gather(float const* ptr, simd<std::int32_t, simd_abi::avx512> const& idx) {
+  return simd<float, simd_abi::avx512>(_mm512_i32gather_ps(idx.get(), ptr, 4));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512> gather(
+    float const* ptr, simd<std::int32_t, simd_abi::avx512> const& idx, simd_mask<float, simd_abi::avx512> const& mask, simd<float, simd_abi::avx512> const& other) {
+  return simd<float, simd_abi::avx512>(_mm512_mask_i32gather_ps(other.get(), mask.get(), idx.get(), ptr, 4));
+}
+
+SIMD_ALWAYS_INLINE inline void scatter(float* ptr, simd<std::int32_t, simd_abi::avx512> const& idx, simd<float, simd_abi::avx512> const& a) {
+  _mm512_i32scatter_ps(ptr, idx.get(), a.get(), 4);
+}
+
+SIMD_ALWAYS_INLINE inline void scatter(
+    float* ptr, simd<std::int32_t, simd_abi::avx512> const& idx, simd<float, simd_abi::avx512> const& a, simd_mask<float, simd_abi::avx512> const& mask) {
+  _mm512_mask_i32scatter_ps(ptr, mask.get(), idx.get(), a.get(), 4);
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512> gather(double const* ptr, simd<std::int64_t, simd_abi::avx512> const& idx) {
+  return simd<double, simd_abi::avx512>(_mm512_i64gather_pd(idx.get(), ptr, 8));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512> gather(
+    double const* ptr, simd<std::int64_t, simd_abi::avx512> const& idx, simd_mask<double, simd_abi::avx512> const& mask, simd<double, simd_abi::avx512> const& other) {
+  return simd<double, simd_abi::avx512>(_mm512_mask_i64gather_pd(other.get(), mask.get(), idx.get(), ptr, 8));
+}
+
+SIMD_ALWAYS_INLINE inline void scatter(double* ptr, simd<std::int64_t, simd_abi::avx512> const& idx, simd<double, simd_abi::avx512> const& a) {
+  _mm512_i64scatter_pd(ptr, idx.get(), a.get(), 8);
+}
+
+SIMD_ALWAYS_INLINE inline void scatter(
+    double* ptr, simd<std::int64_t, simd_abi::avx512> const& idx, simd<double, simd_abi::avx512> const& a, simd_mask<double, simd_abi::avx512> const& mask) {
+  _mm512_mask_i64scatter_pd(ptr, mask.get(), idx.get(), a.get(), 8);
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx512> gather(std::int32_t const* ptr, simd<std::int32_t, simd_abi::avx512> const& idx) {
+  return simd<std::int32_t, simd_abi::avx512>(_mm512_i32gather_epi32(idx.get(), ptr, 4));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx512> gather(
+    std::int32_t const* ptr, simd<std::int32_t, simd_abi::avx512> const& idx, simd_mask<std::int32_t, simd_abi::avx512> const& mask, simd<std::int32_t, simd_abi::avx512> const& other) {
+  return simd<std::int32_t, simd_abi::avx512>(_mm512_mask_i32gather_epi32(other.get(), mask.get(), idx.get(), ptr, 4));
+}
+
+SIMD_ALWAYS_INLINE inline void scatter(std::int32_t* ptr, simd<std::int32_t, simd_abi::avx512> const& idx, simd<std::int32_t, simd_abi::avx512> const& a) {
+  _mm512_i32scatter_epi32(ptr, idx.get(), a.get(), 4);
+}
+
+SIMD_ALWAYS_INLINE inline void scatter(
+    std::int32_t* ptr, simd<std::int32_t, simd_abi::avx512> const& idx, simd<std::int32_t, simd_abi::avx512> const& a, simd_mask<std::int32_t, simd_abi::avx512> const& mask) {
+  _mm512_mask_i32scatter_epi32(ptr, mask.get(), idx.get(), a.get(), 4);
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::avx512> gather(std::int64_t const* ptr, simd<std::int64_t, simd_abi::avx512> const& idx) {
+  return simd<std::int64_t, simd_abi::avx512>(_mm512_i64gather_epi64(idx.get(), ptr, 8));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::avx512> gather(
+    std::int64_t const* ptr, simd<std::int64_t, simd_abi::avx512> const& idx, simd_mask<std::int64_t, simd_abi::avx512> const& mask, simd<std::int64_t, simd_abi::avx512> const& other) {
+  return simd<std::int64_t, simd_abi::avx512>(_mm512_mask_i64gather_epi64(other.get(), mask.get(), idx.get(), ptr, 8));
+}
+
+SIMD_ALWAYS_INLINE inline void scatter(std::int64_t* ptr, simd<std::int64_t, simd_abi::avx512> const& idx, simd<std::int64_t, simd_abi::avx512> const& a) {
+  _mm512_i64scatter_epi64(ptr, idx.get(), a.get(), 8);
+}
+
+SIMD_ALWAYS_INLINE inline void scatter(
+    std::int64_t* ptr, simd<std::int64_t, simd_abi::avx512> const& idx, simd<std::int64_t, simd_abi::avx512> const& a, simd_mask<std::int64_t, simd_abi::avx512> const& mask) {
+  _mm512_mask_i64scatter_epi64(ptr, mask.get(), idx.get(), a.get(), 8);
+}
+
+/* Horizontal sums, minima and maxima with the _mm512_reduce_* sequences,
+   which fold 256-bit halves and then shuffle within 128 bits.
+ */
+
+SIMD_ALWAYS_INLINE inline float reduce(simd<float, simd_abi::avx512> const& a, std::plus<>) {
+  return _mm512_reduce_add_ps(a.get());
+}
+
+SIMD_ALWAYS_INLINE inline float hmin(simd<float, simd_abi::avx512> const& a) {
+  return _mm512_reduce_min_ps(a.get());
+}
+
+SIMD_ALWAYS_INLINE inline float hmax(simd<float, simd_abi::avx512> const& a) {
+  return _mm512_reduce_max_ps(a.get());
+}
+
+SIMD_ALWAYS_INLINE inline double reduce(simd<double, simd_abi::avx512> const& a, std::plus<>) {
+  return _mm512_reduce_add_pd(a.get());
+}
+
+SIMD_ALWAYS_INLINE inline double hmin(simd<double, simd_abi::avx512> const& a) {
+  return _mm512_reduce_min_pd(a.get());
+}
+
+SIMD_ALWAYS_INLINE inline double hmax(simd<double, simd_abi::avx512> const& a) {
+  return _mm512_reduce_max_pd(a.get());
+}
+
+SIMD_ALWAYS_INLINE inline std::int32_t reduce(simd<std::int32_t, simd_abi::avx512> const& a, std::plus<>) {
+  return _mm512_reduce_add_epi32(a.get());
+}
+
+SIMD_ALWAYS_INLINE inline std::int32_t hmin(simd<std::int32_t, simd_abi::avx512> const& a) {
+  return _mm512_reduce_min_epi32(a.get());
+}
+
+SIMD_ALWAYS_INLINE inline std::int32_t hmax(simd<std::int32_t, simd_abi::avx512> const& a) {
+  return _mm512_reduce_max_epi32(a.get());
+}
+
+SIMD_ALWAYS_INLINE inline std::int64_t reduce(simd<std::int64_t, simd_abi::avx512> const& a, std::plus<>) {
+  return _mm512_reduce_add_epi64(a.get());
+}
+
+SIMD_ALWAYS_INLINE inline std::int64_t hmin(simd<std::int64_t, simd_abi::avx512> const& a) {
+  return _mm512_reduce_min_epi64(a.get());
+}
+
+SIMD_ALWAYS_INLINE inline std::int64_t hmax(simd<std::int64_t, simd_abi::avx512> const& a) {
+  return _mm512_reduce_max_epi64(a.get());
+}
+
+/* Conversions, the building blocks of static_simd_cast and friends.
+   cvtt* truncate and cvt* round in the current rounding mode; both give
+   the lowest integer for lanes that do not fit, which the saturating
+   versions fix up with masks.
+ */
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512> convert(
+    simd<std::int32_t, simd_abi::avx512> const& a, simd<float, simd_abi::avx512> const*, impl::truncating_tag) {
+  return simd<float, simd_abi::avx512>(_mm512_cvtepi32_ps(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx512> convert(
+    simd<float, simd_abi::avx512> const& a, simd<std::int32_t, simd_abi::avx512> const*, impl::truncating_tag) {
+  return simd<std::int32_t, simd_abi::avx512>(_mm512_cvttps_epi32(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx512> convert(
+    simd<float, simd_abi::avx512> const& a, simd<std::int32_t, simd_abi::avx512> const*, impl::rounding_tag) {
+  return simd<std::int32_t, simd_abi::avx512>(_mm512_cvtps_epi32(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx512> convert(
+    simd<float, simd_abi::avx512> const& a, simd<std::int32_t, simd_abi::avx512> const*, impl::saturating_tag) {
+  __mmask16 const too_large = _mm512_cmp_ps_mask(a.get(), _mm512_set1_ps(2147483648.0f), _CMP_GE_OQ);
+  __mmask16 const is_number = _mm512_cmp_ps_mask(a.get(), a.get(), _CMP_ORD_Q);
+  __m512i const r = _mm512_mask_mov_epi32(_mm512_cvttps_epi32(a.get()), too_large, _mm512_set1_epi32(std::numeric_limits<std::int32_t>::max()));
+  return simd<std::int32_t, simd_abi::avx512>(_mm512_maskz_mov_epi32(is_number, r));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512> convert(
+    simd<double, simd_abi::avx512> const& lo, simd<double, simd_abi::avx512> const& hi,
+    simd<float, simd_abi::avx512> const*, impl::truncating_tag) {
+  __m512d const r_lo = _mm512_castps_pd(_mm512_castps256_ps512(_mm512_cvtpd_ps(lo.get())));
+  return simd<float, simd_abi::avx512>(
+      _mm512_castpd_ps(_mm512_insertf64x4(r_lo, _mm256_castps_pd(_mm512_cvtpd_ps(hi.get())), 1)));
+}
+
+SIMD_ALWAYS_INLINE inline void convert(
+    simd<float, simd_abi::avx512> const& a, simd<double, simd_abi::avx512>* lo, simd<double, simd_abi::avx512>* hi,
+    impl::truncating_tag) {
+  *lo = simd<double, simd_abi::avx512>(_mm512_cvtps_pd(_mm512_castps512_ps256(a.get())));
+  *hi = simd<double, simd_abi::avx512>(
+      _mm512_cvtps_pd(_mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(a.get()), 1))));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx512> convert(
+    simd<double, simd_abi::avx512> const& lo, simd<double, simd_abi::avx512> const& hi,
+    simd<std::int32_t, simd_abi::avx512> const*, impl::truncating_tag) {
+  return simd<std::int32_t, simd_abi::avx512>(
+      _mm512_inserti64x4(_mm512_castsi256_si512(_mm512_cvttpd_epi32(lo.get())), _mm512_cvttpd_epi32(hi.get()), 1));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx512> convert(
+    simd<double, simd_abi::avx512> const& lo, simd<double, simd_abi::avx512> const& hi,
+    simd<std::int32_t, simd_abi::avx512> const*, impl::rounding_tag) {
+  return simd<std::int32_t, simd_abi::avx512>(
+      _mm512_inserti64x4(_mm512_castsi256_si512(_mm512_cvtpd_epi32(lo.get())), _mm512_cvtpd_epi32(hi.get()), 1));
+}
+
+SIMD_ALWAYS_INLINE inline void convert(
+    simd<std::int32_t, simd_abi::avx512> const& a, simd<double, simd_abi::avx512>* lo, simd<double, simd_abi::avx512>* hi,
+    impl::truncating_tag) {
+  *lo = simd<double, simd_abi::avx512>(_mm512_cvtepi32_pd(_mm512_castsi512_si256(a.get())));
+  *hi = simd<double, simd_abi::avx512>(_mm512_cvtepi32_pd(_mm512_extracti64x4_epi64(a.get(), 1)));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx512> convert(
+    simd<std::int64_t, simd_abi::avx512> const& lo, simd<std::int64_t, simd_abi::avx512> const& hi,
+    simd<std::int32_t, simd_abi::avx512> const*, impl::truncating_tag) {
+  return simd<std::int32_t, simd_abi::avx512>(
+      _mm512_inserti64x4(_mm512_castsi256_si512(_mm512_cvtepi64_epi32(lo.get())), _mm512_cvtepi64_epi32(hi.get()), 1));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx512> convert(
+    simd<std::int64_t, simd_abi::avx512> const& lo, simd<std::int64_t, simd_abi::avx512> const& hi,
+    simd<std::int32_t, simd_abi::avx512> const*, impl::saturating_tag) {
+  return simd<std::int32_t, simd_abi::avx512>(
+      _mm512_inserti64x4(_mm512_castsi256_si512(_mm512_cvtsepi64_epi32(lo.get())), _mm512_cvtsepi64_epi32(hi.get()), 1));
+}
+
+SIMD_ALWAYS_INLINE inline void convert(
+    simd<std::int32_t, simd_abi::avx512> const& a, simd<std::int64_t, simd_abi::avx512>* lo, simd<std::int64_t, simd_abi::avx512>* hi,
+    impl::truncating_tag) {
+  *lo = simd<std::int64_t, simd_abi::avx512>(_mm512_cvtepi32_epi64(_mm512_castsi512_si256(a.get())));
+  *hi = simd<std::int64_t, simd_abi::avx512>(_mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(a.get(), 1)));
+}
+
+#ifdef __AVX512DQ__
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512> convert(
+    simd<std::int64_t, simd_abi::avx512> const& a, simd<double, simd_abi::avx512> const*, impl::truncating_tag) {
+  return simd<double, simd_abi::avx512>(_mm512_cvtepi64_pd(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::avx512> convert(
+    simd<double, simd_abi::avx512> const& a, simd<std::int64_t, simd_abi::avx512> const*, impl::truncating_tag) {
+  return simd<std::int64_t, simd_abi::avx512>(_mm512_cvttpd_epi64(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::avx512> convert(
+    simd<double, simd_abi::avx512> const& a, simd<std::int64_t, simd_abi::avx512> const*, impl::rounding_tag) {
+  return simd<std::int64_t, simd_abi::avx512>(_mm512_cvtpd_epi64(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::avx512> convert(
+    simd<double, simd_abi::avx512> const& a, simd<std::int64_t, simd_abi::avx512> const*, impl::saturating_tag) {
+  __mmask8 const too_large = _mm512_cmp_pd_mask(a.get(), _mm512_set1_pd(9223372036854775808.0), _CMP_GE_OQ);
+  __mmask8 const is_number = _mm512_cmp_pd_mask(a.get(), a.get(), _CMP_ORD_Q);
+  __m512i const r = _mm512_mask_mov_epi64(_mm512_cvttpd_epi64(a.get()), too_large, _mm512_set1_epi64(std::numeric_limits<std::int64_t>::max()));
+  return simd<std::int64_t, simd_abi::avx512>(_mm512_maskz_mov_epi64(is_number, r));
+}
+#endif
+
+
+/* Permutations, interleaving and shift_in index into a and b together
+   with one permutexvar or permutex2var.
+ */
+
+template <int... Idx>
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512> permute(
+    simd<float, simd_abi::avx512> const& a, std::integer_sequence<int, Idx...>) {
+  std::int32_t const idx[] = {Idx...};
+  return simd<float, simd_abi::avx512>(_mm512_permutexvar_ps(_mm512_loadu_si512(idx), a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512> interleave_lo(
+    simd<float, simd_abi::avx512> const& a, simd<float, simd_abi::avx512> const& b) {
+  return simd<float, simd_abi::avx512>(_mm512_permutex2var_ps(a.get(), _mm512_setr_epi32(0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512> interleave_hi(
+    simd<float, simd_abi::avx512> const& a, simd<float, simd_abi::avx512> const& b) {
+  return simd<float, simd_abi::avx512>(_mm512_permutex2var_ps(a.get(), _mm512_setr_epi32(8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512> shift_in(
+    simd<float, simd_abi::avx512> const& a, simd<float, simd_abi::avx512> const& b, int k) {
+  __m512i const idx = _mm512_add_epi32(_mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), _mm512_set1_epi32(k));
+  return simd<float, simd_abi::avx512>(_mm512_permutex2var_ps(a.get(), idx, b.get()));
+}
+
+template <int... Idx>
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512> permute(
+    simd<double, simd_abi::avx512> const& a, std::integer_sequence<int, Idx...>) {
+  std::int64_t const idx[] = {Idx...};
+  return simd<double, simd_abi::avx512>(_mm512_permutexvar_pd(_mm512_loadu_si512(idx), a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512> interleave_lo(
+    simd<double, simd_abi::avx512> const& a, simd<double, simd_abi::avx512> const& b) {
+  return simd<double, simd_abi::avx512>(_mm512_permutex2var_pd(a.get(), _mm512_setr_epi64(0, 8, 1, 9, 2, 10, 3, 11), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512> interleave_hi(
+    simd<double, simd_abi::avx512> const& a, simd<double, simd_abi::avx512> const& b) {
+  return simd<double, simd_abi::avx512>(_mm512_permutex2var_pd(a.get(), _mm512_setr_epi64(4, 12, 5, 13, 6, 14, 7, 15), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512> shift_in(
+    simd<double, simd_abi::avx512> const& a, simd<double, simd_abi::avx512> const& b, int k) {
+  __m512i const idx = _mm512_add_epi64(_mm512_setr_epi64(0, 1, 2, 3, 4, 5, 6, 7), _mm512_set1_epi64(k));
+  return simd<double, simd_abi::avx512>(_mm512_permutex2var_pd(a.get(), idx, b.get()));
+}
+
+template <int... Idx>
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx512> permute(
+    simd<std::int32_t, simd_abi::avx512> const& a, std::integer_sequence<int, Idx...>) {
+  std::int32_t const idx[] = {Idx...};
+  return simd<std::int32_t, simd_abi::avx512>(_mm512_permutexvar_epi32(_mm512_loadu_si512(idx), a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx512> interleave_lo(
+    simd<std::int32_t, simd_abi::avx512> const& a, simd<std::int32_t, simd_abi::avx512> const& b) {
+  return simd<std::int32_t, simd_abi::avx512>(_mm512_permutex2var_epi32(a.get(), _mm512_setr_epi32(0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx512> interleave_hi(
+    simd<std::int32_t, simd_abi::avx512> const& a, simd<std::int32_t, simd_abi::avx512> const& b) {
+  return simd<std::int32_t, simd_abi::avx512>(_mm512_permutex2var_epi32(a.get(), _mm512_setr_epi32(8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx512> shift_in(
+    simd<std::int32_t, simd_abi::avx512> const& a, simd<std::int32_t, simd_abi::avx512> const& b, int k) {
+  __m512i const idx = _mm512_add_epi32(_mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), _mm512_set1_epi32(k));
+  return simd<std::int32_t, simd_abi::avx512>(_mm512_permutex2var_epi32(a.get(), idx, b.get()));
+}
+
+template <int... Idx>
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::avx512> permute(
+    simd<std::int64_t, simd_abi::avx512> const& a, std::integer_sequence<int, Idx...>) {
+  std::int64_t const idx[] = {Idx...};
+  return simd<std::int64_t, simd_abi::avx512>(_mm512_permutexvar_epi64(_mm512_loadu_si512(idx), a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::avx512> interleave_lo(
+    simd<std::int64_t, simd_abi::avx512> const& a, simd<std::int64_t, simd_abi::avx512> const& b) {
+  return simd<std::int64_t, simd_abi::avx512>(_mm512_permutex2var_epi64(a.get(), _mm512_setr_epi64(0, 8, 1, 9, 2, 10, 3, 11), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::avx512> interleave_hi(
+    simd<std::int64_t, simd_abi::avx512> const& a, simd<std::int64_t, simd_abi::avx512> const& b) {
+  return simd<std::int64_t, simd_abi::avx512>(_mm512_permutex2var_epi64(a.get(), _mm512_setr_epi64(4, 12, 5, 13, 6, 14, 7, 15), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::avx512> shift_in(
+    simd<std::int64_t, simd_abi::avx512> const& a, simd<std::int64_t, simd_abi::avx512> const& b, int k) {
+  __m512i const idx = _mm512_add_epi64(_mm512_setr_epi64(0, 1, 2, 3, 4, 5, 6, 7), _mm512_set1_epi64(k));
+  return simd<std::int64_t, simd_abi::avx512>(_mm512_permutex2var_epi64(a.get(), idx, b.get()));
+}
+
+/* compress_store and expand_load are the compress and expand instructions. */
+
+SIMD_ALWAYS_INLINE inline int compress_store(
+    float* ptr, simd_mask<float, simd_abi::avx512> const& mask, simd<float, simd_abi::avx512> const& a) {
+  _mm512_mask_compressstoreu_ps(ptr, mask.get(), a.get());
+  return popcount(mask);
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512> expand_load(
+    float const* ptr, simd_mask<float, simd_abi::avx512> const& mask) {
+  return simd<float, simd_abi::avx512>(_mm512_maskz_expandloadu_ps(mask.get(), ptr));
+}
+
+SIMD_ALWAYS_INLINE inline int compress_store(
+    double* ptr, simd_mask<double, simd_abi::avx512> const& mask, simd<double, simd_abi::avx512> const& a) {
+  _mm512_mask_compressstoreu_pd(ptr, mask.get(), a.get());
+  return popcount(mask);
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512> expand_load(
+    double const* ptr, simd_mask<double, simd_abi::avx512> const& mask) {
+  return simd<double, simd_abi::avx512>(_mm512_maskz_expandloadu_pd(mask.get(), ptr));
+}
+
+SIMD_ALWAYS_INLINE inline int compress_store(
+    std::int32_t* ptr, simd_mask<std::int32_t, simd_abi::avx512> const& mask, simd<std::int32_t, simd_abi::avx512> const& a) {
+  _mm512_mask_compressstoreu_epi32(ptr, mask.get(), a.get());
+  return popcount(mask);
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx512> expand_load(
+    std::int32_t const* ptr, simd_mask<std::int32_t, simd_abi::avx512> const& mask) {
+  return simd<std::int32_t, simd_abi::avx512>(_mm512_maskz_expandloadu_epi32(mask.get(), ptr));
+}
+
+SIMD_ALWAYS_INLINE inline int compress_store(
+    std::int64_t* ptr, simd_mask<std::int64_t, simd_abi::avx512> const& mask, simd<std::int64_t, simd_abi::avx512> const& a) {
+  _mm512_mask_compressstoreu_epi64(ptr, mask.get(), a.get());
+  return popcount(mask);
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::avx512> expand_load(
+    std::int64_t const* ptr, simd_mask<std::int64_t, simd_abi::avx512> const& mask) {
+  return simd<std::int64_t, simd_abi::avx512>(_mm512_maskz_expandloadu_epi64(mask.get(), ptr));
+}
+
 }
 
 #endif
@@ -0,0 +1,1454 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 2.0
+//              Copyright (2014) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#pragma once
+
+#include "simd_common.hpp"
+
+#if defined(__AVX512F__) && defined(__AVX512VL__)
+
+#include <immintrin.h>
+
+namespace SIMD_NAMESPACE {
+
+namespace simd_abi {
+
+/* The AVX-512 instruction set on 256-bit ymm registers (AVX-512VL):
+   mask registers, masked blends and operations, roundscale, getexp,
+   scalef and the 14-bit estimates, without the lower clock speed that
+   heavy 512-bit arithmetic costs on some processors.
+ */
+class avx512_256 {};
+
+}
+
+template <>
+class simd_mask<float, simd_abi::avx512_256> {
+  __mmask8 m_value;
+ public:
+  using value_type = bool;
+  using simd_type = simd<float, simd_abi::avx512_256>;
+  using abi_type = simd_abi::avx512_256;
+  SIMD_ALWAYS_INLINE inline simd_mask() = default;
+  SIMD_ALWAYS_INLINE inline simd_mask(bool value)
+    :m_value(value ? 0xFF : 0x00)
+  {}
+  SIMD_ALWAYS_INLINE inline static constexpr int size() { return 8; }
+  SIMD_ALWAYS_INLINE inline constexpr simd_mask(__mmask8 const& value_in)
+    :m_value(value_in)
+  {}
+  SIMD_ALWAYS_INLINE inline constexpr __mmask8 get() const { return m_value; }
+  SIMD_ALWAYS_INLINE inline simd_mask operator||(simd_mask const& other) const {
+    return simd_mask(static_cast<__mmask8>(m_value | other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask operator&&(simd_mask const& other) const {
+    return simd_mask(static_cast<__mmask8>(m_value & other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask operator!() const {
+    return simd_mask(static_cast<__mmask8>(m_value ^ 0xFF));
+  }
+};
+
+SIMD_ALWAYS_INLINE inline bool all_of(simd_mask<float, simd_abi::avx512_256> const& a) {
+  return a.get() == 0xFF;
+}
+
+SIMD_ALWAYS_INLINE inline bool any_of(simd_mask<float, simd_abi::avx512_256> const& a) {
+  return a.get() != 0x00;
+}
+
+SIMD_ALWAYS_INLINE inline std::uint64_t to_bitmask(simd_mask<float, simd_abi::avx512_256> const& a) {
+  return std::uint64_t(a.get());
+}
+
+SIMD_ALWAYS_INLINE inline simd_mask<float, simd_abi::avx512_256> from_bitmask(std::uint64_t bits, simd_mask<float, simd_abi::avx512_256> const*) {
+  return simd_mask<float, simd_abi::avx512_256>(static_cast<__mmask8>(bits));
+}
+
+template <>
+class simd<float, simd_abi::avx512_256> {
+  __m256 m_value;
+ public:
+  SIMD_ALWAYS_INLINE simd() = default;
+  using value_type = float;
+  using abi_type = simd_abi::avx512_256;
+  using mask_type = simd_mask<float, abi_type>;
+  using storage_type = simd_storage<float, abi_type>;
+  SIMD_ALWAYS_INLINE inline static constexpr int size() { return 8; }
+  SIMD_ALWAYS_INLINE inline simd(float value)
+    :m_value(_mm256_set1_ps(value))
+  {}
+  SIMD_ALWAYS_INLINE inline simd(
+      float a, float b, float c, float d,
+      float e, float f, float g, float h)
+    :m_value(_mm256_setr_ps(a, b, c, d, e, f, g, h))
+  {}
+  SIMD_ALWAYS_INLINE inline
+  simd(storage_type const& value) {
+    copy_from(value.data(), vector_aligned_tag());
+  }
+  SIMD_ALWAYS_INLINE inline
+  simd& operator=(storage_type const& value) {
+    copy_from(value.data(), vector_aligned_tag());
+    return *this;
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline simd(float const* ptr, Flags flags) {
+    copy_from(ptr, flags);
+  }
+  SIMD_ALWAYS_INLINE inline simd(float const* ptr, int stride)
+    :m_value(_mm256_i32gather_ps(ptr, _mm256_mullo_epi32(_mm256_set1_epi32(stride), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)), 4))
+  {}
+  SIMD_ALWAYS_INLINE inline constexpr simd(__m256 const& value_in)
+    :m_value(value_in)
+  {}
+  SIMD_ALWAYS_INLINE inline simd operator*(simd const& other) const {
+    return simd(_mm256_mul_ps(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator/(simd const& other) const {
+    return simd(_mm256_div_ps(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator+(simd const& other) const {
+    return simd(_mm256_add_ps(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator-(simd const& other) const {
+    return simd(_mm256_sub_ps(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd operator-() const {
+    return simd(_mm256_sub_ps(_mm256_set1_ps(0.0), m_value));
+  }
+  SIMD_ALWAYS_INLINE inline void copy_from(float const* ptr, element_aligned_tag) {
+    m_value = _mm256_loadu_ps(ptr);
+  }
+  SIMD_ALWAYS_INLINE inline void copy_to(float* ptr, element_aligned_tag) const {
+    _mm256_storeu_ps(ptr, m_value);
+  }
+  SIMD_ALWAYS_INLINE inline void copy_from(float const* ptr, vector_aligned_tag) {
+    m_value = _mm256_load_ps(ptr);
+  }
+  SIMD_ALWAYS_INLINE inline void copy_to(float* ptr, vector_aligned_tag) const {
+    _mm256_store_ps(ptr, m_value);
+  }
+  SIMD_ALWAYS_INLINE inline void copy_to(float* ptr, nontemporal_tag) const {
+    _mm256_stream_ps(ptr, m_value);
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline void copy_from(float const* ptr, mask_type const& mask, Flags /*flags*/) {
+    m_value = _mm256_mask_loadu_ps(m_value, mask.get(), ptr);
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline void copy_to(float* ptr, mask_type const& mask, Flags /*flags*/) const {
+    _mm256_mask_storeu_ps(ptr, mask.get(), m_value);
+  }
+  template <std::size_t N>
+  SIMD_ALWAYS_INLINE inline void copy_from(float const* ptr, overaligned_tag<N>) {
+    copy_from(ptr, impl::overaligned_as<N, alignof(simd)>());
+  }
+  template <std::size_t N>
+  SIMD_ALWAYS_INLINE inline void copy_to(float* ptr, overaligned_tag<N>) const {
+    copy_to(ptr, impl::overaligned_as<N, alignof(simd)>());
+  }
+  SIMD_ALWAYS_INLINE inline constexpr __m256 get() const { return m_value; }
+  SIMD_ALWAYS_INLINE inline simd_mask<float, simd_abi::avx512_256> operator<(simd const& other) const {
+    return simd_mask<float, simd_abi::avx512_256>(_mm256_cmp_ps_mask(m_value, other.m_value, _CMP_LT_OS));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<float, simd_abi::avx512_256> operator==(simd const& other) const {
+    return simd_mask<float, simd_abi::avx512_256>(_mm256_cmp_ps_mask(m_value, other.m_value, _CMP_EQ_OQ));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<float, simd_abi::avx512_256> operator>(simd const& other) const {
+    return simd_mask<float, simd_abi::avx512_256>(_mm256_cmp_ps_mask(m_value, other.m_value, _CMP_GT_OQ));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<float, simd_abi::avx512_256> operator<=(simd const& other) const {
+    return simd_mask<float, simd_abi::avx512_256>(_mm256_cmp_ps_mask(m_value, other.m_value, _CMP_LE_OQ));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<float, simd_abi::avx512_256> operator>=(simd const& other) const {
+    return simd_mask<float, simd_abi::avx512_256>(_mm256_cmp_ps_mask(m_value, other.m_value, _CMP_GE_OQ));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<float, simd_abi::avx512_256> operator!=(simd const& other) const {
+    return simd_mask<float, simd_abi::avx512_256>(_mm256_cmp_ps_mask(m_value, other.m_value, _CMP_NEQ_UQ));
+  }
+};
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512_256> multiplysign(simd<float, simd_abi::avx512_256> const& a, simd<float, simd_abi::avx512_256> const& b) {
+  static const __m256i sign_mask = reinterpret_cast<__m256i>(simd<float, simd_abi::avx512_256>(-0.0).get());
+  return simd<float, simd_abi::avx512_256>(
+      reinterpret_cast<__m256>(_mm256_xor_si256(
+          reinterpret_cast<__m256i>(a.get()), 
+          _mm256_and_si256(sign_mask, reinterpret_cast<__m256i>(b.get()))
+          ))
+      );
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512_256> copysign(simd<float, simd_abi::avx512_256> const& a, simd<float, simd_abi::avx512_256> const& b) {
+  static const __m256i sign_mask = reinterpret_cast<__m256i>(simd<float, simd_abi::avx512_256>(-0.0).get());
+  return simd<float, simd_abi::avx512_256>(
+      reinterpret_cast<__m256>(_mm256_xor_si256(
+          _mm256_andnot_si256(sign_mask, reinterpret_cast<__m256i>(a.get())),
+          _mm256_and_si256(sign_mask, reinterpret_cast<__m256i>(b.get()))
+          ))
+      );
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512_256> abs(simd<float, simd_abi::avx512_256> const& a) {
+  __m256 const rhs = a.get();
+  return reinterpret_cast<__m256>(_mm256_and_si256(reinterpret_cast<__m256i>(rhs), _mm256_set1_epi32(0x7fffffff)));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512_256> sqrt(simd<float, simd_abi::avx512_256> const& a) {
+  return simd<float, simd_abi::avx512_256>(_mm256_sqrt_ps(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512_256> rcp_estimate(simd<float, simd_abi::avx512_256> const& a) {
+  return simd<float, simd_abi::avx512_256>(_mm256_rcp14_ps(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512_256> rsqrt_estimate(simd<float, simd_abi::avx512_256> const& a) {
+  return simd<float, simd_abi::avx512_256>(_mm256_rsqrt14_ps(a.get()));
+}
+
+// the 14-bit estimates have a relative error below 2^-14
+SIMD_ALWAYS_INLINE inline constexpr int reciprocal_estimate_bits(simd<float, simd_abi::avx512_256> const*) { return 14; }
+
+#ifdef __INTEL_COMPILER
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512_256> cbrt(simd<float, simd_abi::avx512_256> const& a) {
+  return simd<float, simd_abi::avx512_256>(_mm256_cbrt_ps(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512_256> exp(simd<float, simd_abi::avx512_256> const& a) {
+  return simd<float, simd_abi::avx512_256>(_mm256_exp_ps(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512_256> log(simd<float, simd_abi::avx512_256> const& a) {
+  return simd<float, simd_abi::avx512_256>(_mm256_log_ps(a.get()));
+}
+#endif
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512_256> fma(
+    simd<float, simd_abi::avx512_256> const& a,
+    simd<float, simd_abi::avx512_256> const& b,
+    simd<float, simd_abi::avx512_256> const& c) {
+  return simd<float, simd_abi::avx512_256>(_mm256_fmadd_ps(a.get(), b.get(), c.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512_256> max(
+    simd<float, simd_abi::avx512_256> const& a, simd<float, simd_abi::avx512_256> const& b) {
+  return simd<float, simd_abi::avx512_256>(_mm256_max_ps(a.get(), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512_256> min(
+    simd<float, simd_abi::avx512_256> const& a, simd<float, simd_abi::avx512_256> const& b) {
+  return simd<float, simd_abi::avx512_256>(_mm256_min_ps(a.get(), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512_256> choose(
+    simd_mask<float, simd_abi::avx512_256> const& a, simd<float, simd_abi::avx512_256> const& b, simd<float, simd_abi::avx512_256> const& c) {
+  return simd<float, simd_abi::avx512_256>(_mm256_mask_blend_ps(a.get(), c.get(), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512_256> roundeven(simd<float, simd_abi::avx512_256> const& a) {
+  return simd<float, simd_abi::avx512_256>(_mm256_roundscale_ps(a.get(), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512_256> floor(simd<float, simd_abi::avx512_256> const& a) {
+  return simd<float, simd_abi::avx512_256>(_mm256_roundscale_ps(a.get(), _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512_256> ceil(simd<float, simd_abi::avx512_256> const& a) {
+  return simd<float, simd_abi::avx512_256>(_mm256_roundscale_ps(a.get(), _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512_256> trunc(simd<float, simd_abi::avx512_256> const& a) {
+  return simd<float, simd_abi::avx512_256>(_mm256_roundscale_ps(a.get(), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512_256> nearbyint(simd<float, simd_abi::avx512_256> const& a) {
+  return simd<float, simd_abi::avx512_256>(_mm256_roundscale_ps(a.get(), _MM_FROUND_CUR_DIRECTION | _MM_FROUND_NO_EXC));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512_256> pow2i(simd<float, simd_abi::avx512_256> const& n) {
+  return simd<float, simd_abi::avx512_256>(_mm256_scalef_ps(_mm256_set1_ps(1.f), n.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512_256> getexp(simd<float, simd_abi::avx512_256> const& a) {
+  return simd<float, simd_abi::avx512_256>(_mm256_getexp_ps(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512_256> getmant(simd<float, simd_abi::avx512_256> const& a) {
+  return simd<float, simd_abi::avx512_256>(_mm256_getmant_ps(a.get(), _MM_MANT_NORM_1_2, _MM_MANT_SIGN_zero));
+}
+
+// getexp, getmant and scalef cover subnormals themselves
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512_256> frexp(simd<float, simd_abi::avx512_256> const& a, simd<float, simd_abi::avx512_256>* e) {
+  __mmask8 const is_finite_nonzero = _mm256_cmp_ps_mask(abs(a).get(), _mm256_set1_ps(std::numeric_limits<float>::infinity()), _CMP_LT_OQ)
+    & _mm256_cmp_ps_mask(a.get(), _mm256_setzero_ps(), _CMP_NEQ_OQ);
+  *e = simd<float, simd_abi::avx512_256>(_mm256_maskz_add_ps(is_finite_nonzero, _mm256_getexp_ps(a.get()), _mm256_set1_ps(1.f)));
+  return simd<float, simd_abi::avx512_256>(_mm256_mask_getmant_ps(a.get(), is_finite_nonzero, a.get(), _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512_256> ldexp(simd<float, simd_abi::avx512_256> const& a, simd<float, simd_abi::avx512_256> const& n) {
+  return simd<float, simd_abi::avx512_256>(_mm256_scalef_ps(a.get(), n.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512_256> logb(simd<float, simd_abi::avx512_256> const& a) {
+  return simd<float, simd_abi::avx512_256>(_mm256_getexp_ps(a.get()));
+}
+
+// with four lanes only the low four bits of the mask are used
+template <>
+class simd_mask<double, simd_abi::avx512_256> {
+  __mmask8 m_value;
+ public:
+  using value_type = bool;
+  using simd_type = simd<double, simd_abi::avx512_256>;
+  using abi_type = simd_abi::avx512_256;
+  SIMD_ALWAYS_INLINE inline simd_mask() = default;
+  SIMD_ALWAYS_INLINE inline simd_mask(bool value)
+    :m_value(value ? 0x0F : 0x00)
+  {}
+  SIMD_ALWAYS_INLINE inline static constexpr int size() { return 4; }
+  SIMD_ALWAYS_INLINE inline constexpr simd_mask(__mmask8 const& value_in)
+    :m_value(value_in)
+  {}
+  SIMD_ALWAYS_INLINE inline constexpr __mmask8 get() const { return m_value; }
+  SIMD_ALWAYS_INLINE inline simd_mask operator||(simd_mask const& other) const {
+    return simd_mask(static_cast<__mmask8>(m_value | other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask operator&&(simd_mask const& other) const {
+    return simd_mask(static_cast<__mmask8>(m_value & other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask operator!() const {
+    return simd_mask(static_cast<__mmask8>(m_value ^ 0x0F));
+  }
+};
+
+SIMD_ALWAYS_INLINE inline bool all_of(simd_mask<double, simd_abi::avx512_256> const& a) {
+  return a.get() == 0x0F;
+}
+
+SIMD_ALWAYS_INLINE inline bool any_of(simd_mask<double, simd_abi::avx512_256> const& a) {
+  return a.get() != 0x00;
+}
+
+SIMD_ALWAYS_INLINE inline std::uint64_t to_bitmask(simd_mask<double, simd_abi::avx512_256> const& a) {
+  return std::uint64_t(a.get());
+}
+
+SIMD_ALWAYS_INLINE inline simd_mask<double, simd_abi::avx512_256> from_bitmask(std::uint64_t bits, simd_mask<double, simd_abi::avx512_256> const*) {
+  return simd_mask<double, simd_abi::avx512_256>(static_cast<__mmask8>(bits & 0x0F));
+}
+
+template <>
+class simd<double, simd_abi::avx512_256> {
+  __m256d m_value;
+ public:
+  using value_type = double;
+  using abi_type = simd_abi::avx512_256;
+  using mask_type = simd_mask<double, abi_type>;
+  using storage_type = simd_storage<double, abi_type>;
+  SIMD_ALWAYS_INLINE inline simd() = default;
+  SIMD_ALWAYS_INLINE inline simd(simd const&) = default;
+  SIMD_ALWAYS_INLINE inline simd(simd&&) = default;
+  SIMD_ALWAYS_INLINE inline simd& operator=(simd const&) = default;
+  SIMD_ALWAYS_INLINE inline simd& operator=(simd&&) = default;
+  SIMD_ALWAYS_INLINE inline static constexpr int size() { return 4; }
+  SIMD_ALWAYS_INLINE inline simd(double value)
+    :m_value(_mm256_set1_pd(value))
+  {}
+  SIMD_ALWAYS_INLINE inline simd(
+      double a, double b, double c, double d)
+    :m_value(_mm256_setr_pd(a, b, c, d))
+  {}
+  SIMD_ALWAYS_INLINE inline
+  simd(storage_type const& value) {
+    copy_from(value.data(), vector_aligned_tag());
+  }
+#ifdef STK_VOLATILE_SIMD
+  SIMD_ALWAYS_INLINE inline
+  simd(simd const volatile& value)
+    :m_value(value.m_value)
+  {}
+#endif
+  SIMD_ALWAYS_INLINE inline
+  simd& operator=(storage_type const& value) {
+    copy_from(value.data(), vector_aligned_tag());
+    return *this;
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline simd(double const* ptr, Flags flags) {
+    copy_from(ptr, flags);
+  }
+  SIMD_ALWAYS_INLINE inline simd(double const* ptr, int stride)
+    :m_value(_mm256_i32gather_pd(ptr, _mm_mullo_epi32(_mm_set1_epi32(stride), _mm_setr_epi32(0, 1, 2, 3)), 8))
+  {}
+  SIMD_ALWAYS_INLINE inline constexpr simd(__m256d const& value_in)
+    :m_value(value_in)
+  {}
+  SIMD_ALWAYS_INLINE inline simd operator*(simd const& other) const {
+    return simd(_mm256_mul_pd(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator/(simd const& other) const {
+    return simd(_mm256_div_pd(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator+(simd const& other) const {
+    return simd(_mm256_add_pd(m_value, other.m_value));
+  }
+#ifdef STK_VOLATILE_SIMD
+  SIMD_ALWAYS_INLINE inline void plus_equals(simd const volatile& other) volatile {
+    m_value = _mm256_add_pd(m_value, other.m_value);
+  }
+#endif
+  SIMD_ALWAYS_INLINE inline simd operator-(simd const& other) const {
+    return simd(_mm256_sub_pd(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd operator-() const {
+    return simd(_mm256_sub_pd(_mm256_set1_pd(0.0), m_value));
+  }
+  SIMD_ALWAYS_INLINE inline void copy_from(double const* ptr, element_aligned_tag) {
+    m_value = _mm256_loadu_pd(ptr);
+  }
+  SIMD_ALWAYS_INLINE inline void copy_to(double* ptr, element_aligned_tag) const {
+    _mm256_storeu_pd(ptr, m_value);
+  }
+  SIMD_ALWAYS_INLINE inline void copy_from(double const* ptr, vector_aligned_tag) {
+    m_value = _mm256_load_pd(ptr);
+  }
+  SIMD_ALWAYS_INLINE inline void copy_to(double* ptr, vector_aligned_tag) const {
+    _mm256_store_pd(ptr, m_value);
+  }
+  SIMD_ALWAYS_INLINE inline void copy_to(double* ptr, nontemporal_tag) const {
+    _mm256_stream_pd(ptr, m_value);
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline void copy_from(double const* ptr, mask_type const& mask, Flags /*flags*/) {
+    m_value = _mm256_mask_loadu_pd(m_value, mask.get(), ptr);
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline void copy_to(double* ptr, mask_type const& mask, Flags /*flags*/) const {
+    _mm256_mask_storeu_pd(ptr, mask.get(), m_value);
+  }
+  template <std::size_t N>
+  SIMD_ALWAYS_INLINE inline void copy_from(double const* ptr, overaligned_tag<N>) {
+    copy_from(ptr, impl::overaligned_as<N, alignof(simd)>());
+  }
+  template <std::size_t N>
+  SIMD_ALWAYS_INLINE inline void copy_to(double* ptr, overaligned_tag<N>) const {
+    copy_to(ptr, impl::overaligned_as<N, alignof(simd)>());
+  }
+  SIMD_ALWAYS_INLINE inline constexpr __m256d get() const { return m_value; }
+  SIMD_ALWAYS_INLINE inline simd_mask<double, simd_abi::avx512_256> operator<(simd const& other) const {
+    return simd_mask<double, simd_abi::avx512_256>(_mm256_cmp_pd_mask(m_value, other.m_value, _CMP_LT_OS));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<double, simd_abi::avx512_256> operator==(simd const& other) const {
+    return simd_mask<double, simd_abi::avx512_256>(_mm256_cmp_pd_mask(m_value, other.m_value, _CMP_EQ_OQ));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<double, simd_abi::avx512_256> operator>(simd const& other) const {
+    return simd_mask<double, simd_abi::avx512_256>(_mm256_cmp_pd_mask(m_value, other.m_value, _CMP_GT_OQ));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<double, simd_abi::avx512_256> operator<=(simd const& other) const {
+    return simd_mask<double, simd_abi::avx512_256>(_mm256_cmp_pd_mask(m_value, other.m_value, _CMP_LE_OQ));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<double, simd_abi::avx512_256> operator>=(simd const& other) const {
+    return simd_mask<double, simd_abi::avx512_256>(_mm256_cmp_pd_mask(m_value, other.m_value, _CMP_GE_OQ));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<double, simd_abi::avx512_256> operator!=(simd const& other) const {
+    return simd_mask<double, simd_abi::avx512_256>(_mm256_cmp_pd_mask(m_value, other.m_value, _CMP_NEQ_UQ));
+  }
+};
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512_256> multiplysign(simd<double, simd_abi::avx512_256> const& a, simd<double, simd_abi::avx512_256> const& b) {
+  static const __m256i sign_mask = reinterpret_cast<__m256i>(simd<double, simd_abi::avx512_256>(-0.0).get());
+  return simd<double, simd_abi::avx512_256>(
+      reinterpret_cast<__m256d>(_mm256_xor_si256(
+          reinterpret_cast<__m256i>(a.get()), 
+          _mm256_and_si256(sign_mask, reinterpret_cast<__m256i>(b.get()))
+          ))
+      );
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512_256> copysign(simd<double, simd_abi::avx512_256> const& a, simd<double, simd_abi::avx512_256> const& b) {
+  static const __m256i sign_mask = reinterpret_cast<__m256i>(simd<double, simd_abi::avx512_256>(-0.0).get());
+  return simd<double, simd_abi::avx512_256>(
+      reinterpret_cast<__m256d>(_mm256_xor_si256(
+          _mm256_andnot_si256(sign_mask, reinterpret_cast<__m256i>(a.get())),
+          _mm256_and_si256(sign_mask, reinterpret_cast<__m256i>(b.get()))
+          ))
+      );
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512_256> abs(simd<double, simd_abi::avx512_256> const& a) {
+  __m256d const rhs = a.get();
+  return reinterpret_cast<__m256d>(_mm256_and_si256(_mm256_set1_epi64x(0x7FFFFFFFFFFFFFFF),
+        reinterpret_cast<__m256i>(rhs)));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512_256> sqrt(simd<double, simd_abi::avx512_256> const& a) {
+  return simd<double, simd_abi::avx512_256>(_mm256_sqrt_pd(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512_256> rcp_estimate(simd<double, simd_abi::avx512_256> const& a) {
+  return simd<double, simd_abi::avx512_256>(_mm256_rcp14_pd(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512_256> rsqrt_estimate(simd<double, simd_abi::avx512_256> const& a) {
+  return simd<double, simd_abi::avx512_256>(_mm256_rsqrt14_pd(a.get()));
+}
+
+// the 14-bit estimates have a relative error below 2^-14
+SIMD_ALWAYS_INLINE inline constexpr int reciprocal_estimate_bits(simd<double, simd_abi::avx512_256> const*) { return 14; }
+
+#ifdef __INTEL_COMPILER
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512_256> cbrt(simd<double, simd_abi::avx512_256> const& a) {
+  return simd<double, simd_abi::avx512_256>(_mm256_cbrt_pd(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512_256> exp(simd<double, simd_abi::avx512_256> const& a) {
+  return simd<double, simd_abi::avx512_256>(_mm256_exp_pd(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512_256> log(simd<double, simd_abi::avx512_256> const& a) {
+  return simd<double, simd_abi::avx512_256>(_mm256_log_pd(a.get()));
+}
+#endif
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512_256> fma(
+    simd<double, simd_abi::avx512_256> const& a,
+    simd<double, simd_abi::avx512_256> const& b,
+    simd<double, simd_abi::avx512_256> const& c) {
+  return simd<double, simd_abi::avx512_256>(_mm256_fmadd_pd(a.get(), b.get(), c.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512_256> max(
+    simd<double, simd_abi::avx512_256> const& a, simd<double, simd_abi::avx512_256> const& b) {
+  return simd<double, simd_abi::avx512_256>(_mm256_max_pd(a.get(), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512_256> min(
+    simd<double, simd_abi::avx512_256> const& a, simd<double, simd_abi::avx512_256> const& b) {
+  return simd<double, simd_abi::avx512_256>(_mm256_min_pd(a.get(), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512_256> choose(
+    simd_mask<double, simd_abi::avx512_256> const& a, simd<double, simd_abi::avx512_256> const& b, simd<double, simd_abi::avx512_256> const& c) {
+  return simd<double, simd_abi::avx512_256>(_mm256_mask_blend_pd(a.get(), c.get(), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512_256> roundeven(simd<double, simd_abi::avx512_256> const& a) {
+  return simd<double, simd_abi::avx512_256>(_mm256_roundscale_pd(a.get(), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512_256> floor(simd<double, simd_abi::avx512_256> const& a) {
+  return simd<double, simd_abi::avx512_256>(_mm256_roundscale_pd(a.get(), _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512_256> ceil(simd<double, simd_abi::avx512_256> const& a) {
+  return simd<double, simd_abi::avx512_256>(_mm256_roundscale_pd(a.get(), _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512_256> trunc(simd<double, simd_abi::avx512_256> const& a) {
+  return simd<double, simd_abi::avx512_256>(_mm256_roundscale_pd(a.get(), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512_256> nearbyint(simd<double, simd_abi::avx512_256> const& a) {
+  return simd<double, simd_abi::avx512_256>(_mm256_roundscale_pd(a.get(), _MM_FROUND_CUR_DIRECTION | _MM_FROUND_NO_EXC));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512_256> pow2i(simd<double, simd_abi::avx512_256> const& n) {
+  return simd<double, simd_abi::avx512_256>(_mm256_scalef_pd(_mm256_set1_pd(1.), n.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512_256> getexp(simd<double, simd_abi::avx512_256> const& a) {
+  return simd<double, simd_abi::avx512_256>(_mm256_getexp_pd(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512_256> getmant(simd<double, simd_abi::avx512_256> const& a) {
+  return simd<double, simd_abi::avx512_256>(_mm256_getmant_pd(a.get(), _MM_MANT_NORM_1_2, _MM_MANT_SIGN_zero));
+}
+
+// getexp, getmant and scalef cover subnormals themselves
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512_256> frexp(simd<double, simd_abi::avx512_256> const& a, simd<double, simd_abi::avx512_256>* e) {
+  __mmask8 const is_finite_nonzero = _mm256_cmp_pd_mask(abs(a).get(), _mm256_set1_pd(std::numeric_limits<double>::infinity()), _CMP_LT_OQ)
+    & _mm256_cmp_pd_mask(a.get(), _mm256_setzero_pd(), _CMP_NEQ_OQ);
+  *e = simd<double, simd_abi::avx512_256>(_mm256_maskz_add_pd(is_finite_nonzero, _mm256_getexp_pd(a.get()), _mm256_set1_pd(1.)));
+  return simd<double, simd_abi::avx512_256>(_mm256_mask_getmant_pd(a.get(), is_finite_nonzero, a.get(), _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512_256> ldexp(simd<double, simd_abi::avx512_256> const& a, simd<double, simd_abi::avx512_256> const& n) {
+  return simd<double, simd_abi::avx512_256>(_mm256_scalef_pd(a.get(), n.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512_256> logb(simd<double, simd_abi::avx512_256> const& a) {
+  return simd<double, simd_abi::avx512_256>(_mm256_getexp_pd(a.get()));
+}
+
+
+template <>
+class simd_mask<std::int32_t, simd_abi::avx512_256> {
+  __mmask8 m_value;
+ public:
+  using value_type = bool;
+  using simd_type = simd<std::int32_t, simd_abi::avx512_256>;
+  using abi_type = simd_abi::avx512_256;
+  SIMD_ALWAYS_INLINE inline simd_mask() = default;
+  SIMD_ALWAYS_INLINE inline simd_mask(bool value)
+    :m_value(value ? 0xFF : 0x00)
+  {}
+  SIMD_ALWAYS_INLINE inline static constexpr int size() { return 8; }
+  SIMD_ALWAYS_INLINE inline constexpr simd_mask(__mmask8 const& value_in)
+    :m_value(value_in)
+  {}
+  SIMD_ALWAYS_INLINE inline constexpr __mmask8 get() const { return m_value; }
+  SIMD_ALWAYS_INLINE inline simd_mask operator||(simd_mask const& other) const {
+    return simd_mask(static_cast<__mmask8>(m_value | other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask operator&&(simd_mask const& other) const {
+    return simd_mask(static_cast<__mmask8>(m_value & other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask operator!() const {
+    return simd_mask(static_cast<__mmask8>(m_value ^ 0xFF));
+  }
+};
+
+SIMD_ALWAYS_INLINE inline bool all_of(simd_mask<std::int32_t, simd_abi::avx512_256> const& a) {
+  return a.get() == 0xFF;
+}
+
+SIMD_ALWAYS_INLINE inline bool any_of(simd_mask<std::int32_t, simd_abi::avx512_256> const& a) {
+  return a.get() != 0x00;
+}
+
+SIMD_ALWAYS_INLINE inline std::uint64_t to_bitmask(simd_mask<std::int32_t, simd_abi::avx512_256> const& a) {
+  return std::uint64_t(a.get());
+}
+
+SIMD_ALWAYS_INLINE inline simd_mask<std::int32_t, simd_abi::avx512_256> from_bitmask(std::uint64_t bits, simd_mask<std::int32_t, simd_abi::avx512_256> const*) {
+  return simd_mask<std::int32_t, simd_abi::avx512_256>(static_cast<__mmask8>(bits));
+}
+
+template <>
+class simd<std::int32_t, simd_abi::avx512_256> {
+  __m256i m_value;
+ public:
+  SIMD_ALWAYS_INLINE simd() = default;
+  using value_type = std::int32_t;
+  using abi_type = simd_abi::avx512_256;
+  using mask_type = simd_mask<std::int32_t, abi_type>;
+  using storage_type = simd_storage<std::int32_t, abi_type>;
+  SIMD_ALWAYS_INLINE inline static constexpr int size() { return 8; }
+  SIMD_ALWAYS_INLINE inline simd(std::int32_t value)
+    :m_value(_mm256_set1_epi32(value))
+  {}
+  SIMD_ALWAYS_INLINE inline simd(
+      std::int32_t a, std::int32_t b, std::int32_t c, std::int32_t d,
+      std::int32_t e, std::int32_t f, std::int32_t g, std::int32_t h)
+    :m_value(_mm256_setr_epi32(a, b, c, d, e, f, g, h))
+  {}
+  SIMD_ALWAYS_INLINE inline
+  simd(storage_type const& value) {
+    copy_from(value.data(), vector_aligned_tag());
+  }
+  SIMD_ALWAYS_INLINE inline
+  simd& operator=(storage_type const& value) {
+    copy_from(value.data(), vector_aligned_tag());
+    return *this;
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline simd(std::int32_t const* ptr, Flags flags) {
+    copy_from(ptr, flags);
+  }
+  SIMD_ALWAYS_INLINE inline simd(std::int32_t const* ptr, int stride)
+    :m_value(_mm256_i32gather_epi32(ptr, _mm256_mullo_epi32(_mm256_set1_epi32(stride), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)), 4))
+  {}
+  SIMD_ALWAYS_INLINE inline constexpr simd(__m256i const& value_in)
+    :m_value(value_in)
+  {}
+  SIMD_ALWAYS_INLINE inline simd operator*(simd const& other) const {
+    return simd(_mm256_mullo_epi32(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator/(simd const& other) const {
+    std::int32_t a[8], b[8];
+    copy_to(a, element_aligned_tag());
+    other.copy_to(b, element_aligned_tag());
+    for (int i = 0; i < 8; ++i) a[i] /= b[i];
+    return simd(a, element_aligned_tag());
+  }
+  SIMD_ALWAYS_INLINE inline simd operator+(simd const& other) const {
+    return simd(_mm256_add_epi32(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator-(simd const& other) const {
+    return simd(_mm256_sub_epi32(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator-() const {
+    return simd(_mm256_sub_epi32(_mm256_setzero_si256(), m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator&(simd const& other) const {
+    return simd(_mm256_and_si256(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator|(simd const& other) const {
+    return simd(_mm256_or_si256(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator^(simd const& other) const {
+    return simd(_mm256_xor_si256(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator~() const {
+    return simd(_mm256_xor_si256(m_value, _mm256_set1_epi32(-1)));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator<<(int shift) const {
+    return simd(_mm256_sll_epi32(m_value, _mm_cvtsi32_si128(shift)));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator>>(int shift) const {
+    return simd(_mm256_sra_epi32(m_value, _mm_cvtsi32_si128(shift)));
+  }
+  SIMD_ALWAYS_INLINE inline void copy_from(std::int32_t const* ptr, element_aligned_tag) {
+    m_value = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(ptr));
+  }
+  SIMD_ALWAYS_INLINE inline void copy_to(std::int32_t* ptr, element_aligned_tag) const {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), m_value);
+  }
+  SIMD_ALWAYS_INLINE inline void copy_from(std::int32_t const* ptr, vector_aligned_tag) {
+    m_value = _mm256_load_si256(reinterpret_cast<__m256i const*>(ptr));
+  }
+  SIMD_ALWAYS_INLINE inline void copy_to(std::int32_t* ptr, vector_aligned_tag) const {
+    _mm256_store_si256(reinterpret_cast<__m256i*>(ptr), m_value);
+  }
+  SIMD_ALWAYS_INLINE inline void copy_to(std::int32_t* ptr, nontemporal_tag) const {
+    _mm256_stream_si256(reinterpret_cast<__m256i*>(ptr), m_value);
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline void copy_from(std::int32_t const* ptr, mask_type const& mask, Flags /*flags*/) {
+    m_value = _mm256_mask_loadu_epi32(m_value, mask.get(), ptr);
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline void copy_to(std::int32_t* ptr, mask_type const& mask, Flags /*flags*/) const {
+    _mm256_mask_storeu_epi32(ptr, mask.get(), m_value);
+  }
+  template <std::size_t N>
+  SIMD_ALWAYS_INLINE inline void copy_from(std::int32_t const* ptr, overaligned_tag<N>) {
+    copy_from(ptr, impl::overaligned_as<N, alignof(simd)>());
+  }
+  template <std::size_t N>
+  SIMD_ALWAYS_INLINE inline void copy_to(std::int32_t* ptr, overaligned_tag<N>) const {
+    copy_to(ptr, impl::overaligned_as<N, alignof(simd)>());
+  }
+  SIMD_ALWAYS_INLINE inline constexpr __m256i get() const { return m_value; }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int32_t, simd_abi::avx512_256> operator<(simd const& other) const {
+    return simd_mask<std::int32_t, simd_abi::avx512_256>(_mm256_cmplt_epi32_mask(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int32_t, simd_abi::avx512_256> operator==(simd const& other) const {
+    return simd_mask<std::int32_t, simd_abi::avx512_256>(_mm256_cmpeq_epi32_mask(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int32_t, simd_abi::avx512_256> operator>(simd const& other) const {
+    return simd_mask<std::int32_t, simd_abi::avx512_256>(_mm256_cmpgt_epi32_mask(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int32_t, simd_abi::avx512_256> operator<=(simd const& other) const {
+    return simd_mask<std::int32_t, simd_abi::avx512_256>(_mm256_cmple_epi32_mask(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int32_t, simd_abi::avx512_256> operator>=(simd const& other) const {
+    return simd_mask<std::int32_t, simd_abi::avx512_256>(_mm256_cmpge_epi32_mask(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int32_t, simd_abi::avx512_256> operator!=(simd const& other) const {
+    return simd_mask<std::int32_t, simd_abi::avx512_256>(_mm256_cmpneq_epi32_mask(m_value, other.m_value));
+  }
+};
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx512_256> choose(
+    simd_mask<std::int32_t, simd_abi::avx512_256> const& a, simd<std::int32_t, simd_abi::avx512_256> const& b, simd<std::int32_t, simd_abi::avx512_256> const& c) {
+  return simd<std::int32_t, simd_abi::avx512_256>(_mm256_mask_blend_epi32(a.get(), c.get(), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx512_256> abs(simd<std::int32_t, simd_abi::avx512_256> const& a) {
+  return simd<std::int32_t, simd_abi::avx512_256>(_mm256_abs_epi32(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx512_256> max(
+    simd<std::int32_t, simd_abi::avx512_256> const& a, simd<std::int32_t, simd_abi::avx512_256> const& b) {
+  return simd<std::int32_t, simd_abi::avx512_256>(_mm256_max_epi32(a.get(), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx512_256> min(
+    simd<std::int32_t, simd_abi::avx512_256> const& a, simd<std::int32_t, simd_abi::avx512_256> const& b) {
+  return simd<std::int32_t, simd_abi::avx512_256>(_mm256_min_epi32(a.get(), b.get()));
+}
+
+// with four lanes only the low four bits of the mask are used
+template <>
+class simd_mask<std::int64_t, simd_abi::avx512_256> {
+  __mmask8 m_value;
+ public:
+  using value_type = bool;
+  using simd_type = simd<std::int64_t, simd_abi::avx512_256>;
+  using abi_type = simd_abi::avx512_256;
+  SIMD_ALWAYS_INLINE inline simd_mask() = default;
+  SIMD_ALWAYS_INLINE inline simd_mask(bool value)
+    :m_value(value ? 0x0F : 0x00)
+  {}
+  SIMD_ALWAYS_INLINE inline static constexpr int size() { return 4; }
+  SIMD_ALWAYS_INLINE inline constexpr simd_mask(__mmask8 const& value_in)
+    :m_value(value_in)
+  {}
+  SIMD_ALWAYS_INLINE inline constexpr __mmask8 get() const { return m_value; }
+  SIMD_ALWAYS_INLINE inline simd_mask operator||(simd_mask const& other) const {
+    return simd_mask(static_cast<__mmask8>(m_value | other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask operator&&(simd_mask const& other) const {
+    return simd_mask(static_cast<__mmask8>(m_value & other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask operator!() const {
+    return simd_mask(static_cast<__mmask8>(m_value ^ 0x0F));
+  }
+};
+
+SIMD_ALWAYS_INLINE inline bool all_of(simd_mask<std::int64_t, simd_abi::avx512_256> const& a) {
+  return a.get() == 0x0F;
+}
+
+SIMD_ALWAYS_INLINE inline bool any_of(simd_mask<std::int64_t, simd_abi::avx512_256> const& a) {
+  return a.get() != 0x00;
+}
+
+SIMD_ALWAYS_INLINE inline std::uint64_t to_bitmask(simd_mask<std::int64_t, simd_abi::avx512_256> const& a) {
+  return std::uint64_t(a.get());
+}
+
+SIMD_ALWAYS_INLINE inline simd_mask<std::int64_t, simd_abi::avx512_256> from_bitmask(std::uint64_t bits, simd_mask<std::int64_t, simd_abi::avx512_256> const*) {
+  return simd_mask<std::int64_t, simd_abi::avx512_256>(static_cast<__mmask8>(bits & 0x0F));
+}
+
+template <>
+class simd<std::int64_t, simd_abi::avx512_256> {
+  __m256i m_value;
+ public:
+  SIMD_ALWAYS_INLINE simd() = default;
+  using value_type = std::int64_t;
+  using abi_type = simd_abi::avx512_256;
+  using mask_type = simd_mask<std::int64_t, abi_type>;
+  using storage_type = simd_storage<std::int64_t, abi_type>;
+  SIMD_ALWAYS_INLINE inline static constexpr int size() { return 4; }
+  SIMD_ALWAYS_INLINE inline simd(std::int64_t value)
+    :m_value(_mm256_set1_epi64x(value))
+  {}
+  SIMD_ALWAYS_INLINE inline simd(
+      std::int64_t a, std::int64_t b, std::int64_t c, std::int64_t d)
+    :m_value(_mm256_setr_epi64x(a, b, c, d))
+  {}
+  SIMD_ALWAYS_INLINE inline
+  simd(storage_type const& value) {
+    copy_from(value.data(), vector_aligned_tag());
+  }
+  SIMD_ALWAYS_INLINE inline
+  simd& operator=(storage_type const& value) {
+    copy_from(value.data(), vector_aligned_tag());
+    return *this;
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline simd(std::int64_t const* ptr, Flags flags) {
+    copy_from(ptr, flags);
+  }
+  SIMD_ALWAYS_INLINE inline simd(std::int64_t const* ptr, int stride)
+    :m_value(_mm256_i32gather_epi64(reinterpret_cast<long long const*>(ptr), _mm_mullo_epi32(_mm_set1_epi32(stride), _mm_setr_epi32(0, 1, 2, 3)), 8))
+  {}
+  SIMD_ALWAYS_INLINE inline constexpr simd(__m256i const& value_in)
+    :m_value(value_in)
+  {}
+  SIMD_ALWAYS_INLINE inline simd operator*(simd const& other) const {
+#ifdef __AVX512DQ__
+    return simd(_mm256_mullo_epi64(m_value, other.m_value));
+#else
+    // lo*lo + ((hi*lo + lo*hi) << 32), the hi*hi term falls off the top
+    __m256i const cross = _mm256_add_epi64(
+        _mm256_mul_epu32(_mm256_srli_epi64(m_value, 32), other.m_value),
+        _mm256_mul_epu32(m_value, _mm256_srli_epi64(other.m_value, 32)));
+    return simd(_mm256_add_epi64(_mm256_mul_epu32(m_value, other.m_value), _mm256_slli_epi64(cross, 32)));
+#endif
+  }
+  SIMD_ALWAYS_INLINE inline simd operator/(simd const& other) const {
+    std::int64_t a[4], b[4];
+    copy_to(a, element_aligned_tag());
+    other.copy_to(b, element_aligned_tag());
+    for (int i = 0; i < 4; ++i) a[i] /= b[i];
+    return simd(a, element_aligned_tag());
+  }
+  SIMD_ALWAYS_INLINE inline simd operator+(simd const& other) const {
+    return simd(_mm256_add_epi64(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator-(simd const& other) const {
+    return simd(_mm256_sub_epi64(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator-() const {
+    return simd(_mm256_sub_epi64(_mm256_setzero_si256(), m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator&(simd const& other) const {
+    return simd(_mm256_and_si256(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator|(simd const& other) const {
+    return simd(_mm256_or_si256(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator^(simd const& other) const {
+    return simd(_mm256_xor_si256(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator~() const {
+    return simd(_mm256_xor_si256(m_value, _mm256_set1_epi64x(-1)));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator<<(int shift) const {
+    return simd(_mm256_sll_epi64(m_value, _mm_cvtsi32_si128(shift)));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator>>(int shift) const {
+    return simd(_mm256_sra_epi64(m_value, _mm_cvtsi32_si128(shift)));
+  }
+  SIMD_ALWAYS_INLINE inline void copy_from(std::int64_t const* ptr, element_aligned_tag) {
+    m_value = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(ptr));
+  }
+  SIMD_ALWAYS_INLINE inline void copy_to(std::int64_t* ptr, element_aligned_tag) const {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), m_value);
+  }
+  SIMD_ALWAYS_INLINE inline void copy_from(std::int64_t const* ptr, vector_aligned_tag) {
+    m_value = _mm256_load_si256(reinterpret_cast<__m256i const*>(ptr));
+  }
+  SIMD_ALWAYS_INLINE inline void copy_to(std::int64_t* ptr, vector_aligned_tag) const {
+    _mm256_store_si256(reinterpret_cast<__m256i*>(ptr), m_value);
+  }
+  SIMD_ALWAYS_INLINE inline void copy_to(std::int64_t* ptr, nontemporal_tag) const {
+    _mm256_stream_si256(reinterpret_cast<__m256i*>(ptr), m_value);
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline void copy_from(std::int64_t const* ptr, mask_type const& mask, Flags /*flags*/) {
+    m_value = _mm256_mask_loadu_epi64(m_value, mask.get(), ptr);
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline void copy_to(std::int64_t* ptr, mask_type const& mask, Flags /*flags*/) const {
+    _mm256_mask_storeu_epi64(ptr, mask.get(), m_value);
+  }
+  template <std::size_t N>
+  SIMD_ALWAYS_INLINE inline void copy_from(std::int64_t const* ptr, overaligned_tag<N>) {
+    copy_from(ptr, impl::overaligned_as<N, alignof(simd)>());
+  }
+  template <std::size_t N>
+  SIMD_ALWAYS_INLINE inline void copy_to(std::int64_t* ptr, overaligned_tag<N>) const {
+    copy_to(ptr, impl::overaligned_as<N, alignof(simd)>());
+  }
+  SIMD_ALWAYS_INLINE inline constexpr __m256i get() const { return m_value; }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int64_t, simd_abi::avx512_256> operator<(simd const& other) const {
+    return simd_mask<std::int64_t, simd_abi::avx512_256>(_mm256_cmplt_epi64_mask(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int64_t, simd_abi::avx512_256> operator==(simd const& other) const {
+    return simd_mask<std::int64_t, simd_abi::avx512_256>(_mm256_cmpeq_epi64_mask(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int64_t, simd_abi::avx512_256> operator>(simd const& other) const {
+    return simd_mask<std::int64_t, simd_abi::avx512_256>(_mm256_cmpgt_epi64_mask(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int64_t, simd_abi::avx512_256> operator<=(simd const& other) const {
+    return simd_mask<std::int64_t, simd_abi::avx512_256>(_mm256_cmple_epi64_mask(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int64_t, simd_abi::avx512_256> operator>=(simd const& other) const {
+    return simd_mask<std::int64_t, simd_abi::avx512_256>(_mm256_cmpge_epi64_mask(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int64_t, simd_abi::avx512_256> operator!=(simd const& other) const {
+    return simd_mask<std::int64_t, simd_abi::avx512_256>(_mm256_cmpneq_epi64_mask(m_value, other.m_value));
+  }
+};
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::avx512_256> choose(
+    simd_mask<std::int64_t, simd_abi::avx512_256> const& a, simd<std::int64_t, simd_abi::avx512_256> const& b, simd<std::int64_t, simd_abi::avx512_256> const& c) {
+  return simd<std::int64_t, simd_abi::avx512_256>(_mm256_mask_blend_epi64(a.get(), c.get(), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::avx512_256> abs(simd<std::int64_t, simd_abi::avx512_256> const& a) {
+  return simd<std::int64_t, simd_abi::avx512_256>(_mm256_abs_epi64(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::avx512_256> max(
+    simd<std::int64_t, simd_abi::avx512_256> const& a, simd<std::int64_t, simd_abi::avx512_256> const& b) {
+  return simd<std::int64_t, simd_abi::avx512_256>(_mm256_max_epi64(a.get(), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::avx512_256> min(
+    simd<std::int64_t, simd_abi::avx512_256> const& a, simd<std::int64_t, simd_abi::avx512_256> const& b) {
+  return simd<std::int64_t, simd_abi::avx512_256>(_mm256_min_epi64(a.get(), b.get()));
+}
+
+/* The first n lanes of a mask register are its low n bits. */
+
+SIMD_ALWAYS_INLINE inline simd_mask<float, simd_abi::avx512_256> first_n_mask(int n, simd<float, simd_abi::avx512_256> const*) {
+  return simd_mask<float, simd_abi::avx512_256>(static_cast<__mmask8>(n <= 0 ? 0 : n >= 8 ? 0xFF : (1u << n) - 1));
+}
+
+SIMD_ALWAYS_INLINE inline simd_mask<double, simd_abi::avx512_256> first_n_mask(int n, simd<double, simd_abi::avx512_256> const*) {
+  return simd_mask<double, simd_abi::avx512_256>(static_cast<__mmask8>(n <= 0 ? 0 : n >= 4 ? 0xF : (1u << n) - 1));
+}
+
+SIMD_ALWAYS_INLINE inline simd_mask<std::int32_t, simd_abi::avx512_256> first_n_mask(int n, simd<std::int32_t, simd_abi::avx512_256> const*) {
+  return simd_mask<std::int32_t, simd_abi::avx512_256>(static_cast<__mmask8>(n <= 0 ? 0 : n >= 8 ? 0xFF : (1u << n) - 1));
+}
+
+SIMD_ALWAYS_INLINE inline simd_mask<std::int64_t, simd_abi::avx512_256> first_n_mask(int n, simd<std::int64_t, simd_abi::avx512_256> const*) {
+  return simd_mask<std::int64_t, simd_abi::avx512_256>(static_cast<__mmask8>(n <= 0 ? 0 : n >= 4 ? 0xF : (1u << n) - 1));
+}
+
+/* Masked arithmetic with merge masking: lanes outside the mask keep a. */
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512_256> masked_plus(
+    simd_mask<float, simd_abi::avx512_256> const& mask, simd<float, simd_abi::avx512_256> const& a, simd<float, simd_abi::avx512_256> const& b) {
+  return simd<float, simd_abi::avx512_256>(_mm256_mask_add_ps(a.get(), mask.get(), a.get(), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512_256> masked_minus(
+    simd_mask<float, simd_abi::avx512_256> const& mask, simd<float, simd_abi::avx512_256> const& a, simd<float, simd_abi::avx512_256> const& b) {
+  return simd<float, simd_abi::avx512_256>(_mm256_mask_sub_ps(a.get(), mask.get(), a.get(), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512_256> masked_multiplies(
+    simd_mask<float, simd_abi::avx512_256> const& mask, simd<float, simd_abi::avx512_256> const& a, simd<float, simd_abi::avx512_256> const& b) {
+  return simd<float, simd_abi::avx512_256>(_mm256_mask_mul_ps(a.get(), mask.get(), a.get(), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512_256> masked_divides(
+    simd_mask<float, simd_abi::avx512_256> const& mask, simd<float, simd_abi::avx512_256> const& a, simd<float, simd_abi::avx512_256> const& b) {
+  return simd<float, simd_abi::avx512_256>(_mm256_mask_div_ps(a.get(), mask.get(), a.get(), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512_256> masked_plus(
+    simd_mask<double, simd_abi::avx512_256> const& mask, simd<double, simd_abi::avx512_256> const& a, simd<double, simd_abi::avx512_256> const& b) {
+  return simd<double, simd_abi::avx512_256>(_mm256_mask_add_pd(a.get(), mask.get(), a.get(), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512_256> masked_minus(
+    simd_mask<double, simd_abi::avx512_256> const& mask, simd<double, simd_abi::avx512_256> const& a, simd<double, simd_abi::avx512_256> const& b) {
+  return simd<double, simd_abi::avx512_256>(_mm256_mask_sub_pd(a.get(), mask.get(), a.get(), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512_256> masked_multiplies(
+    simd_mask<double, simd_abi::avx512_256> const& mask, simd<double, simd_abi::avx512_256> const& a, simd<double, simd_abi::avx512_256> const& b) {
+  return simd<double, simd_abi::avx512_256>(_mm256_mask_mul_pd(a.get(), mask.get(), a.get(), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512_256> masked_divides(
+    simd_mask<double, simd_abi::avx512_256> const& mask, simd<double, simd_abi::avx512_256> const& a, simd<double, simd_abi::avx512_256> const& b) {
+  return simd<double, simd_abi::avx512_256>(_mm256_mask_div_pd(a.get(), mask.get(), a.get(), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx512_256> masked_plus(
+    simd_mask<std::int32_t, simd_abi::avx512_256> const& mask, simd<std::int32_t, simd_abi::avx512_256> const& a, simd<std::int32_t, simd_abi::avx512_256> const& b) {
+  return simd<std::int32_t, simd_abi::avx512_256>(_mm256_mask_add_epi32(a.get(), mask.get(), a.get(), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx512_256> masked_minus(
+    simd_mask<std::int32_t, simd_abi::avx512_256> const& mask, simd<std::int32_t, simd_abi::avx512_256> const& a, simd<std::int32_t, simd_abi::avx512_256> const& b) {
+  return simd<std::int32_t, simd_abi::avx512_256>(_mm256_mask_sub_epi32(a.get(), mask.get(), a.get(), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx512_256> masked_multiplies(
+    simd_mask<std::int32_t, simd_abi::avx512_256> const& mask, simd<std::int32_t, simd_abi::avx512_256> const& a, simd<std::int32_t, simd_abi::avx512_256> const& b) {
+  return simd<std::int32_t, simd_abi::avx512_256>(_mm256_mask_mullo_epi32(a.get(), mask.get(), a.get(), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::avx512_256> masked_plus(
+    simd_mask<std::int64_t, simd_abi::avx512_256> const& mask, simd<std::int64_t, simd_abi::avx512_256> const& a, simd<std::int64_t, simd_abi::avx512_256> const& b) {
+  return simd<std::int64_t, simd_abi::avx512_256>(_mm256_mask_add_epi64(a.get(), mask.get(), a.get(), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::avx512_256> masked_minus(
+    simd_mask<std::int64_t, simd_abi::avx512_256> const& mask, simd<std::int64_t, simd_abi::avx512_256> const& a, simd<std::int64_t, simd_abi::avx512_256> const& b) {
+  return simd<std::int64_t, simd_abi::avx512_256>(_mm256_mask_sub_epi64(a.get(), mask.get(), a.get(), b.get()));
+}
+
+/* Gathers and scatters with one index per lane: int32_t indices for
+   float and int32_t, int64_t indices for double and int64_t.
+ */
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512_256> gather(float const* ptr, simd<std::int32_t, simd_abi::avx512_256> const& idx) {
+  return simd<float, simd_abi::avx512_256>(_mm256_i32gather_ps(ptr, idx.get(), 4));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512_256> gather(
+    float const* ptr, simd<std::int32_t, simd_abi::avx512_256> const& idx, simd_mask<float, simd_abi::avx512_256> const& mask, simd<float, simd_abi::avx512_256> const& other) {
+  return simd<float, simd_abi::avx512_256>(_mm256_mmask_i32gather_ps(other.get(), mask.get(), idx.get(), ptr, 4));
+}
+
+SIMD_ALWAYS_INLINE inline void scatter(float* ptr, simd<std::int32_t, simd_abi::avx512_256> const& idx, simd<float, simd_abi::avx512_256> const& a) {
+  _mm256_i32scatter_ps(ptr, idx.get(), a.get(), 4);
+}
+
+SIMD_ALWAYS_INLINE inline void scatter(
+    float* ptr, simd<std::int32_t, simd_abi::avx512_256> const& idx, simd<float, simd_abi::avx512_256> const& a, simd_mask<float, simd_abi::avx512_256> const& mask) {
+  _mm256_mask_i32scatter_ps(ptr, mask.get(), idx.get(), a.get(), 4);
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512_256> gather(double const* ptr, simd<std::int64_t, simd_abi::avx512_256> const& idx) {
+  return simd<double, simd_abi::avx512_256>(_mm256_i64gather_pd(ptr, idx.get(), 8));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512_256> gather(
+    double const* ptr, simd<std::int64_t, simd_abi::avx512_256> const& idx, simd_mask<double, simd_abi::avx512_256> const& mask, simd<double, simd_abi::avx512_256> const& other) {
+  return simd<double, simd_abi::avx512_256>(_mm256_mmask_i64gather_pd(other.get(), mask.get(), idx.get(), ptr, 8));
+}
+
+SIMD_ALWAYS_INLINE inline void scatter(double* ptr, simd<std::int64_t, simd_abi::avx512_256> const& idx, simd<double, simd_abi::avx512_256> const& a) {
+  _mm256_i64scatter_pd(ptr, idx.get(), a.get(), 8);
+}
+
+SIMD_ALWAYS_INLINE inline void scatter(
+    double* ptr, simd<std::int64_t, simd_abi::avx512_256> const& idx, simd<double, simd_abi::avx512_256> const& a, simd_mask<double, simd_abi::avx512_256> const& mask) {
+  _mm256_mask_i64scatter_pd(ptr, mask.get(), idx.get(), a.get(), 8);
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx512_256> gather(std::int32_t const* ptr, simd<std::int32_t, simd_abi::avx512_256> const& idx) {
+  return simd<std::int32_t, simd_abi::avx512_256>(_mm256_i32gather_epi32(ptr, idx.get(), 4));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx512_256> gather(
+    std::int32_t const* ptr, simd<std::int32_t, simd_abi::avx512_256> const& idx, simd_mask<std::int32_t, simd_abi::avx512_256> const& mask, simd<std::int32_t, simd_abi::avx512_256> const& other) {
+  return simd<std::int32_t, simd_abi::avx512_256>(_mm256_mmask_i32gather_epi32(other.get(), mask.get(), idx.get(), ptr, 4));
+}
+
+SIMD_ALWAYS_INLINE inline void scatter(std::int32_t* ptr, simd<std::int32_t, simd_abi::avx512_256> const& idx, simd<std::int32_t, simd_abi::avx512_256> const& a) {
+  _mm256_i32scatter_epi32(ptr, idx.get(), a.get(), 4);
+}
+
+SIMD_ALWAYS_INLINE inline void scatter(
+    std::int32_t* ptr, simd<std::int32_t, simd_abi::avx512_256> const& idx, simd<std::int32_t, simd_abi::avx512_256> const& a, simd_mask<std::int32_t, simd_abi::avx512_256> const& mask) {
+  _mm256_mask_i32scatter_epi32(ptr, mask.get(), idx.get(), a.get(), 4);
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::avx512_256> gather(std::int64_t const* ptr, simd<std::int64_t, simd_abi::avx512_256> const& idx) {
+  return simd<std::int64_t, simd_abi::avx512_256>(_mm256_i64gather_epi64(reinterpret_cast<long long const*>(ptr), idx.get(), 8));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::avx512_256> gather(
+    std::int64_t const* ptr, simd<std::int64_t, simd_abi::avx512_256> const& idx, simd_mask<std::int64_t, simd_abi::avx512_256> const& mask, simd<std::int64_t, simd_abi::avx512_256> const& other) {
+  return simd<std::int64_t, simd_abi::avx512_256>(_mm256_mmask_i64gather_epi64(other.get(), mask.get(), idx.get(), ptr, 8));
+}
+
+SIMD_ALWAYS_INLINE inline void scatter(std::int64_t* ptr, simd<std::int64_t, simd_abi::avx512_256> const& idx, simd<std::int64_t, simd_abi::avx512_256> const& a) {
+  _mm256_i64scatter_epi64(ptr, idx.get(), a.get(), 8);
+}
+
+SIMD_ALWAYS_INLINE inline void scatter(
+    std::int64_t* ptr, simd<std::int64_t, simd_abi::avx512_256> const& idx, simd<std::int64_t, simd_abi::avx512_256> const& a, simd_mask<std::int64_t, simd_abi::avx512_256> const& mask) {
+  _mm256_mask_i64scatter_epi64(ptr, mask.get(), idx.get(), a.get(), 8);
+}
+
+/* Horizontal sums, minima and maxima: the two halves are combined and
+   reduced as SSE registers.
+ */
+
+SIMD_ALWAYS_INLINE inline float reduce(simd<float, simd_abi::avx512_256> const& a, std::plus<>) {
+  simd<float, simd_abi::sse> const h(_mm_add_ps(_mm256_castps256_ps128(a.get()), _mm256_extractf128_ps(a.get(), 1)));
+  return reduce(h, std::plus<>());
+}
+
+SIMD_ALWAYS_INLINE inline float hmin(simd<float, simd_abi::avx512_256> const& a) {
+  simd<float, simd_abi::sse> const h(_mm_min_ps(_mm256_castps256_ps128(a.get()), _mm256_extractf128_ps(a.get(), 1)));
+  return hmin(h);
+}
+
+SIMD_ALWAYS_INLINE inline float hmax(simd<float, simd_abi::avx512_256> const& a) {
+  simd<float, simd_abi::sse> const h(_mm_max_ps(_mm256_castps256_ps128(a.get()), _mm256_extractf128_ps(a.get(), 1)));
+  return hmax(h);
+}
+
+SIMD_ALWAYS_INLINE inline double reduce(simd<double, simd_abi::avx512_256> const& a, std::plus<>) {
+  simd<double, simd_abi::sse> const h(_mm_add_pd(_mm256_castpd256_pd128(a.get()), _mm256_extractf128_pd(a.get(), 1)));
+  return reduce(h, std::plus<>());
+}
+
+SIMD_ALWAYS_INLINE inline double hmin(simd<double, simd_abi::avx512_256> const& a) {
+  simd<double, simd_abi::sse> const h(_mm_min_pd(_mm256_castpd256_pd128(a.get()), _mm256_extractf128_pd(a.get(), 1)));
+  return hmin(h);
+}
+
+SIMD_ALWAYS_INLINE inline double hmax(simd<double, simd_abi::avx512_256> const& a) {
+  simd<double, simd_abi::sse> const h(_mm_max_pd(_mm256_castpd256_pd128(a.get()), _mm256_extractf128_pd(a.get(), 1)));
+  return hmax(h);
+}
+
+/* Conversions, the building blocks of static_simd_cast and friends.
+   cvtt* truncate and cvt* round in the current rounding mode; both give
+   the lowest integer for lanes that do not fit, which the saturating
+   versions fix up with masks.
+ */
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512_256> convert(
+    simd<std::int32_t, simd_abi::avx512_256> const& a, simd<float, simd_abi::avx512_256> const*, impl::truncating_tag) {
+  return simd<float, simd_abi::avx512_256>(_mm256_cvtepi32_ps(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx512_256> convert(
+    simd<float, simd_abi::avx512_256> const& a, simd<std::int32_t, simd_abi::avx512_256> const*, impl::truncating_tag) {
+  return simd<std::int32_t, simd_abi::avx512_256>(_mm256_cvttps_epi32(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx512_256> convert(
+    simd<float, simd_abi::avx512_256> const& a, simd<std::int32_t, simd_abi::avx512_256> const*, impl::rounding_tag) {
+  return simd<std::int32_t, simd_abi::avx512_256>(_mm256_cvtps_epi32(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx512_256> convert(
+    simd<float, simd_abi::avx512_256> const& a, simd<std::int32_t, simd_abi::avx512_256> const*, impl::saturating_tag) {
+  __mmask8 const too_large = _mm256_cmp_ps_mask(a.get(), _mm256_set1_ps(2147483648.0f), _CMP_GE_OQ);
+  __mmask8 const is_number = _mm256_cmp_ps_mask(a.get(), a.get(), _CMP_ORD_Q);
+  __m256i const r = _mm256_mask_mov_epi32(_mm256_cvttps_epi32(a.get()), too_large, _mm256_set1_epi32(std::numeric_limits<std::int32_t>::max()));
+  return simd<std::int32_t, simd_abi::avx512_256>(_mm256_maskz_mov_epi32(is_number, r));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512_256> convert(
+    simd<double, simd_abi::avx512_256> const& lo, simd<double, simd_abi::avx512_256> const& hi,
+    simd<float, simd_abi::avx512_256> const*, impl::truncating_tag) {
+  return simd<float, simd_abi::avx512_256>(
+      _mm256_insertf128_ps(_mm256_castps128_ps256(_mm256_cvtpd_ps(lo.get())), _mm256_cvtpd_ps(hi.get()), 1));
+}
+
+SIMD_ALWAYS_INLINE inline void convert(
+    simd<float, simd_abi::avx512_256> const& a, simd<double, simd_abi::avx512_256>* lo, simd<double, simd_abi::avx512_256>* hi,
+    impl::truncating_tag) {
+  *lo = simd<double, simd_abi::avx512_256>(_mm256_cvtps_pd(_mm256_castps256_ps128(a.get())));
+  *hi = simd<double, simd_abi::avx512_256>(_mm256_cvtps_pd(_mm256_extractf128_ps(a.get(), 1)));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx512_256> convert(
+    simd<double, simd_abi::avx512_256> const& lo, simd<double, simd_abi::avx512_256> const& hi,
+    simd<std::int32_t, simd_abi::avx512_256> const*, impl::truncating_tag) {
+  return simd<std::int32_t, simd_abi::avx512_256>(
+      _mm256_inserti128_si256(_mm256_castsi128_si256(_mm256_cvttpd_epi32(lo.get())), _mm256_cvttpd_epi32(hi.get()), 1));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx512_256> convert(
+    simd<double, simd_abi::avx512_256> const& lo, simd<double, simd_abi::avx512_256> const& hi,
+    simd<std::int32_t, simd_abi::avx512_256> const*, impl::rounding_tag) {
+  return simd<std::int32_t, simd_abi::avx512_256>(
+      _mm256_inserti128_si256(_mm256_castsi128_si256(_mm256_cvtpd_epi32(lo.get())), _mm256_cvtpd_epi32(hi.get()), 1));
+}
+
+SIMD_ALWAYS_INLINE inline void convert(
+    simd<std::int32_t, simd_abi::avx512_256> const& a, simd<double, simd_abi::avx512_256>* lo, simd<double, simd_abi::avx512_256>* hi,
+    impl::truncating_tag) {
+  *lo = simd<double, simd_abi::avx512_256>(_mm256_cvtepi32_pd(_mm256_castsi256_si128(a.get())));
+  *hi = simd<double, simd_abi::avx512_256>(_mm256_cvtepi32_pd(_mm256_extracti128_si256(a.get(), 1)));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx512_256> convert(
+    simd<std::int64_t, simd_abi::avx512_256> const& lo, simd<std::int64_t, simd_abi::avx512_256> const& hi,
+    simd<std::int32_t, simd_abi::avx512_256> const*, impl::truncating_tag) {
+  return simd<std::int32_t, simd_abi::avx512_256>(
+      _mm256_inserti128_si256(_mm256_castsi128_si256(_mm256_cvtepi64_epi32(lo.get())), _mm256_cvtepi64_epi32(hi.get()), 1));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx512_256> convert(
+    simd<std::int64_t, simd_abi::avx512_256> const& lo, simd<std::int64_t, simd_abi::avx512_256> const& hi,
+    simd<std::int32_t, simd_abi::avx512_256> const*, impl::saturating_tag) {
+  return simd<std::int32_t, simd_abi::avx512_256>(
+      _mm256_inserti128_si256(_mm256_castsi128_si256(_mm256_cvtsepi64_epi32(lo.get())), _mm256_cvtsepi64_epi32(hi.get()), 1));
+}
+
+SIMD_ALWAYS_INLINE inline void convert(
+    simd<std::int32_t, simd_abi::avx512_256> const& a, simd<std::int64_t, simd_abi::avx512_256>* lo, simd<std::int64_t, simd_abi::avx512_256>* hi,
+    impl::truncating_tag) {
+  *lo = simd<std::int64_t, simd_abi::avx512_256>(_mm256_cvtepi32_epi64(_mm256_castsi256_si128(a.get())));
+  *hi = simd<std::int64_t, simd_abi::avx512_256>(_mm256_cvtepi32_epi64(_mm256_extracti128_si256(a.get(), 1)));
+}
+
+#ifdef __AVX512DQ__
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512_256> convert(
+    simd<std::int64_t, simd_abi::avx512_256> const& a, simd<double, simd_abi::avx512_256> const*, impl::truncating_tag) {
+  return simd<double, simd_abi::avx512_256>(_mm256_cvtepi64_pd(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::avx512_256> convert(
+    simd<double, simd_abi::avx512_256> const& a, simd<std::int64_t, simd_abi::avx512_256> const*, impl::truncating_tag) {
+  return simd<std::int64_t, simd_abi::avx512_256>(_mm256_cvttpd_epi64(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::avx512_256> convert(
+    simd<double, simd_abi::avx512_256> const& a, simd<std::int64_t, simd_abi::avx512_256> const*, impl::rounding_tag) {
+  return simd<std::int64_t, simd_abi::avx512_256>(_mm256_cvtpd_epi64(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::avx512_256> convert(
+    simd<double, simd_abi::avx512_256> const& a, simd<std::int64_t, simd_abi::avx512_256> const*, impl::saturating_tag) {
+  __mmask8 const too_large = _mm256_cmp_pd_mask(a.get(), _mm256_set1_pd(9223372036854775808.0), _CMP_GE_OQ);
+  __mmask8 const is_number = _mm256_cmp_pd_mask(a.get(), a.get(), _CMP_ORD_Q);
+  __m256i const r = _mm256_mask_mov_epi64(_mm256_cvttpd_epi64(a.get()), too_large, _mm256_set1_epi64x(std::numeric_limits<std::int64_t>::max()));
+  return simd<std::int64_t, simd_abi::avx512_256>(_mm256_maskz_mov_epi64(is_number, r));
+}
+#endif
+
+
+/* Permutations, interleaving and shift_in index into a and b together
+   with one permutexvar or permutex2var.
+ */
+
+template <int... Idx>
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512_256> permute(
+    simd<float, simd_abi::avx512_256> const& a, std::integer_sequence<int, Idx...>) {
+  return simd<float, simd_abi::avx512_256>(_mm256_permutexvar_ps(_mm256_setr_epi32(Idx...), a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512_256> interleave_lo(
+    simd<float, simd_abi::avx512_256> const& a, simd<float, simd_abi::avx512_256> const& b) {
+  return simd<float, simd_abi::avx512_256>(_mm256_permutex2var_ps(a.get(), _mm256_setr_epi32(0, 8, 1, 9, 2, 10, 3, 11), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512_256> interleave_hi(
+    simd<float, simd_abi::avx512_256> const& a, simd<float, simd_abi::avx512_256> const& b) {
+  return simd<float, simd_abi::avx512_256>(_mm256_permutex2var_ps(a.get(), _mm256_setr_epi32(4, 12, 5, 13, 6, 14, 7, 15), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512_256> shift_in(
+    simd<float, simd_abi::avx512_256> const& a, simd<float, simd_abi::avx512_256> const& b, int k) {
+  __m256i const idx = _mm256_add_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(k));
+  return simd<float, simd_abi::avx512_256>(_mm256_permutex2var_ps(a.get(), idx, b.get()));
+}
+
+template <int... Idx>
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512_256> permute(
+    simd<double, simd_abi::avx512_256> const& a, std::integer_sequence<int, Idx...>) {
+  return simd<double, simd_abi::avx512_256>(_mm256_permutexvar_pd(_mm256_setr_epi64x(Idx...), a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512_256> interleave_lo(
+    simd<double, simd_abi::avx512_256> const& a, simd<double, simd_abi::avx512_256> const& b) {
+  return simd<double, simd_abi::avx512_256>(_mm256_permutex2var_pd(a.get(), _mm256_setr_epi64x(0, 4, 1, 5), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512_256> interleave_hi(
+    simd<double, simd_abi::avx512_256> const& a, simd<double, simd_abi::avx512_256> const& b) {
+  return simd<double, simd_abi::avx512_256>(_mm256_permutex2var_pd(a.get(), _mm256_setr_epi64x(2, 6, 3, 7), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512_256> shift_in(
+    simd<double, simd_abi::avx512_256> const& a, simd<double, simd_abi::avx512_256> const& b, int k) {
+  __m256i const idx = _mm256_add_epi64(_mm256_setr_epi64x(0, 1, 2, 3), _mm256_set1_epi64x(k));
+  return simd<double, simd_abi::avx512_256>(_mm256_permutex2var_pd(a.get(), idx, b.get()));
+}
+
+template <int... Idx>
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx512_256> permute(
+    simd<std::int32_t, simd_abi::avx512_256> const& a, std::integer_sequence<int, Idx...>) {
+  return simd<std::int32_t, simd_abi::avx512_256>(_mm256_permutexvar_epi32(_mm256_setr_epi32(Idx...), a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx512_256> interleave_lo(
+    simd<std::int32_t, simd_abi::avx512_256> const& a, simd<std::int32_t, simd_abi::avx512_256> const& b) {
+  return simd<std::int32_t, simd_abi::avx512_256>(_mm256_permutex2var_epi32(a.get(), _mm256_setr_epi32(0, 8, 1, 9, 2, 10, 3, 11), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx512_256> interleave_hi(
+    simd<std::int32_t, simd_abi::avx512_256> const& a, simd<std::int32_t, simd_abi::avx512_256> const& b) {
+  return simd<std::int32_t, simd_abi::avx512_256>(_mm256_permutex2var_epi32(a.get(), _mm256_setr_epi32(4, 12, 5, 13, 6, 14, 7, 15), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx512_256> shift_in(
+    simd<std::int32_t, simd_abi::avx512_256> const& a, simd<std::int32_t, simd_abi::avx512_256> const& b, int k) {
+  __m256i const idx = _mm256_add_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(k));
+  return simd<std::int32_t, simd_abi::avx512_256>(_mm256_permutex2var_epi32(a.get(), idx, b.get()));
+}
+
+template <int... Idx>
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::avx512_256> permute(
+    simd<std::int64_t, simd_abi::avx512_256> const& a, std::integer_sequence<int, Idx...>) {
+  return simd<std::int64_t, simd_abi::avx512_256>(_mm256_permutexvar_epi64(_mm256_setr_epi64x(Idx...), a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::avx512_256> interleave_lo(
+    simd<std::int64_t, simd_abi::avx512_256> const& a, simd<std::int64_t, simd_abi::avx512_256> const& b) {
+  return simd<std::int64_t, simd_abi::avx512_256>(_mm256_permutex2var_epi64(a.get(), _mm256_setr_epi64x(0, 4, 1, 5), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::avx512_256> interleave_hi(
+    simd<std::int64_t, simd_abi::avx512_256> const& a, simd<std::int64_t, simd_abi::avx512_256> const& b) {
+  return simd<std::int64_t, simd_abi::avx512_256>(_mm256_permutex2var_epi64(a.get(), _mm256_setr_epi64x(2, 6, 3, 7), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::avx512_256> shift_in(
+    simd<std::int64_t, simd_abi::avx512_256> const& a, simd<std::int64_t, simd_abi::avx512_256> const& b, int k) {
+  __m256i const idx = _mm256_add_epi64(_mm256_setr_epi64x(0, 1, 2, 3), _mm256_set1_epi64x(k));
+  return simd<std::int64_t, simd_abi::avx512_256>(_mm256_permutex2var_epi64(a.get(), idx, b.get()));
+}
+
+/* compress_store and expand_load are the compress and expand instructions. */
+
+SIMD_ALWAYS_INLINE inline int compress_store(
+    float* ptr, simd_mask<float, simd_abi::avx512_256> const& mask, simd<float, simd_abi::avx512_256> const& a) {
+  _mm256_mask_compressstoreu_ps(ptr, mask.get(), a.get());
+  return popcount(mask);
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::avx512_256> expand_load(
+    float const* ptr, simd_mask<float, simd_abi::avx512_256> const& mask) {
+  return simd<float, simd_abi::avx512_256>(_mm256_maskz_expandloadu_ps(mask.get(), ptr));
+}
+
+SIMD_ALWAYS_INLINE inline int compress_store(
+    double* ptr, simd_mask<double, simd_abi::avx512_256> const& mask, simd<double, simd_abi::avx512_256> const& a) {
+  _mm256_mask_compressstoreu_pd(ptr, mask.get(), a.get());
+  return popcount(mask);
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::avx512_256> expand_load(
+    double const* ptr, simd_mask<double, simd_abi::avx512_256> const& mask) {
+  return simd<double, simd_abi::avx512_256>(_mm256_maskz_expandloadu_pd(mask.get(), ptr));
+}
+
+SIMD_ALWAYS_INLINE inline int compress_store(
+    std::int32_t* ptr, simd_mask<std::int32_t, simd_abi::avx512_256> const& mask, simd<std::int32_t, simd_abi::avx512_256> const& a) {
+  _mm256_mask_compressstoreu_epi32(ptr, mask.get(), a.get());
+  return popcount(mask);
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::avx512_256> expand_load(
+    std::int32_t const* ptr, simd_mask<std::int32_t, simd_abi::avx512_256> const& mask) {
+  return simd<std::int32_t, simd_abi::avx512_256>(_mm256_maskz_expandloadu_epi32(mask.get(), ptr));
+}
+
+SIMD_ALWAYS_INLINE inline int compress_store(
+    std::int64_t* ptr, simd_mask<std::int64_t, simd_abi::avx512_256> const& mask, simd<std::int64_t, simd_abi::avx512_256> const& a) {
+  _mm256_mask_compressstoreu_epi64(ptr, mask.get(), a.get());
+  return popcount(mask);
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::avx512_256> expand_load(
+    std::int64_t const* ptr, simd_mask<std::int64_t, simd_abi::avx512_256> const& mask) {
+  return simd<std::int64_t, simd_abi::avx512_256>(_mm256_maskz_expandloadu_epi64(mask.get(), ptr));
+}
+
+}
+
+#endif
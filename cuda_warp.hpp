@@ -217,6 +217,22 @@ class simd<T, simd_abi::cuda_warp<N>> {
   mask_type operator==(simd const& other) const {
     return mask_type(m_value == other.m_value);
   }
+  SIMD_CUDA_ALWAYS_INLINE SIMD_HOST_DEVICE
+  mask_type operator>(simd const& other) const {
+    return mask_type(m_value > other.m_value);
+  }
+  SIMD_CUDA_ALWAYS_INLINE SIMD_HOST_DEVICE
+  mask_type operator<=(simd const& other) const {
+    return mask_type(m_value <= other.m_value);
+  }
+  SIMD_CUDA_ALWAYS_INLINE SIMD_HOST_DEVICE
+  mask_type operator>=(simd const& other) const {
+    return mask_type(m_value >= other.m_value);
+  }
+  SIMD_CUDA_ALWAYS_INLINE SIMD_HOST_DEVICE
+  mask_type operator!=(simd const& other) const {
+    return mask_type(m_value != other.m_value);
+  }
 };
 
 template <class T, int N>
@@ -234,11 +250,172 @@ SIMD_CUDA_ALWAYS_INLINE SIMD_HOST_DEVICE simd<T, simd_abi::cuda_warp<N>> cbrt(si
   return simd<T, simd_abi::cuda_warp<N>>(std::cbrt(a.get()));
 }
 
+template <class T, int N>
+SIMD_CUDA_ALWAYS_INLINE SIMD_HOST_DEVICE simd<T, simd_abi::cuda_warp<N>> sinh(simd<T, simd_abi::cuda_warp<N>> const& a) {
+  return simd<T, simd_abi::cuda_warp<N>>(std::sinh(a.get()));
+}
+
+template <class T, int N>
+SIMD_CUDA_ALWAYS_INLINE SIMD_HOST_DEVICE simd<T, simd_abi::cuda_warp<N>> cosh(simd<T, simd_abi::cuda_warp<N>> const& a) {
+  return simd<T, simd_abi::cuda_warp<N>>(std::cosh(a.get()));
+}
+
+template <class T, int N>
+SIMD_CUDA_ALWAYS_INLINE SIMD_HOST_DEVICE simd<T, simd_abi::cuda_warp<N>> tanh(simd<T, simd_abi::cuda_warp<N>> const& a) {
+  return simd<T, simd_abi::cuda_warp<N>>(std::tanh(a.get()));
+}
+
+template <class T, int N>
+SIMD_CUDA_ALWAYS_INLINE SIMD_HOST_DEVICE simd<T, simd_abi::cuda_warp<N>> erf(simd<T, simd_abi::cuda_warp<N>> const& a) {
+  return simd<T, simd_abi::cuda_warp<N>>(std::erf(a.get()));
+}
+
+template <class T, int N>
+SIMD_CUDA_ALWAYS_INLINE SIMD_HOST_DEVICE simd<T, simd_abi::cuda_warp<N>> erfc(simd<T, simd_abi::cuda_warp<N>> const& a) {
+  return simd<T, simd_abi::cuda_warp<N>>(std::erfc(a.get()));
+}
+
+template <class T, int N>
+SIMD_CUDA_ALWAYS_INLINE SIMD_HOST_DEVICE simd<T, simd_abi::cuda_warp<N>> log2(simd<T, simd_abi::cuda_warp<N>> const& a) {
+  return simd<T, simd_abi::cuda_warp<N>>(std::log2(a.get()));
+}
+
+template <class T, int N>
+SIMD_CUDA_ALWAYS_INLINE SIMD_HOST_DEVICE simd<T, simd_abi::cuda_warp<N>> log10(simd<T, simd_abi::cuda_warp<N>> const& a) {
+  return simd<T, simd_abi::cuda_warp<N>>(std::log10(a.get()));
+}
+
+template <class T, int N>
+SIMD_CUDA_ALWAYS_INLINE SIMD_HOST_DEVICE simd<T, simd_abi::cuda_warp<N>> log1p(simd<T, simd_abi::cuda_warp<N>> const& a) {
+  return simd<T, simd_abi::cuda_warp<N>>(std::log1p(a.get()));
+}
+
+template <class T, int N>
+SIMD_CUDA_ALWAYS_INLINE SIMD_HOST_DEVICE simd<T, simd_abi::cuda_warp<N>> expm1(simd<T, simd_abi::cuda_warp<N>> const& a) {
+  return simd<T, simd_abi::cuda_warp<N>>(std::expm1(a.get()));
+}
+
+template <class T, int N>
+SIMD_CUDA_ALWAYS_INLINE SIMD_HOST_DEVICE simd<T, simd_abi::cuda_warp<N>> exp2(simd<T, simd_abi::cuda_warp<N>> const& a) {
+  return simd<T, simd_abi::cuda_warp<N>>(std::exp2(a.get()));
+}
+
+template <class T, int N>
+SIMD_CUDA_ALWAYS_INLINE SIMD_HOST_DEVICE simd<T, simd_abi::cuda_warp<N>> floor(simd<T, simd_abi::cuda_warp<N>> const& a) {
+  return simd<T, simd_abi::cuda_warp<N>>(std::floor(a.get()));
+}
+
+template <class T, int N>
+SIMD_CUDA_ALWAYS_INLINE SIMD_HOST_DEVICE simd<T, simd_abi::cuda_warp<N>> ceil(simd<T, simd_abi::cuda_warp<N>> const& a) {
+  return simd<T, simd_abi::cuda_warp<N>>(std::ceil(a.get()));
+}
+
+template <class T, int N>
+SIMD_CUDA_ALWAYS_INLINE SIMD_HOST_DEVICE simd<T, simd_abi::cuda_warp<N>> round(simd<T, simd_abi::cuda_warp<N>> const& a) {
+  return simd<T, simd_abi::cuda_warp<N>>(std::round(a.get()));
+}
+
+template <class T, int N>
+SIMD_CUDA_ALWAYS_INLINE SIMD_HOST_DEVICE simd<T, simd_abi::cuda_warp<N>> trunc(simd<T, simd_abi::cuda_warp<N>> const& a) {
+  return simd<T, simd_abi::cuda_warp<N>>(std::trunc(a.get()));
+}
+
+template <class T, int N>
+SIMD_CUDA_ALWAYS_INLINE SIMD_HOST_DEVICE simd<T, simd_abi::cuda_warp<N>> nearbyint(simd<T, simd_abi::cuda_warp<N>> const& a) {
+  return simd<T, simd_abi::cuda_warp<N>>(std::nearbyint(a.get()));
+}
+
+template <class T, int N>
+SIMD_CUDA_ALWAYS_INLINE SIMD_HOST_DEVICE simd<T, simd_abi::cuda_warp<N>> frexp(simd<T, simd_abi::cuda_warp<N>> const& a, simd<T, simd_abi::cuda_warp<N>>* e) {
+  int exponent;
+  simd<T, simd_abi::cuda_warp<N>> const result(std::frexp(a.get(), &exponent));
+  *e = simd<T, simd_abi::cuda_warp<N>>(T(exponent));
+  return result;
+}
+
+template <class T, int N>
+SIMD_CUDA_ALWAYS_INLINE SIMD_HOST_DEVICE simd<T, simd_abi::cuda_warp<N>> ldexp(simd<T, simd_abi::cuda_warp<N>> const& a, simd<T, simd_abi::cuda_warp<N>> const& n) {
+  return simd<T, simd_abi::cuda_warp<N>>(std::ldexp(a.get(), impl::ldexp_exponent(n.get())));
+}
+
+template <class T, int N>
+SIMD_CUDA_ALWAYS_INLINE SIMD_HOST_DEVICE simd<T, simd_abi::cuda_warp<N>> ilogb(simd<T, simd_abi::cuda_warp<N>> const& a) {
+  return simd<T, simd_abi::cuda_warp<N>>(T(std::ilogb(a.get())));
+}
+
+template <class T, int N>
+SIMD_CUDA_ALWAYS_INLINE SIMD_HOST_DEVICE simd<T, simd_abi::cuda_warp<N>> logb(simd<T, simd_abi::cuda_warp<N>> const& a) {
+  return simd<T, simd_abi::cuda_warp<N>>(std::logb(a.get()));
+}
+
 template <class T, int N>
 SIMD_CUDA_ALWAYS_INLINE SIMD_HOST_DEVICE simd<T, simd_abi::cuda_warp<N>> exp(simd<T, simd_abi::cuda_warp<N>> const& a) {
   return simd<T, simd_abi::cuda_warp<N>>(std::exp(a.get()));
 }
 
+template <class T, int N>
+SIMD_CUDA_ALWAYS_INLINE SIMD_HOST_DEVICE simd<T, simd_abi::cuda_warp<N>> log(simd<T, simd_abi::cuda_warp<N>> const& a) {
+  return simd<T, simd_abi::cuda_warp<N>>(std::log(a.get()));
+}
+
+template <class T, int N>
+SIMD_CUDA_ALWAYS_INLINE SIMD_HOST_DEVICE simd<T, simd_abi::cuda_warp<N>> sin(simd<T, simd_abi::cuda_warp<N>> const& a) {
+  return simd<T, simd_abi::cuda_warp<N>>(std::sin(a.get()));
+}
+
+template <class T, int N>
+SIMD_CUDA_ALWAYS_INLINE SIMD_HOST_DEVICE simd<T, simd_abi::cuda_warp<N>> cos(simd<T, simd_abi::cuda_warp<N>> const& a) {
+  return simd<T, simd_abi::cuda_warp<N>>(std::cos(a.get()));
+}
+
+template <class T, int N>
+SIMD_CUDA_ALWAYS_INLINE SIMD_HOST_DEVICE void sincos(
+    simd<T, simd_abi::cuda_warp<N>> const& a,
+    simd<T, simd_abi::cuda_warp<N>>* s,
+    simd<T, simd_abi::cuda_warp<N>>* c) {
+  *s = sin(a);
+  *c = cos(a);
+}
+
+template <class T, int N>
+SIMD_CUDA_ALWAYS_INLINE SIMD_HOST_DEVICE simd<T, simd_abi::cuda_warp<N>> atan(simd<T, simd_abi::cuda_warp<N>> const& a) {
+  return simd<T, simd_abi::cuda_warp<N>>(std::atan(a.get()));
+}
+
+template <class T, int N>
+SIMD_CUDA_ALWAYS_INLINE SIMD_HOST_DEVICE simd<T, simd_abi::cuda_warp<N>> asin(simd<T, simd_abi::cuda_warp<N>> const& a) {
+  return simd<T, simd_abi::cuda_warp<N>>(std::asin(a.get()));
+}
+
+template <class T, int N>
+SIMD_CUDA_ALWAYS_INLINE SIMD_HOST_DEVICE simd<T, simd_abi::cuda_warp<N>> acos(simd<T, simd_abi::cuda_warp<N>> const& a) {
+  return simd<T, simd_abi::cuda_warp<N>>(std::acos(a.get()));
+}
+
+template <class T, int N>
+SIMD_CUDA_ALWAYS_INLINE SIMD_HOST_DEVICE simd<T, simd_abi::cuda_warp<N>> atan2(
+    simd<T, simd_abi::cuda_warp<N>> const& a, simd<T, simd_abi::cuda_warp<N>> const& b) {
+  return simd<T, simd_abi::cuda_warp<N>>(std::atan2(a.get(), b.get()));
+}
+
+template <class T, int N>
+SIMD_CUDA_ALWAYS_INLINE SIMD_HOST_DEVICE simd<T, simd_abi::cuda_warp<N>> pow(
+    simd<T, simd_abi::cuda_warp<N>> const& a, simd<T, simd_abi::cuda_warp<N>> const& b) {
+  return simd<T, simd_abi::cuda_warp<N>>(std::pow(a.get(), b.get()));
+}
+
+template <class T, int N>
+SIMD_CUDA_ALWAYS_INLINE SIMD_HOST_DEVICE simd<T, simd_abi::cuda_warp<N>> fmod(
+    simd<T, simd_abi::cuda_warp<N>> const& a, simd<T, simd_abi::cuda_warp<N>> const& b) {
+  return simd<T, simd_abi::cuda_warp<N>>(std::fmod(a.get(), b.get()));
+}
+
+template <class T, int N>
+SIMD_CUDA_ALWAYS_INLINE SIMD_HOST_DEVICE simd<T, simd_abi::cuda_warp<N>> remainder(
+    simd<T, simd_abi::cuda_warp<N>> const& a, simd<T, simd_abi::cuda_warp<N>> const& b) {
+  return simd<T, simd_abi::cuda_warp<N>>(std::remainder(a.get(), b.get()));
+}
+
 template <class T, int N>
 SIMD_CUDA_ALWAYS_INLINE SIMD_HOST_DEVICE simd<T, simd_abi::cuda_warp<N>> fma(
     simd<T, simd_abi::cuda_warp<N>> const& a,
@@ -0,0 +1,728 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 2.0
+//              Copyright (2014) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#pragma once
+
+#include "simd_common.hpp"
+
+/* fixed_size<N> holds N lanes as N / simd<T, native>::size() native simds
+   and runs every operation on each of them in turn, so a wide logical
+   width compiles to the same instructions as the native ABI, repeated.
+   It needs the native ABI, so simd.hpp includes it once that is chosen.
+ */
+
+namespace SIMD_NAMESPACE {
+
+namespace simd_abi {
+
+template <int N>
+class fixed_size {};
+
+}
+
+template <class T, int N>
+class simd_mask<T, simd_abi::fixed_size<N>> {
+ public:
+  using native_type = simd_mask<T, simd_abi::native>;
+ private:
+  native_type m_value[N / native_type::size()];
+ public:
+  using value_type = bool;
+  using simd_type = simd<T, simd_abi::fixed_size<N>>;
+  using abi_type = simd_abi::fixed_size<N>;
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd_mask() = default;
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline static constexpr int size() { return N; }
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline static constexpr int parts() { return N / native_type::size(); }
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd_mask(bool value) {
+    for (int i = 0; i < parts(); ++i) m_value[i] = native_type(value);
+  }
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline native_type const& part(int i) const { return m_value[i]; }
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline native_type& part(int i) { return m_value[i]; }
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd_mask operator||(simd_mask const& other) const {
+    simd_mask result;
+    for (int i = 0; i < parts(); ++i) result.m_value[i] = m_value[i] || other.m_value[i];
+    return result;
+  }
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd_mask operator&&(simd_mask const& other) const {
+    simd_mask result;
+    for (int i = 0; i < parts(); ++i) result.m_value[i] = m_value[i] && other.m_value[i];
+    return result;
+  }
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd_mask operator!() const {
+    simd_mask result;
+    for (int i = 0; i < parts(); ++i) result.m_value[i] = !m_value[i];
+    return result;
+  }
+};
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline bool all_of(simd_mask<T, simd_abi::fixed_size<N>> const& a) {
+  bool result = true;
+  for (int i = 0; i < a.parts(); ++i) result = result && all_of(a.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline bool any_of(simd_mask<T, simd_abi::fixed_size<N>> const& a) {
+  bool result = false;
+  for (int i = 0; i < a.parts(); ++i) result = result || any_of(a.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline std::uint64_t to_bitmask(simd_mask<T, simd_abi::fixed_size<N>> const& a) {
+  static_assert(N <= 64, "to_bitmask needs at most 64 lanes");
+  using native_mask = simd_mask<T, simd_abi::native>;
+  std::uint64_t result = 0;
+  for (int i = 0; i < a.parts(); ++i) result |= to_bitmask(a.part(i)) << (i * native_mask::size());
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd_mask<T, simd_abi::fixed_size<N>> from_bitmask(std::uint64_t bits, simd_mask<T, simd_abi::fixed_size<N>> const*) {
+  static_assert(N <= 64, "from_bitmask needs at most 64 lanes");
+  using native_mask = simd_mask<T, simd_abi::native>;
+  simd_mask<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < result.parts(); ++i) result.part(i) = from_bitmask(bits >> (i * native_mask::size()), static_cast<native_mask const*>(nullptr));
+  return result;
+}
+
+template <class T, int N>
+class simd<T, simd_abi::fixed_size<N>> {
+ public:
+  using native_type = simd<T, simd_abi::native>;
+  static_assert(N % native_type::size() == 0, "fixed_size<N> holds a whole number of native simds");
+ private:
+  native_type m_value[N / native_type::size()];
+ public:
+  using value_type = T;
+  using abi_type = simd_abi::fixed_size<N>;
+  using mask_type = simd_mask<T, abi_type>;
+  using storage_type = simd_storage<T, abi_type>;
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd() = default;
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline static constexpr int size() { return N; }
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline static constexpr int parts() { return N / native_type::size(); }
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd(T value) {
+    for (int i = 0; i < parts(); ++i) m_value[i] = native_type(value);
+  }
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline
+  simd(storage_type const& value) {
+    copy_from(value.data(), element_aligned_tag());
+  }
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline
+  simd& operator=(storage_type const& value) {
+    copy_from(value.data(), element_aligned_tag());
+    return *this;
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd(T const* ptr, Flags flags) {
+    for (int i = 0; i < parts(); ++i) m_value[i] = native_type(ptr + i * native_type::size(), flags);
+  }
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd(T const* ptr, int stride) {
+    for (int i = 0; i < parts(); ++i) m_value[i] = native_type(ptr + i * native_type::size() * stride, stride);
+  }
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline native_type const& part(int i) const { return m_value[i]; }
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline native_type& part(int i) { return m_value[i]; }
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd operator*(simd const& other) const {
+    simd result;
+    for (int i = 0; i < parts(); ++i) result.m_value[i] = m_value[i] * other.m_value[i];
+    return result;
+  }
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd operator/(simd const& other) const {
+    simd result;
+    for (int i = 0; i < parts(); ++i) result.m_value[i] = m_value[i] / other.m_value[i];
+    return result;
+  }
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd operator+(simd const& other) const {
+    simd result;
+    for (int i = 0; i < parts(); ++i) result.m_value[i] = m_value[i] + other.m_value[i];
+    return result;
+  }
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd operator-(simd const& other) const {
+    simd result;
+    for (int i = 0; i < parts(); ++i) result.m_value[i] = m_value[i] - other.m_value[i];
+    return result;
+  }
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd operator-() const {
+    simd result;
+    for (int i = 0; i < parts(); ++i) result.m_value[i] = -m_value[i];
+    return result;
+  }
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd operator&(simd const& other) const {
+    simd result;
+    for (int i = 0; i < parts(); ++i) result.m_value[i] = m_value[i] & other.m_value[i];
+    return result;
+  }
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd operator|(simd const& other) const {
+    simd result;
+    for (int i = 0; i < parts(); ++i) result.m_value[i] = m_value[i] | other.m_value[i];
+    return result;
+  }
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd operator^(simd const& other) const {
+    simd result;
+    for (int i = 0; i < parts(); ++i) result.m_value[i] = m_value[i] ^ other.m_value[i];
+    return result;
+  }
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd operator~() const {
+    simd result;
+    for (int i = 0; i < parts(); ++i) result.m_value[i] = ~m_value[i];
+    return result;
+  }
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd operator<<(int shift) const {
+    simd result;
+    for (int i = 0; i < parts(); ++i) result.m_value[i] = m_value[i] << shift;
+    return result;
+  }
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd operator>>(int shift) const {
+    simd result;
+    for (int i = 0; i < parts(); ++i) result.m_value[i] = m_value[i] >> shift;
+    return result;
+  }
+  // every part starts a whole number of native simds in, so parts keep the alignment the tag promises
+  template <class Flags>
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline void copy_from(T const* ptr, Flags flags) {
+    for (int i = 0; i < parts(); ++i) m_value[i].copy_from(ptr + i * native_type::size(), flags);
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline void copy_to(T* ptr, Flags flags) const {
+    for (int i = 0; i < parts(); ++i) m_value[i].copy_to(ptr + i * native_type::size(), flags);
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline void copy_from(T const* ptr, mask_type const& mask, Flags flags) {
+    for (int i = 0; i < parts(); ++i) m_value[i].copy_from(ptr + i * native_type::size(), mask.part(i), flags);
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline void copy_to(T* ptr, mask_type const& mask, Flags flags) const {
+    for (int i = 0; i < parts(); ++i) m_value[i].copy_to(ptr + i * native_type::size(), mask.part(i), flags);
+  }
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline mask_type operator<(simd const& other) const {
+    mask_type result;
+    for (int i = 0; i < parts(); ++i) result.part(i) = m_value[i] < other.m_value[i];
+    return result;
+  }
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline mask_type operator==(simd const& other) const {
+    mask_type result;
+    for (int i = 0; i < parts(); ++i) result.part(i) = m_value[i] == other.m_value[i];
+    return result;
+  }
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline mask_type operator>(simd const& other) const {
+    mask_type result;
+    for (int i = 0; i < parts(); ++i) result.part(i) = m_value[i] > other.m_value[i];
+    return result;
+  }
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline mask_type operator<=(simd const& other) const {
+    mask_type result;
+    for (int i = 0; i < parts(); ++i) result.part(i) = m_value[i] <= other.m_value[i];
+    return result;
+  }
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline mask_type operator>=(simd const& other) const {
+    mask_type result;
+    for (int i = 0; i < parts(); ++i) result.part(i) = m_value[i] >= other.m_value[i];
+    return result;
+  }
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline mask_type operator!=(simd const& other) const {
+    mask_type result;
+    for (int i = 0; i < parts(); ++i) result.part(i) = m_value[i] != other.m_value[i];
+    return result;
+  }
+};
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> choose(
+    simd_mask<T, simd_abi::fixed_size<N>> const& a, simd<T, simd_abi::fixed_size<N>> const& b, simd<T, simd_abi::fixed_size<N>> const& c) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = choose(a.part(i), b.part(i), c.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> abs(simd<T, simd_abi::fixed_size<N>> const& a) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = abs(a.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> max(
+    simd<T, simd_abi::fixed_size<N>> const& a, simd<T, simd_abi::fixed_size<N>> const& b) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = max(a.part(i), b.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> min(
+    simd<T, simd_abi::fixed_size<N>> const& a, simd<T, simd_abi::fixed_size<N>> const& b) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = min(a.part(i), b.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> copysign(
+    simd<T, simd_abi::fixed_size<N>> const& a, simd<T, simd_abi::fixed_size<N>> const& b) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = copysign(a.part(i), b.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> multiplysign(
+    simd<T, simd_abi::fixed_size<N>> const& a, simd<T, simd_abi::fixed_size<N>> const& b) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = multiplysign(a.part(i), b.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> fma(
+    simd<T, simd_abi::fixed_size<N>> const& a, simd<T, simd_abi::fixed_size<N>> const& b, simd<T, simd_abi::fixed_size<N>> const& c) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = fma(a.part(i), b.part(i), c.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> sqrt(simd<T, simd_abi::fixed_size<N>> const& a) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = sqrt(a.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> cbrt(simd<T, simd_abi::fixed_size<N>> const& a) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = cbrt(a.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> roundeven(simd<T, simd_abi::fixed_size<N>> const& a) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = roundeven(a.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> floor(simd<T, simd_abi::fixed_size<N>> const& a) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = floor(a.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> ceil(simd<T, simd_abi::fixed_size<N>> const& a) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = ceil(a.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> round(simd<T, simd_abi::fixed_size<N>> const& a) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = round(a.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> trunc(simd<T, simd_abi::fixed_size<N>> const& a) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = trunc(a.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> nearbyint(simd<T, simd_abi::fixed_size<N>> const& a) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = nearbyint(a.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> pow2i(simd<T, simd_abi::fixed_size<N>> const& a) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = pow2i(a.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> getexp(simd<T, simd_abi::fixed_size<N>> const& a) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = getexp(a.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> getmant(simd<T, simd_abi::fixed_size<N>> const& a) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = getmant(a.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> rcp_estimate(simd<T, simd_abi::fixed_size<N>> const& a) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = rcp_estimate(a.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> rsqrt_estimate(simd<T, simd_abi::fixed_size<N>> const& a) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = rsqrt_estimate(a.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline constexpr int reciprocal_estimate_bits(simd<T, simd_abi::fixed_size<N>> const*) {
+  return reciprocal_estimate_bits(static_cast<simd<T, simd_abi::native> const*>(nullptr));
+}
+
+// the parts are folded in the same order as the lanes of one simd, then the native simd is reduced
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline T reduce(simd<T, simd_abi::fixed_size<N>> const& a, std::plus<>) {
+  simd<T, simd_abi::fixed_size<N>> t = a;
+  for (int n = a.parts(); n > 1; n = (n + 1) / 2) {
+    for (int i = 0; i < n / 2; ++i) t.part(i) = t.part(i) + t.part(i + (n + 1) / 2);
+  }
+  return reduce(t.part(0), std::plus<>());
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline T hmin(simd<T, simd_abi::fixed_size<N>> const& a) {
+  simd<T, simd_abi::fixed_size<N>> t = a;
+  for (int n = a.parts(); n > 1; n = (n + 1) / 2) {
+    for (int i = 0; i < n / 2; ++i) t.part(i) = min(t.part(i), t.part(i + (n + 1) / 2));
+  }
+  return hmin(t.part(0));
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline T hmax(simd<T, simd_abi::fixed_size<N>> const& a) {
+  simd<T, simd_abi::fixed_size<N>> t = a;
+  for (int n = a.parts(); n > 1; n = (n + 1) / 2) {
+    for (int i = 0; i < n / 2; ++i) t.part(i) = max(t.part(i), t.part(i + (n + 1) / 2));
+  }
+  return hmax(t.part(0));
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> masked_plus(
+    simd_mask<T, simd_abi::fixed_size<N>> const& mask, simd<T, simd_abi::fixed_size<N>> const& a, simd<T, simd_abi::fixed_size<N>> const& b) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = masked_plus(mask.part(i), a.part(i), b.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> masked_minus(
+    simd_mask<T, simd_abi::fixed_size<N>> const& mask, simd<T, simd_abi::fixed_size<N>> const& a, simd<T, simd_abi::fixed_size<N>> const& b) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = masked_minus(mask.part(i), a.part(i), b.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> masked_multiplies(
+    simd_mask<T, simd_abi::fixed_size<N>> const& mask, simd<T, simd_abi::fixed_size<N>> const& a, simd<T, simd_abi::fixed_size<N>> const& b) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = masked_multiplies(mask.part(i), a.part(i), b.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> masked_divides(
+    simd_mask<T, simd_abi::fixed_size<N>> const& mask, simd<T, simd_abi::fixed_size<N>> const& a, simd<T, simd_abi::fixed_size<N>> const& b) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = masked_divides(mask.part(i), a.part(i), b.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd_mask<T, simd_abi::fixed_size<N>> first_n_mask(int n, simd<T, simd_abi::fixed_size<N>> const*) {
+  using native_type = simd<T, simd_abi::native>;
+  simd_mask<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < result.parts(); ++i) result.part(i) = first_n_mask(n - i * native_type::size(), static_cast<native_type const*>(nullptr));
+  return result;
+}
+
+// the parts are scanned on their own and the running total carried from one to the next
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> inclusive_scan(simd<T, simd_abi::fixed_size<N>> const& a) {
+  using native_type = simd<T, simd_abi::native>;
+  simd<T, simd_abi::fixed_size<N>> result;
+  native_type carry(T(0));
+  for (int i = 0; i < a.parts(); ++i) {
+    result.part(i) = inclusive_scan(a.part(i)) + carry;
+    carry = broadcast_lane<native_type::size() - 1>(result.part(i));
+  }
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> exclusive_scan(simd<T, simd_abi::fixed_size<N>> const& a) {
+  using native_type = simd<T, simd_abi::native>;
+  simd<T, simd_abi::fixed_size<N>> result;
+  native_type carry(T(0));
+  for (int i = 0; i < a.parts(); ++i) {
+    native_type const sum = inclusive_scan(a.part(i)) + carry;
+    result.part(i) = choose(first_n_mask<native_type>(1), carry, rotate<-1>(sum));
+    carry = broadcast_lane<native_type::size() - 1>(sum);
+  }
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline int compress_store(
+    T* ptr, simd_mask<T, simd_abi::fixed_size<N>> const& mask, simd<T, simd_abi::fixed_size<N>> const& a) {
+  int count = 0;
+  for (int i = 0; i < a.parts(); ++i) count += compress_store(ptr + count, mask.part(i), a.part(i));
+  return count;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> expand_load(
+    T const* ptr, simd_mask<T, simd_abi::fixed_size<N>> const& mask) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  int count = 0;
+  for (int i = 0; i < result.parts(); ++i) {
+    result.part(i) = expand_load(ptr + count, mask.part(i));
+    count += popcount(mask.part(i));
+  }
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> exp(simd<T, simd_abi::fixed_size<N>> const& a) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = exp(a.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> log(simd<T, simd_abi::fixed_size<N>> const& a) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = log(a.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> sin(simd<T, simd_abi::fixed_size<N>> const& a) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = sin(a.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> cos(simd<T, simd_abi::fixed_size<N>> const& a) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = cos(a.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline void sincos(simd<T, simd_abi::fixed_size<N>> const& a, simd<T, simd_abi::fixed_size<N>>* s, simd<T, simd_abi::fixed_size<N>>* c) {
+  for (int i = 0; i < a.parts(); ++i) sincos(a.part(i), &s->part(i), &c->part(i));
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> atan(simd<T, simd_abi::fixed_size<N>> const& a) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = atan(a.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> asin(simd<T, simd_abi::fixed_size<N>> const& a) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = asin(a.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> acos(simd<T, simd_abi::fixed_size<N>> const& a) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = acos(a.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> atan2(
+    simd<T, simd_abi::fixed_size<N>> const& a, simd<T, simd_abi::fixed_size<N>> const& b) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = atan2(a.part(i), b.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> pow(
+    simd<T, simd_abi::fixed_size<N>> const& a, simd<T, simd_abi::fixed_size<N>> const& b) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = pow(a.part(i), b.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> sinh(simd<T, simd_abi::fixed_size<N>> const& a) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = sinh(a.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> cosh(simd<T, simd_abi::fixed_size<N>> const& a) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = cosh(a.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> tanh(simd<T, simd_abi::fixed_size<N>> const& a) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = tanh(a.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> erf(simd<T, simd_abi::fixed_size<N>> const& a) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = erf(a.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> erfc(simd<T, simd_abi::fixed_size<N>> const& a) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = erfc(a.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> log2(simd<T, simd_abi::fixed_size<N>> const& a) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = log2(a.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> log10(simd<T, simd_abi::fixed_size<N>> const& a) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = log10(a.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> log1p(simd<T, simd_abi::fixed_size<N>> const& a) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = log1p(a.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> expm1(simd<T, simd_abi::fixed_size<N>> const& a) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = expm1(a.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> exp2(simd<T, simd_abi::fixed_size<N>> const& a) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = exp2(a.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> fmod(
+    simd<T, simd_abi::fixed_size<N>> const& a, simd<T, simd_abi::fixed_size<N>> const& b) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = fmod(a.part(i), b.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> remainder(
+    simd<T, simd_abi::fixed_size<N>> const& a, simd<T, simd_abi::fixed_size<N>> const& b) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = remainder(a.part(i), b.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> frexp(simd<T, simd_abi::fixed_size<N>> const& a, simd<T, simd_abi::fixed_size<N>>* e) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = frexp(a.part(i), &e->part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> ldexp(
+    simd<T, simd_abi::fixed_size<N>> const& a, simd<T, simd_abi::fixed_size<N>> const& b) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = ldexp(a.part(i), b.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> scalbn(
+    simd<T, simd_abi::fixed_size<N>> const& a, simd<T, simd_abi::fixed_size<N>> const& b) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = scalbn(a.part(i), b.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> ilogb(simd<T, simd_abi::fixed_size<N>> const& a) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = ilogb(a.part(i));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::fixed_size<N>> logb(simd<T, simd_abi::fixed_size<N>> const& a) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  for (int i = 0; i < a.parts(); ++i) result.part(i) = logb(a.part(i));
+  return result;
+}
+
+}
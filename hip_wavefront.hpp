@@ -214,6 +214,22 @@ class simd<T, simd_abi::hip_wavefront<N>> {
   mask_type operator==(simd const& other) const {
     return mask_type(m_value == other.m_value);
   }
+  SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE
+  mask_type operator>(simd const& other) const {
+    return mask_type(m_value > other.m_value);
+  }
+  SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE
+  mask_type operator<=(simd const& other) const {
+    return mask_type(m_value <= other.m_value);
+  }
+  SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE
+  mask_type operator>=(simd const& other) const {
+    return mask_type(m_value >= other.m_value);
+  }
+  SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE
+  mask_type operator!=(simd const& other) const {
+    return mask_type(m_value != other.m_value);
+  }
 };
 
   // ABS
@@ -249,6 +265,217 @@ SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<double, simd_abi::hip_wavefront<N>> cbrt
   return simd<double, simd_abi::hip_wavefront<N>>(::cbrt(a.get()));
 }
 
+  // SINH
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<float, simd_abi::hip_wavefront<N>> sinh(simd<float, simd_abi::hip_wavefront<N>> const& a) {
+  return simd<float, simd_abi::hip_wavefront<N>>(::sinhf(a.get()));
+}
+
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<double, simd_abi::hip_wavefront<N>> sinh(simd<double, simd_abi::hip_wavefront<N>> const& a) {
+  return simd<double, simd_abi::hip_wavefront<N>>(::sinh(a.get()));
+}
+
+  // COSH
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<float, simd_abi::hip_wavefront<N>> cosh(simd<float, simd_abi::hip_wavefront<N>> const& a) {
+  return simd<float, simd_abi::hip_wavefront<N>>(::coshf(a.get()));
+}
+
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<double, simd_abi::hip_wavefront<N>> cosh(simd<double, simd_abi::hip_wavefront<N>> const& a) {
+  return simd<double, simd_abi::hip_wavefront<N>>(::cosh(a.get()));
+}
+
+  // TANH
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<float, simd_abi::hip_wavefront<N>> tanh(simd<float, simd_abi::hip_wavefront<N>> const& a) {
+  return simd<float, simd_abi::hip_wavefront<N>>(::tanhf(a.get()));
+}
+
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<double, simd_abi::hip_wavefront<N>> tanh(simd<double, simd_abi::hip_wavefront<N>> const& a) {
+  return simd<double, simd_abi::hip_wavefront<N>>(::tanh(a.get()));
+}
+
+  // ERF
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<float, simd_abi::hip_wavefront<N>> erf(simd<float, simd_abi::hip_wavefront<N>> const& a) {
+  return simd<float, simd_abi::hip_wavefront<N>>(::erff(a.get()));
+}
+
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<double, simd_abi::hip_wavefront<N>> erf(simd<double, simd_abi::hip_wavefront<N>> const& a) {
+  return simd<double, simd_abi::hip_wavefront<N>>(::erf(a.get()));
+}
+
+  // ERFC
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<float, simd_abi::hip_wavefront<N>> erfc(simd<float, simd_abi::hip_wavefront<N>> const& a) {
+  return simd<float, simd_abi::hip_wavefront<N>>(::erfcf(a.get()));
+}
+
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<double, simd_abi::hip_wavefront<N>> erfc(simd<double, simd_abi::hip_wavefront<N>> const& a) {
+  return simd<double, simd_abi::hip_wavefront<N>>(::erfc(a.get()));
+}
+
+  // LOG2
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<float, simd_abi::hip_wavefront<N>> log2(simd<float, simd_abi::hip_wavefront<N>> const& a) {
+  return simd<float, simd_abi::hip_wavefront<N>>(::log2f(a.get()));
+}
+
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<double, simd_abi::hip_wavefront<N>> log2(simd<double, simd_abi::hip_wavefront<N>> const& a) {
+  return simd<double, simd_abi::hip_wavefront<N>>(::log2(a.get()));
+}
+
+  // LOG10
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<float, simd_abi::hip_wavefront<N>> log10(simd<float, simd_abi::hip_wavefront<N>> const& a) {
+  return simd<float, simd_abi::hip_wavefront<N>>(::log10f(a.get()));
+}
+
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<double, simd_abi::hip_wavefront<N>> log10(simd<double, simd_abi::hip_wavefront<N>> const& a) {
+  return simd<double, simd_abi::hip_wavefront<N>>(::log10(a.get()));
+}
+
+  // LOG1P
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<float, simd_abi::hip_wavefront<N>> log1p(simd<float, simd_abi::hip_wavefront<N>> const& a) {
+  return simd<float, simd_abi::hip_wavefront<N>>(::log1pf(a.get()));
+}
+
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<double, simd_abi::hip_wavefront<N>> log1p(simd<double, simd_abi::hip_wavefront<N>> const& a) {
+  return simd<double, simd_abi::hip_wavefront<N>>(::log1p(a.get()));
+}
+
+  // EXPM1
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<float, simd_abi::hip_wavefront<N>> expm1(simd<float, simd_abi::hip_wavefront<N>> const& a) {
+  return simd<float, simd_abi::hip_wavefront<N>>(::expm1f(a.get()));
+}
+
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<double, simd_abi::hip_wavefront<N>> expm1(simd<double, simd_abi::hip_wavefront<N>> const& a) {
+  return simd<double, simd_abi::hip_wavefront<N>>(::expm1(a.get()));
+}
+
+  // EXP2
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<float, simd_abi::hip_wavefront<N>> exp2(simd<float, simd_abi::hip_wavefront<N>> const& a) {
+  return simd<float, simd_abi::hip_wavefront<N>>(::exp2f(a.get()));
+}
+
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<double, simd_abi::hip_wavefront<N>> exp2(simd<double, simd_abi::hip_wavefront<N>> const& a) {
+  return simd<double, simd_abi::hip_wavefront<N>>(::exp2(a.get()));
+}
+
+  // FLOOR
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<float, simd_abi::hip_wavefront<N>> floor(simd<float, simd_abi::hip_wavefront<N>> const& a) {
+  return simd<float, simd_abi::hip_wavefront<N>>(::floorf(a.get()));
+}
+
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<double, simd_abi::hip_wavefront<N>> floor(simd<double, simd_abi::hip_wavefront<N>> const& a) {
+  return simd<double, simd_abi::hip_wavefront<N>>(::floor(a.get()));
+}
+
+  // CEIL
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<float, simd_abi::hip_wavefront<N>> ceil(simd<float, simd_abi::hip_wavefront<N>> const& a) {
+  return simd<float, simd_abi::hip_wavefront<N>>(::ceilf(a.get()));
+}
+
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<double, simd_abi::hip_wavefront<N>> ceil(simd<double, simd_abi::hip_wavefront<N>> const& a) {
+  return simd<double, simd_abi::hip_wavefront<N>>(::ceil(a.get()));
+}
+
+  // ROUND
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<float, simd_abi::hip_wavefront<N>> round(simd<float, simd_abi::hip_wavefront<N>> const& a) {
+  return simd<float, simd_abi::hip_wavefront<N>>(::roundf(a.get()));
+}
+
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<double, simd_abi::hip_wavefront<N>> round(simd<double, simd_abi::hip_wavefront<N>> const& a) {
+  return simd<double, simd_abi::hip_wavefront<N>>(::round(a.get()));
+}
+
+  // TRUNC
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<float, simd_abi::hip_wavefront<N>> trunc(simd<float, simd_abi::hip_wavefront<N>> const& a) {
+  return simd<float, simd_abi::hip_wavefront<N>>(::truncf(a.get()));
+}
+
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<double, simd_abi::hip_wavefront<N>> trunc(simd<double, simd_abi::hip_wavefront<N>> const& a) {
+  return simd<double, simd_abi::hip_wavefront<N>>(::trunc(a.get()));
+}
+
+  // NEARBYINT
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<float, simd_abi::hip_wavefront<N>> nearbyint(simd<float, simd_abi::hip_wavefront<N>> const& a) {
+  return simd<float, simd_abi::hip_wavefront<N>>(::nearbyintf(a.get()));
+}
+
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<double, simd_abi::hip_wavefront<N>> nearbyint(simd<double, simd_abi::hip_wavefront<N>> const& a) {
+  return simd<double, simd_abi::hip_wavefront<N>>(::nearbyint(a.get()));
+}
+
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<float, simd_abi::hip_wavefront<N>> frexp(simd<float, simd_abi::hip_wavefront<N>> const& a, simd<float, simd_abi::hip_wavefront<N>>* e) {
+  int exponent;
+  simd<float, simd_abi::hip_wavefront<N>> const result(::frexpf(a.get(), &exponent));
+  *e = simd<float, simd_abi::hip_wavefront<N>>(float(exponent));
+  return result;
+}
+
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<float, simd_abi::hip_wavefront<N>> ldexp(simd<float, simd_abi::hip_wavefront<N>> const& a, simd<float, simd_abi::hip_wavefront<N>> const& n) {
+  return simd<float, simd_abi::hip_wavefront<N>>(::ldexpf(a.get(), impl::ldexp_exponent(n.get())));
+}
+
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<float, simd_abi::hip_wavefront<N>> ilogb(simd<float, simd_abi::hip_wavefront<N>> const& a) {
+  return simd<float, simd_abi::hip_wavefront<N>>(float(::ilogbf(a.get())));
+}
+
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<float, simd_abi::hip_wavefront<N>> logb(simd<float, simd_abi::hip_wavefront<N>> const& a) {
+  return simd<float, simd_abi::hip_wavefront<N>>(::logbf(a.get()));
+}
+
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<double, simd_abi::hip_wavefront<N>> frexp(simd<double, simd_abi::hip_wavefront<N>> const& a, simd<double, simd_abi::hip_wavefront<N>>* e) {
+  int exponent;
+  simd<double, simd_abi::hip_wavefront<N>> const result(::frexp(a.get(), &exponent));
+  *e = simd<double, simd_abi::hip_wavefront<N>>(double(exponent));
+  return result;
+}
+
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<double, simd_abi::hip_wavefront<N>> ldexp(simd<double, simd_abi::hip_wavefront<N>> const& a, simd<double, simd_abi::hip_wavefront<N>> const& n) {
+  return simd<double, simd_abi::hip_wavefront<N>>(::ldexp(a.get(), impl::ldexp_exponent(n.get())));
+}
+
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<double, simd_abi::hip_wavefront<N>> ilogb(simd<double, simd_abi::hip_wavefront<N>> const& a) {
+  return simd<double, simd_abi::hip_wavefront<N>>(double(::ilogb(a.get())));
+}
+
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<double, simd_abi::hip_wavefront<N>> logb(simd<double, simd_abi::hip_wavefront<N>> const& a) {
+  return simd<double, simd_abi::hip_wavefront<N>>(::logb(a.get()));
+}
+
   // EXP
 template <int N>
 SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<float, simd_abi::hip_wavefront<N>> exp(simd<float, simd_abi::hip_wavefront<N>> const& a) {
@@ -261,6 +488,134 @@ SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<double, simd_abi::hip_wavefront<N>> exp(
   return simd<double, simd_abi::hip_wavefront<N>>(::exp(a.get()));
 }
 
+  // LOG
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<float, simd_abi::hip_wavefront<N>> log(simd<float, simd_abi::hip_wavefront<N>> const& a) {
+  return simd<float, simd_abi::hip_wavefront<N>>(::logf(a.get()));
+}
+
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<double, simd_abi::hip_wavefront<N>> log(simd<double, simd_abi::hip_wavefront<N>> const& a) {
+  return simd<double, simd_abi::hip_wavefront<N>>(::log(a.get()));
+}
+
+  // SIN
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<float, simd_abi::hip_wavefront<N>> sin(simd<float, simd_abi::hip_wavefront<N>> const& a) {
+  return simd<float, simd_abi::hip_wavefront<N>>(::sinf(a.get()));
+}
+
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<double, simd_abi::hip_wavefront<N>> sin(simd<double, simd_abi::hip_wavefront<N>> const& a) {
+  return simd<double, simd_abi::hip_wavefront<N>>(::sin(a.get()));
+}
+
+  // COS
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<float, simd_abi::hip_wavefront<N>> cos(simd<float, simd_abi::hip_wavefront<N>> const& a) {
+  return simd<float, simd_abi::hip_wavefront<N>>(::cosf(a.get()));
+}
+
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<double, simd_abi::hip_wavefront<N>> cos(simd<double, simd_abi::hip_wavefront<N>> const& a) {
+  return simd<double, simd_abi::hip_wavefront<N>>(::cos(a.get()));
+}
+
+  // SINCOS
+template <class T, int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE void sincos(
+    simd<T, simd_abi::hip_wavefront<N>> const& a,
+    simd<T, simd_abi::hip_wavefront<N>>* s,
+    simd<T, simd_abi::hip_wavefront<N>>* c) {
+  *s = sin(a);
+  *c = cos(a);
+}
+
+  // ATAN
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<float, simd_abi::hip_wavefront<N>> atan(simd<float, simd_abi::hip_wavefront<N>> const& a) {
+  return simd<float, simd_abi::hip_wavefront<N>>(::atanf(a.get()));
+}
+
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<double, simd_abi::hip_wavefront<N>> atan(simd<double, simd_abi::hip_wavefront<N>> const& a) {
+  return simd<double, simd_abi::hip_wavefront<N>>(::atan(a.get()));
+}
+
+  // ASIN
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<float, simd_abi::hip_wavefront<N>> asin(simd<float, simd_abi::hip_wavefront<N>> const& a) {
+  return simd<float, simd_abi::hip_wavefront<N>>(::asinf(a.get()));
+}
+
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<double, simd_abi::hip_wavefront<N>> asin(simd<double, simd_abi::hip_wavefront<N>> const& a) {
+  return simd<double, simd_abi::hip_wavefront<N>>(::asin(a.get()));
+}
+
+  // ACOS
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<float, simd_abi::hip_wavefront<N>> acos(simd<float, simd_abi::hip_wavefront<N>> const& a) {
+  return simd<float, simd_abi::hip_wavefront<N>>(::acosf(a.get()));
+}
+
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<double, simd_abi::hip_wavefront<N>> acos(simd<double, simd_abi::hip_wavefront<N>> const& a) {
+  return simd<double, simd_abi::hip_wavefront<N>>(::acos(a.get()));
+}
+
+  // ATAN2
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<float, simd_abi::hip_wavefront<N>> atan2(
+    simd<float, simd_abi::hip_wavefront<N>> const& a, simd<float, simd_abi::hip_wavefront<N>> const& b) {
+  return simd<float, simd_abi::hip_wavefront<N>>(::atan2f(a.get(), b.get()));
+}
+
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<double, simd_abi::hip_wavefront<N>> atan2(
+    simd<double, simd_abi::hip_wavefront<N>> const& a, simd<double, simd_abi::hip_wavefront<N>> const& b) {
+  return simd<double, simd_abi::hip_wavefront<N>>(::atan2(a.get(), b.get()));
+}
+
+  // POW
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<float, simd_abi::hip_wavefront<N>> pow(
+    simd<float, simd_abi::hip_wavefront<N>> const& a, simd<float, simd_abi::hip_wavefront<N>> const& b) {
+  return simd<float, simd_abi::hip_wavefront<N>>(::powf(a.get(), b.get()));
+}
+
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<double, simd_abi::hip_wavefront<N>> pow(
+    simd<double, simd_abi::hip_wavefront<N>> const& a, simd<double, simd_abi::hip_wavefront<N>> const& b) {
+  return simd<double, simd_abi::hip_wavefront<N>>(::pow(a.get(), b.get()));
+}
+
+  // FMOD
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<float, simd_abi::hip_wavefront<N>> fmod(
+    simd<float, simd_abi::hip_wavefront<N>> const& a, simd<float, simd_abi::hip_wavefront<N>> const& b) {
+  return simd<float, simd_abi::hip_wavefront<N>>(::fmodf(a.get(), b.get()));
+}
+
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<double, simd_abi::hip_wavefront<N>> fmod(
+    simd<double, simd_abi::hip_wavefront<N>> const& a, simd<double, simd_abi::hip_wavefront<N>> const& b) {
+  return simd<double, simd_abi::hip_wavefront<N>>(::fmod(a.get(), b.get()));
+}
+
+  // REMAINDER
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<float, simd_abi::hip_wavefront<N>> remainder(
+    simd<float, simd_abi::hip_wavefront<N>> const& a, simd<float, simd_abi::hip_wavefront<N>> const& b) {
+  return simd<float, simd_abi::hip_wavefront<N>>(::remainderf(a.get(), b.get()));
+}
+
+template <int N>
+SIMD_HIP_ALWAYS_INLINE SIMD_DEVICE simd<double, simd_abi::hip_wavefront<N>> remainder(
+    simd<double, simd_abi::hip_wavefront<N>> const& a, simd<double, simd_abi::hip_wavefront<N>> const& b) {
+  return simd<double, simd_abi::hip_wavefront<N>>(::remainder(a.get(), b.get()));
+}
+
 template <class T, int N>
 SIMD_HIP_ALWAYS_INLINE SIMD_HOST_DEVICE simd<T, simd_abi::hip_wavefront<N>> fma(
     simd<T, simd_abi::hip_wavefront<N>> const& a,
@@ -148,6 +148,14 @@ class simd<float, simd_abi::neon> {
   SIMD_ALWAYS_INLINE inline void copy_to(float* ptr, element_aligned_tag) const {
     vst1q_f32(ptr, m_value);
   }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline void copy_from(float const* ptr, mask_type const& mask, Flags /*flags*/) {
+    impl::masked_copy_from(this, ptr, mask);
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline void copy_to(float* ptr, mask_type const& mask, Flags /*flags*/) const {
+    impl::masked_copy_to(*this, ptr, mask);
+  }
   SIMD_ALWAYS_INLINE inline constexpr float32x4_t get() const { return m_value; }
   SIMD_ALWAYS_INLINE simd_mask<float, simd_abi::neon> operator<(simd const& other) const {
     return simd_mask<float, simd_abi::neon>(vcltq_f32(m_value, other.m_value));
@@ -155,6 +163,18 @@ class simd<float, simd_abi::neon> {
   SIMD_ALWAYS_INLINE inline simd_mask<float, simd_abi::neon> operator==(simd const& other) const {
     return simd_mask<float, simd_abi::neon>(vceqq_f32(m_value, other.m_value));
   }
+  SIMD_ALWAYS_INLINE inline simd_mask<float, simd_abi::neon> operator>(simd const& other) const {
+    return simd_mask<float, simd_abi::neon>(vcgtq_f32(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<float, simd_abi::neon> operator<=(simd const& other) const {
+    return simd_mask<float, simd_abi::neon>(vcleq_f32(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<float, simd_abi::neon> operator>=(simd const& other) const {
+    return simd_mask<float, simd_abi::neon>(vcgeq_f32(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<float, simd_abi::neon> operator!=(simd const& other) const {
+    return !(*this == other);
+  }
 };
 
 SIMD_ALWAYS_INLINE inline simd<float, simd_abi::neon> abs(simd<float, simd_abi::neon> const& a) {
@@ -165,6 +185,41 @@ SIMD_ALWAYS_INLINE inline simd<float, simd_abi::neon> sqrt(simd<float, simd_abi:
   return simd<float, simd_abi::neon>(vsqrtq_f32(a.get()));
 }
 
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::neon> roundeven(simd<float, simd_abi::neon> const& a) {
+  return simd<float, simd_abi::neon>(vrndnq_f32(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::neon> floor(simd<float, simd_abi::neon> const& a) {
+  return simd<float, simd_abi::neon>(vrndmq_f32(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::neon> ceil(simd<float, simd_abi::neon> const& a) {
+  return simd<float, simd_abi::neon>(vrndpq_f32(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::neon> trunc(simd<float, simd_abi::neon> const& a) {
+  return simd<float, simd_abi::neon>(vrndq_f32(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::neon> round(simd<float, simd_abi::neon> const& a) {
+  return simd<float, simd_abi::neon>(vrndaq_f32(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::neon> nearbyint(simd<float, simd_abi::neon> const& a) {
+  return simd<float, simd_abi::neon>(vrndiq_f32(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::neon> rcp_estimate(simd<float, simd_abi::neon> const& a) {
+  return simd<float, simd_abi::neon>(vrecpeq_f32(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::neon> rsqrt_estimate(simd<float, simd_abi::neon> const& a) {
+  return simd<float, simd_abi::neon>(vrsqrteq_f32(a.get()));
+}
+
+// vrecpe and vrsqrte are good to about 8 bits
+SIMD_ALWAYS_INLINE inline constexpr int reciprocal_estimate_bits(simd<float, simd_abi::neon> const*) { return 8; }
+
 SIMD_ALWAYS_INLINE inline simd<float, simd_abi::neon> fma(
     simd<float, simd_abi::neon> const& a,
     simd<float, simd_abi::neon> const& b,
@@ -203,7 +258,7 @@ class simd_mask<double, simd_abi::neon> {
   SIMD_ALWAYS_INLINE inline simd_mask(bool value)
     :m_value(vreinterpretq_u64_s64(vdupq_n_s64(-std::int64_t(value))))
   {}
-  SIMD_ALWAYS_INLINE inline static constexpr int size() { return 4; }
+  SIMD_ALWAYS_INLINE inline static constexpr int size() { return 2; }
   SIMD_ALWAYS_INLINE inline constexpr simd_mask(uint64x2_t const& value_in)
     :m_value(value_in)
   {}
@@ -298,6 +353,14 @@ class simd<double, simd_abi::neon> {
   SIMD_ALWAYS_INLINE inline void copy_to(double* ptr, element_aligned_tag) const {
     vst1q_f64(ptr, m_value);
   }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline void copy_from(double const* ptr, mask_type const& mask, Flags /*flags*/) {
+    impl::masked_copy_from(this, ptr, mask);
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline void copy_to(double* ptr, mask_type const& mask, Flags /*flags*/) const {
+    impl::masked_copy_to(*this, ptr, mask);
+  }
   SIMD_ALWAYS_INLINE inline constexpr float64x2_t get() const { return m_value; }
   SIMD_ALWAYS_INLINE inline simd_mask<double, simd_abi::neon> operator<(simd const& other) const {
     return simd_mask<double, simd_abi::neon>(vcltq_f64(m_value, other.m_value));
@@ -305,6 +368,18 @@ class simd<double, simd_abi::neon> {
   SIMD_ALWAYS_INLINE inline simd_mask<double, simd_abi::neon> operator==(simd const& other) const {
     return simd_mask<double, simd_abi::neon>(vceqq_f64(m_value, other.m_value));
   }
+  SIMD_ALWAYS_INLINE inline simd_mask<double, simd_abi::neon> operator>(simd const& other) const {
+    return simd_mask<double, simd_abi::neon>(vcgtq_f64(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<double, simd_abi::neon> operator<=(simd const& other) const {
+    return simd_mask<double, simd_abi::neon>(vcleq_f64(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<double, simd_abi::neon> operator>=(simd const& other) const {
+    return simd_mask<double, simd_abi::neon>(vcgeq_f64(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<double, simd_abi::neon> operator!=(simd const& other) const {
+    return !(*this == other);
+  }
 };
 
 SIMD_ALWAYS_INLINE inline simd<double, simd_abi::neon> abs(simd<double, simd_abi::neon> const& a) {
@@ -315,6 +390,41 @@ SIMD_ALWAYS_INLINE inline simd<double, simd_abi::neon> sqrt(simd<double, simd_ab
   return simd<double, simd_abi::neon>(vsqrtq_f64(a.get()));
 }
 
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::neon> roundeven(simd<double, simd_abi::neon> const& a) {
+  return simd<double, simd_abi::neon>(vrndnq_f64(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::neon> floor(simd<double, simd_abi::neon> const& a) {
+  return simd<double, simd_abi::neon>(vrndmq_f64(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::neon> ceil(simd<double, simd_abi::neon> const& a) {
+  return simd<double, simd_abi::neon>(vrndpq_f64(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::neon> trunc(simd<double, simd_abi::neon> const& a) {
+  return simd<double, simd_abi::neon>(vrndq_f64(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::neon> round(simd<double, simd_abi::neon> const& a) {
+  return simd<double, simd_abi::neon>(vrndaq_f64(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::neon> nearbyint(simd<double, simd_abi::neon> const& a) {
+  return simd<double, simd_abi::neon>(vrndiq_f64(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::neon> rcp_estimate(simd<double, simd_abi::neon> const& a) {
+  return simd<double, simd_abi::neon>(vrecpeq_f64(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::neon> rsqrt_estimate(simd<double, simd_abi::neon> const& a) {
+  return simd<double, simd_abi::neon>(vrsqrteq_f64(a.get()));
+}
+
+// vrecpe and vrsqrte are good to about 8 bits
+SIMD_ALWAYS_INLINE inline constexpr int reciprocal_estimate_bits(simd<double, simd_abi::neon> const*) { return 8; }
+
 SIMD_ALWAYS_INLINE inline simd<double, simd_abi::neon> fma(
     simd<double, simd_abi::neon> const& a,
     simd<double, simd_abi::neon> const& b,
@@ -342,6 +452,435 @@ SIMD_ALWAYS_INLINE inline simd<double, simd_abi::neon> choose(
         vreinterpretq_u64_f64(c.get()))));
 }
 
+
+template <>
+class simd_mask<std::int32_t, simd_abi::neon> {
+  uint32x4_t m_value;
+ public:
+  using value_type = bool;
+  using simd_type = simd<std::int32_t, simd_abi::neon>;
+  using abi_type = simd_abi::neon;
+  SIMD_ALWAYS_INLINE inline simd_mask() = default;
+  SIMD_ALWAYS_INLINE inline simd_mask(bool value)
+    :m_value(vreinterpretq_u32_s32(vdupq_n_s32(-int(value))))
+  {}
+  SIMD_ALWAYS_INLINE inline static constexpr int size() { return 4; }
+  SIMD_ALWAYS_INLINE inline constexpr simd_mask(uint32x4_t const& value_in)
+    :m_value(value_in)
+  {}
+  SIMD_ALWAYS_INLINE inline constexpr uint32x4_t get() const { return m_value; }
+  SIMD_ALWAYS_INLINE inline simd_mask operator||(simd_mask const& other) const {
+    return simd_mask(vorrq_u32(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask operator&&(simd_mask const& other) const {
+    return simd_mask(vandq_u32(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask operator!() const {
+    return simd_mask(vmvnq_u32(m_value));
+  }
+};
+
+SIMD_ALWAYS_INLINE inline bool all_of(simd_mask<std::int32_t, simd_abi::neon> const& a) {
+  return vminvq_u32(a.get()) == std::uint32_t(-std::int32_t(1));
+}
+
+SIMD_ALWAYS_INLINE inline bool any_of(simd_mask<std::int32_t, simd_abi::neon> const& a) {
+  return vmaxvq_u32(a.get()) == std::uint32_t(-std::int32_t(1));
+}
+
+template <>
+class simd<std::int32_t, simd_abi::neon> {
+  int32x4_t m_value;
+ public:
+  using value_type = std::int32_t;
+  using abi_type = simd_abi::neon;
+  using mask_type = simd_mask<std::int32_t, abi_type>;
+  using storage_type = simd_storage<std::int32_t, abi_type>;
+  SIMD_ALWAYS_INLINE inline simd() = default;
+  SIMD_ALWAYS_INLINE inline static constexpr int size() { return 4; }
+  SIMD_ALWAYS_INLINE inline simd(std::int32_t value)
+    :m_value(vdupq_n_s32(value))
+  {}
+  SIMD_ALWAYS_INLINE inline simd(std::int32_t a, std::int32_t b, std::int32_t c, std::int32_t d)
+    :m_value((int32x4_t){a, b, c, d})
+  {}
+  SIMD_ALWAYS_INLINE inline
+  simd(storage_type const& value) {
+    copy_from(value.data(), element_aligned_tag());
+  }
+  SIMD_ALWAYS_INLINE inline
+  simd& operator=(storage_type const& value) {
+    copy_from(value.data(), element_aligned_tag());
+    return *this;
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline simd(std::int32_t const* ptr, Flags flags) {
+    copy_from(ptr, flags);
+  }
+  SIMD_ALWAYS_INLINE inline simd(std::int32_t const* ptr, int stride)
+    :simd(ptr[0], ptr[stride], ptr[2*stride], ptr[3*stride])
+  {}
+  SIMD_ALWAYS_INLINE inline constexpr simd(int32x4_t const& value_in)
+    :m_value(value_in)
+  {}
+  SIMD_ALWAYS_INLINE inline simd operator*(simd const& other) const {
+    return simd(vmulq_s32(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator/(simd const& other) const {
+    std::int32_t a[4], b[4];
+    copy_to(a, element_aligned_tag());
+    other.copy_to(b, element_aligned_tag());
+    for (int i = 0; i < 4; ++i) a[i] /= b[i];
+    return simd(a, element_aligned_tag());
+  }
+  SIMD_ALWAYS_INLINE inline simd operator+(simd const& other) const {
+    return simd(vaddq_s32(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator-(simd const& other) const {
+    return simd(vsubq_s32(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator-() const {
+    return simd(vnegq_s32(m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator&(simd const& other) const {
+    return simd(vandq_s32(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator|(simd const& other) const {
+    return simd(vorrq_s32(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator^(simd const& other) const {
+    return simd(veorq_s32(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator~() const {
+    return simd(vmvnq_s32(m_value));
+  }
+  // vshl shifts right for negative counts, arithmetically on signed lanes
+  SIMD_ALWAYS_INLINE inline simd operator<<(int shift) const {
+    return simd(vshlq_s32(m_value, vdupq_n_s32(shift)));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator>>(int shift) const {
+    return simd(vshlq_s32(m_value, vdupq_n_s32(-shift)));
+  }
+  SIMD_ALWAYS_INLINE inline void copy_from(std::int32_t const* ptr, element_aligned_tag) {
+    m_value = vld1q_s32(ptr);
+  }
+  SIMD_ALWAYS_INLINE inline void copy_to(std::int32_t* ptr, element_aligned_tag) const {
+    vst1q_s32(ptr, m_value);
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline void copy_from(std::int32_t const* ptr, mask_type const& mask, Flags /*flags*/) {
+    impl::masked_copy_from(this, ptr, mask);
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline void copy_to(std::int32_t* ptr, mask_type const& mask, Flags /*flags*/) const {
+    impl::masked_copy_to(*this, ptr, mask);
+  }
+  SIMD_ALWAYS_INLINE inline constexpr int32x4_t get() const { return m_value; }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int32_t, simd_abi::neon> operator<(simd const& other) const {
+    return simd_mask<std::int32_t, simd_abi::neon>(vcltq_s32(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int32_t, simd_abi::neon> operator==(simd const& other) const {
+    return simd_mask<std::int32_t, simd_abi::neon>(vceqq_s32(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int32_t, simd_abi::neon> operator>(simd const& other) const {
+    return other < *this;
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int32_t, simd_abi::neon> operator<=(simd const& other) const {
+    return !(other < *this);
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int32_t, simd_abi::neon> operator>=(simd const& other) const {
+    return !(*this < other);
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int32_t, simd_abi::neon> operator!=(simd const& other) const {
+    return !(*this == other);
+  }
+};
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::neon> abs(simd<std::int32_t, simd_abi::neon> const& a) {
+  return simd<std::int32_t, simd_abi::neon>(vabsq_s32(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::neon> max(
+    simd<std::int32_t, simd_abi::neon> const& a, simd<std::int32_t, simd_abi::neon> const& b) {
+  return simd<std::int32_t, simd_abi::neon>(vmaxq_s32(a.get(), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::neon> min(
+    simd<std::int32_t, simd_abi::neon> const& a, simd<std::int32_t, simd_abi::neon> const& b) {
+  return simd<std::int32_t, simd_abi::neon>(vminq_s32(a.get(), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::neon> choose(
+    simd_mask<std::int32_t, simd_abi::neon> const& a, simd<std::int32_t, simd_abi::neon> const& b, simd<std::int32_t, simd_abi::neon> const& c) {
+  return simd<std::int32_t, simd_abi::neon>(vbslq_s32(a.get(), b.get(), c.get()));
+}
+
+template <>
+class simd_mask<std::int64_t, simd_abi::neon> {
+  uint64x2_t m_value;
+ public:
+  using value_type = bool;
+  using simd_type = simd<std::int64_t, simd_abi::neon>;
+  using abi_type = simd_abi::neon;
+  SIMD_ALWAYS_INLINE inline simd_mask() = default;
+  SIMD_ALWAYS_INLINE inline simd_mask(bool value)
+    :m_value(vreinterpretq_u64_s64(vdupq_n_s64(-std::int64_t(value))))
+  {}
+  SIMD_ALWAYS_INLINE inline static constexpr int size() { return 2; }
+  SIMD_ALWAYS_INLINE inline constexpr simd_mask(uint64x2_t const& value_in)
+    :m_value(value_in)
+  {}
+  SIMD_ALWAYS_INLINE inline constexpr uint64x2_t get() const { return m_value; }
+  SIMD_ALWAYS_INLINE inline simd_mask operator||(simd_mask const& other) const {
+    return simd_mask(vorrq_u64(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask operator&&(simd_mask const& other) const {
+    return simd_mask(vandq_u64(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask operator!() const {
+    return simd_mask(vreinterpretq_u64_u32(vmvnq_u32(vreinterpretq_u32_u64(m_value))));
+  }
+};
+
+SIMD_ALWAYS_INLINE inline bool all_of(simd_mask<std::int64_t, simd_abi::neon> const& a) {
+  return all_of(simd_mask<std::int32_t, simd_abi::neon>(vreinterpretq_u32_u64(a.get())));
+}
+
+SIMD_ALWAYS_INLINE inline bool any_of(simd_mask<std::int64_t, simd_abi::neon> const& a) {
+  return any_of(simd_mask<std::int32_t, simd_abi::neon>(vreinterpretq_u32_u64(a.get())));
+}
+
+template <>
+class simd<std::int64_t, simd_abi::neon> {
+  int64x2_t m_value;
+ public:
+  using value_type = std::int64_t;
+  using abi_type = simd_abi::neon;
+  using mask_type = simd_mask<std::int64_t, abi_type>;
+  using storage_type = simd_storage<std::int64_t, abi_type>;
+  SIMD_ALWAYS_INLINE inline simd() = default;
+  SIMD_ALWAYS_INLINE inline static constexpr int size() { return 2; }
+  SIMD_ALWAYS_INLINE inline simd(std::int64_t value)
+    :m_value(vdupq_n_s64(value))
+  {}
+  SIMD_ALWAYS_INLINE inline simd(std::int64_t a, std::int64_t b)
+    :m_value((int64x2_t){a, b})
+  {}
+  SIMD_ALWAYS_INLINE inline
+  simd(storage_type const& value) {
+    copy_from(value.data(), element_aligned_tag());
+  }
+  SIMD_ALWAYS_INLINE inline
+  simd& operator=(storage_type const& value) {
+    copy_from(value.data(), element_aligned_tag());
+    return *this;
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline simd(std::int64_t const* ptr, Flags flags) {
+    copy_from(ptr, flags);
+  }
+  SIMD_ALWAYS_INLINE inline simd(std::int64_t const* ptr, int stride)
+    :simd(ptr[0], ptr[stride])
+  {}
+  SIMD_ALWAYS_INLINE inline constexpr simd(int64x2_t const& value_in)
+    :m_value(value_in)
+  {}
+  // there is no 64-bit vector multiply
+  SIMD_ALWAYS_INLINE inline simd operator*(simd const& other) const {
+    return simd(
+        std::int64_t(std::uint64_t(vgetq_lane_s64(m_value, 0)) * std::uint64_t(vgetq_lane_s64(other.m_value, 0))),
+        std::int64_t(std::uint64_t(vgetq_lane_s64(m_value, 1)) * std::uint64_t(vgetq_lane_s64(other.m_value, 1))));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator/(simd const& other) const {
+    return simd(
+        vgetq_lane_s64(m_value, 0) / vgetq_lane_s64(other.m_value, 0),
+        vgetq_lane_s64(m_value, 1) / vgetq_lane_s64(other.m_value, 1));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator+(simd const& other) const {
+    return simd(vaddq_s64(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator-(simd const& other) const {
+    return simd(vsubq_s64(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator-() const {
+    return simd(vnegq_s64(m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator&(simd const& other) const {
+    return simd(vandq_s64(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator|(simd const& other) const {
+    return simd(vorrq_s64(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator^(simd const& other) const {
+    return simd(veorq_s64(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator~() const {
+    return simd(vreinterpretq_s64_s32(vmvnq_s32(vreinterpretq_s32_s64(m_value))));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator<<(int shift) const {
+    return simd(vshlq_s64(m_value, vdupq_n_s64(shift)));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator>>(int shift) const {
+    return simd(vshlq_s64(m_value, vdupq_n_s64(-shift)));
+  }
+  SIMD_ALWAYS_INLINE inline void copy_from(std::int64_t const* ptr, element_aligned_tag) {
+    m_value = vld1q_s64(ptr);
+  }
+  SIMD_ALWAYS_INLINE inline void copy_to(std::int64_t* ptr, element_aligned_tag) const {
+    vst1q_s64(ptr, m_value);
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline void copy_from(std::int64_t const* ptr, mask_type const& mask, Flags /*flags*/) {
+    impl::masked_copy_from(this, ptr, mask);
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline void copy_to(std::int64_t* ptr, mask_type const& mask, Flags /*flags*/) const {
+    impl::masked_copy_to(*this, ptr, mask);
+  }
+  SIMD_ALWAYS_INLINE inline constexpr int64x2_t get() const { return m_value; }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int64_t, simd_abi::neon> operator<(simd const& other) const {
+    return simd_mask<std::int64_t, simd_abi::neon>(vcltq_s64(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int64_t, simd_abi::neon> operator==(simd const& other) const {
+    return simd_mask<std::int64_t, simd_abi::neon>(vceqq_s64(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int64_t, simd_abi::neon> operator>(simd const& other) const {
+    return other < *this;
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int64_t, simd_abi::neon> operator<=(simd const& other) const {
+    return !(other < *this);
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int64_t, simd_abi::neon> operator>=(simd const& other) const {
+    return !(*this < other);
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int64_t, simd_abi::neon> operator!=(simd const& other) const {
+    return !(*this == other);
+  }
+};
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::neon> abs(simd<std::int64_t, simd_abi::neon> const& a) {
+  return simd<std::int64_t, simd_abi::neon>(vabsq_s64(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::neon> choose(
+    simd_mask<std::int64_t, simd_abi::neon> const& a, simd<std::int64_t, simd_abi::neon> const& b, simd<std::int64_t, simd_abi::neon> const& c) {
+  return simd<std::int64_t, simd_abi::neon>(vbslq_s64(a.get(), b.get(), c.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::neon> max(
+    simd<std::int64_t, simd_abi::neon> const& a, simd<std::int64_t, simd_abi::neon> const& b) {
+  return choose(b < a, a, b);
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::neon> min(
+    simd<std::int64_t, simd_abi::neon> const& a, simd<std::int64_t, simd_abi::neon> const& b) {
+  return choose(a < b, a, b);
+}
+
+
+/* Conversions, the building blocks of static_simd_cast and friends.
+   vcvtq truncates and vcvtnq rounds to nearest even, and both already
+   saturate, with NaN going to 0.  vqmovn narrows with saturation.
+ */
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::neon> convert(
+    simd<std::int32_t, simd_abi::neon> const& a, simd<float, simd_abi::neon> const*, impl::truncating_tag) {
+  return simd<float, simd_abi::neon>(vcvtq_f32_s32(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::neon> convert(
+    simd<float, simd_abi::neon> const& a, simd<std::int32_t, simd_abi::neon> const*, impl::truncating_tag) {
+  return simd<std::int32_t, simd_abi::neon>(vcvtq_s32_f32(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::neon> convert(
+    simd<float, simd_abi::neon> const& a, simd<std::int32_t, simd_abi::neon> const*, impl::rounding_tag) {
+  return simd<std::int32_t, simd_abi::neon>(vcvtnq_s32_f32(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::neon> convert(
+    simd<float, simd_abi::neon> const& a, simd<std::int32_t, simd_abi::neon> const*, impl::saturating_tag) {
+  return simd<std::int32_t, simd_abi::neon>(vcvtq_s32_f32(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::neon> convert(
+    simd<std::int64_t, simd_abi::neon> const& a, simd<double, simd_abi::neon> const*, impl::truncating_tag) {
+  return simd<double, simd_abi::neon>(vcvtq_f64_s64(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::neon> convert(
+    simd<double, simd_abi::neon> const& a, simd<std::int64_t, simd_abi::neon> const*, impl::truncating_tag) {
+  return simd<std::int64_t, simd_abi::neon>(vcvtq_s64_f64(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::neon> convert(
+    simd<double, simd_abi::neon> const& a, simd<std::int64_t, simd_abi::neon> const*, impl::rounding_tag) {
+  return simd<std::int64_t, simd_abi::neon>(vcvtnq_s64_f64(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::neon> convert(
+    simd<double, simd_abi::neon> const& a, simd<std::int64_t, simd_abi::neon> const*, impl::saturating_tag) {
+  return simd<std::int64_t, simd_abi::neon>(vcvtq_s64_f64(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::neon> convert(
+    simd<double, simd_abi::neon> const& lo, simd<double, simd_abi::neon> const& hi,
+    simd<float, simd_abi::neon> const*, impl::truncating_tag) {
+  return simd<float, simd_abi::neon>(vcvt_high_f32_f64(vcvt_f32_f64(lo.get()), hi.get()));
+}
+
+SIMD_ALWAYS_INLINE inline void convert(
+    simd<float, simd_abi::neon> const& a, simd<double, simd_abi::neon>* lo, simd<double, simd_abi::neon>* hi,
+    impl::truncating_tag) {
+  *lo = simd<double, simd_abi::neon>(vcvt_f64_f32(vget_low_f32(a.get())));
+  *hi = simd<double, simd_abi::neon>(vcvt_high_f64_f32(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::neon> convert(
+    simd<std::int64_t, simd_abi::neon> const& lo, simd<std::int64_t, simd_abi::neon> const& hi,
+    simd<std::int32_t, simd_abi::neon> const*, impl::truncating_tag) {
+  return simd<std::int32_t, simd_abi::neon>(vmovn_high_s64(vmovn_s64(lo.get()), hi.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::neon> convert(
+    simd<std::int64_t, simd_abi::neon> const& lo, simd<std::int64_t, simd_abi::neon> const& hi,
+    simd<std::int32_t, simd_abi::neon> const*, impl::saturating_tag) {
+  return simd<std::int32_t, simd_abi::neon>(vqmovn_high_s64(vqmovn_s64(lo.get()), hi.get()));
+}
+
+SIMD_ALWAYS_INLINE inline void convert(
+    simd<std::int32_t, simd_abi::neon> const& a, simd<std::int64_t, simd_abi::neon>* lo, simd<std::int64_t, simd_abi::neon>* hi,
+    impl::truncating_tag) {
+  *lo = simd<std::int64_t, simd_abi::neon>(vmovl_s32(vget_low_s32(a.get())));
+  *hi = simd<std::int64_t, simd_abi::neon>(vmovl_high_s32(a.get()));
+}
+
+// double and int32_t go through int64_t, which holds both exactly
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::neon> convert(
+    simd<double, simd_abi::neon> const& lo, simd<double, simd_abi::neon> const& hi,
+    simd<std::int32_t, simd_abi::neon> const*, impl::truncating_tag) {
+  return simd<std::int32_t, simd_abi::neon>(vmovn_high_s64(vmovn_s64(vcvtq_s64_f64(lo.get())), vcvtq_s64_f64(hi.get())));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::neon> convert(
+    simd<double, simd_abi::neon> const& lo, simd<double, simd_abi::neon> const& hi,
+    simd<std::int32_t, simd_abi::neon> const*, impl::rounding_tag) {
+  return simd<std::int32_t, simd_abi::neon>(vmovn_high_s64(vmovn_s64(vcvtnq_s64_f64(lo.get())), vcvtnq_s64_f64(hi.get())));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::neon> convert(
+    simd<double, simd_abi::neon> const& lo, simd<double, simd_abi::neon> const& hi,
+    simd<std::int32_t, simd_abi::neon> const*, impl::saturating_tag) {
+  return simd<std::int32_t, simd_abi::neon>(vqmovn_high_s64(vqmovn_s64(vcvtq_s64_f64(lo.get())), vcvtq_s64_f64(hi.get())));
+}
+
+SIMD_ALWAYS_INLINE inline void convert(
+    simd<std::int32_t, simd_abi::neon> const& a, simd<double, simd_abi::neon>* lo, simd<double, simd_abi::neon>* hi,
+    impl::truncating_tag) {
+  *lo = simd<double, simd_abi::neon>(vcvtq_f64_s64(vmovl_s32(vget_low_s32(a.get()))));
+  *hi = simd<double, simd_abi::neon>(vcvtq_f64_s64(vmovl_high_s32(a.get())));
+}
+
 }
 
 #endif
@@ -54,6 +54,38 @@ class pack;
 
 }
 
+// integer lanes keep their mask in lanes of the same type
+template <class T, int N>
+class simd_mask<T, simd_abi::pack<N>> {
+  T m_value[N];
+ public:
+  using value_type = bool;
+  using simd_type = simd<T, simd_abi::pack<N>>;
+  using abi_type = simd_abi::pack<N>;
+  SIMD_ALWAYS_INLINE inline simd_mask() = default;
+  SIMD_ALWAYS_INLINE inline static constexpr int size() { return N; }
+  SIMD_ALWAYS_INLINE inline simd_mask(bool value) {
+    SIMD_PRAGMA for (int i = 0; i < size(); ++i) m_value[i] = value;
+  }
+  SIMD_ALWAYS_INLINE inline constexpr bool operator[](int i) const { return m_value[i]; }
+  SIMD_ALWAYS_INLINE inline T& operator[](int i) { return m_value[i]; }
+  SIMD_ALWAYS_INLINE inline simd_mask operator||(simd_mask const& other) const {
+    simd_mask result;
+    SIMD_PRAGMA for (int i = 0; i < size(); ++i) result.m_value[i] = m_value[i] || other.m_value[i];
+    return result;
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask operator&&(simd_mask const& other) const {
+    simd_mask result;
+    SIMD_PRAGMA for (int i = 0; i < size(); ++i) result.m_value[i] = m_value[i] && other.m_value[i];
+    return result;
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask operator!() const {
+    simd_mask result;
+    SIMD_PRAGMA for (int i = 0; i < size(); ++i) result.m_value[i] = !m_value[i];
+    return result;
+  }
+};
+
 template <int N>
 class simd_mask<float, simd_abi::pack<N>> {
   int m_value[N];
@@ -182,12 +214,51 @@ class simd<T, simd_abi::pack<N>> {
     SIMD_PRAGMA for (int i = 0; i < size(); ++i) result[i] = -m_value[i];
     return result;
   }
+  SIMD_ALWAYS_INLINE simd operator&(simd const& other) const {
+    simd result;
+    SIMD_PRAGMA for (int i = 0; i < size(); ++i) result[i] = m_value[i] & other.m_value[i];
+    return result;
+  }
+  SIMD_ALWAYS_INLINE simd operator|(simd const& other) const {
+    simd result;
+    SIMD_PRAGMA for (int i = 0; i < size(); ++i) result[i] = m_value[i] | other.m_value[i];
+    return result;
+  }
+  SIMD_ALWAYS_INLINE simd operator^(simd const& other) const {
+    simd result;
+    SIMD_PRAGMA for (int i = 0; i < size(); ++i) result[i] = m_value[i] ^ other.m_value[i];
+    return result;
+  }
+  SIMD_ALWAYS_INLINE simd operator~() const {
+    simd result;
+    SIMD_PRAGMA for (int i = 0; i < size(); ++i) result[i] = ~m_value[i];
+    return result;
+  }
+  SIMD_ALWAYS_INLINE simd operator<<(int shift) const {
+    using unsigned_type = typename std::make_unsigned<T>::type;
+    simd result;
+    SIMD_PRAGMA for (int i = 0; i < size(); ++i) result[i] = T(unsigned_type(m_value[i]) << shift);
+    return result;
+  }
+  SIMD_ALWAYS_INLINE simd operator>>(int shift) const {
+    simd result;
+    SIMD_PRAGMA for (int i = 0; i < size(); ++i) result[i] = m_value[i] >> shift;
+    return result;
+  }
   SIMD_ALWAYS_INLINE void copy_from(T const* ptr, element_aligned_tag) {
     SIMD_PRAGMA for (int i = 0; i < size(); ++i) m_value[i] = ptr[i];
   }
   SIMD_ALWAYS_INLINE void copy_to(T* ptr, element_aligned_tag) const {
     SIMD_PRAGMA for (int i = 0; i < size(); ++i) ptr[i] = m_value[i];
   }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE void copy_from(T const* ptr, mask_type const& mask, Flags /*flags*/) {
+    for (int i = 0; i < size(); ++i) if (mask[i]) m_value[i] = ptr[i];
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE void copy_to(T* ptr, mask_type const& mask, Flags /*flags*/) const {
+    for (int i = 0; i < size(); ++i) if (mask[i]) ptr[i] = m_value[i];
+  }
   SIMD_ALWAYS_INLINE constexpr T operator[](int i) const { return m_value[i]; }
   SIMD_ALWAYS_INLINE T& operator[](int i) { return m_value[i]; }
   SIMD_ALWAYS_INLINE simd_mask<T, simd_abi::pack<N>> operator<(simd const& other) const {
@@ -200,6 +271,26 @@ class simd<T, simd_abi::pack<N>> {
     SIMD_PRAGMA for (int i = 0; i < size(); ++i) result[i] = m_value[i] == other.m_value[i];
     return result;
   }
+  SIMD_ALWAYS_INLINE simd_mask<T, simd_abi::pack<N>> operator>(simd const& other) const {
+    simd_mask<T, simd_abi::pack<N>> result;
+    SIMD_PRAGMA for (int i = 0; i < size(); ++i) result[i] = m_value[i] > other.m_value[i];
+    return result;
+  }
+  SIMD_ALWAYS_INLINE simd_mask<T, simd_abi::pack<N>> operator<=(simd const& other) const {
+    simd_mask<T, simd_abi::pack<N>> result;
+    SIMD_PRAGMA for (int i = 0; i < size(); ++i) result[i] = m_value[i] <= other.m_value[i];
+    return result;
+  }
+  SIMD_ALWAYS_INLINE simd_mask<T, simd_abi::pack<N>> operator>=(simd const& other) const {
+    simd_mask<T, simd_abi::pack<N>> result;
+    SIMD_PRAGMA for (int i = 0; i < size(); ++i) result[i] = m_value[i] >= other.m_value[i];
+    return result;
+  }
+  SIMD_ALWAYS_INLINE simd_mask<T, simd_abi::pack<N>> operator!=(simd const& other) const {
+    simd_mask<T, simd_abi::pack<N>> result;
+    SIMD_PRAGMA for (int i = 0; i < size(); ++i) result[i] = m_value[i] != other.m_value[i];
+    return result;
+  }
 };
 
 template <class T, int N>
@@ -226,6 +317,162 @@ SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::pack<N>> cbrt(simd<
   return result;
 }
 
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::pack<N>> sinh(simd<T, simd_abi::pack<N>> const& a) {
+  simd<T, simd_abi::pack<N>> result;
+  using std::sinh;
+  SIMD_PRAGMA for (int i = 0; i < a.size(); ++i) result[i] = sinh(a[i]);
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::pack<N>> cosh(simd<T, simd_abi::pack<N>> const& a) {
+  simd<T, simd_abi::pack<N>> result;
+  using std::cosh;
+  SIMD_PRAGMA for (int i = 0; i < a.size(); ++i) result[i] = cosh(a[i]);
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::pack<N>> tanh(simd<T, simd_abi::pack<N>> const& a) {
+  simd<T, simd_abi::pack<N>> result;
+  using std::tanh;
+  SIMD_PRAGMA for (int i = 0; i < a.size(); ++i) result[i] = tanh(a[i]);
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::pack<N>> erf(simd<T, simd_abi::pack<N>> const& a) {
+  simd<T, simd_abi::pack<N>> result;
+  using std::erf;
+  SIMD_PRAGMA for (int i = 0; i < a.size(); ++i) result[i] = erf(a[i]);
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::pack<N>> erfc(simd<T, simd_abi::pack<N>> const& a) {
+  simd<T, simd_abi::pack<N>> result;
+  using std::erfc;
+  SIMD_PRAGMA for (int i = 0; i < a.size(); ++i) result[i] = erfc(a[i]);
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::pack<N>> log2(simd<T, simd_abi::pack<N>> const& a) {
+  simd<T, simd_abi::pack<N>> result;
+  using std::log2;
+  SIMD_PRAGMA for (int i = 0; i < a.size(); ++i) result[i] = log2(a[i]);
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::pack<N>> log10(simd<T, simd_abi::pack<N>> const& a) {
+  simd<T, simd_abi::pack<N>> result;
+  using std::log10;
+  SIMD_PRAGMA for (int i = 0; i < a.size(); ++i) result[i] = log10(a[i]);
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::pack<N>> log1p(simd<T, simd_abi::pack<N>> const& a) {
+  simd<T, simd_abi::pack<N>> result;
+  using std::log1p;
+  SIMD_PRAGMA for (int i = 0; i < a.size(); ++i) result[i] = log1p(a[i]);
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::pack<N>> expm1(simd<T, simd_abi::pack<N>> const& a) {
+  simd<T, simd_abi::pack<N>> result;
+  using std::expm1;
+  SIMD_PRAGMA for (int i = 0; i < a.size(); ++i) result[i] = expm1(a[i]);
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::pack<N>> exp2(simd<T, simd_abi::pack<N>> const& a) {
+  simd<T, simd_abi::pack<N>> result;
+  using std::exp2;
+  SIMD_PRAGMA for (int i = 0; i < a.size(); ++i) result[i] = exp2(a[i]);
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::pack<N>> floor(simd<T, simd_abi::pack<N>> const& a) {
+  simd<T, simd_abi::pack<N>> result;
+  using std::floor;
+  SIMD_PRAGMA for (int i = 0; i < a.size(); ++i) result[i] = floor(a[i]);
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::pack<N>> ceil(simd<T, simd_abi::pack<N>> const& a) {
+  simd<T, simd_abi::pack<N>> result;
+  using std::ceil;
+  SIMD_PRAGMA for (int i = 0; i < a.size(); ++i) result[i] = ceil(a[i]);
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::pack<N>> round(simd<T, simd_abi::pack<N>> const& a) {
+  simd<T, simd_abi::pack<N>> result;
+  using std::round;
+  SIMD_PRAGMA for (int i = 0; i < a.size(); ++i) result[i] = round(a[i]);
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::pack<N>> trunc(simd<T, simd_abi::pack<N>> const& a) {
+  simd<T, simd_abi::pack<N>> result;
+  using std::trunc;
+  SIMD_PRAGMA for (int i = 0; i < a.size(); ++i) result[i] = trunc(a[i]);
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::pack<N>> nearbyint(simd<T, simd_abi::pack<N>> const& a) {
+  simd<T, simd_abi::pack<N>> result;
+  using std::nearbyint;
+  SIMD_PRAGMA for (int i = 0; i < a.size(); ++i) result[i] = nearbyint(a[i]);
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::pack<N>> frexp(simd<T, simd_abi::pack<N>> const& a, simd<T, simd_abi::pack<N>>* e) {
+  simd<T, simd_abi::pack<N>> result;
+  using std::frexp;
+  SIMD_PRAGMA for (int i = 0; i < a.size(); ++i) {
+    int exponent;
+    result[i] = frexp(a[i], &exponent);
+    (*e)[i] = T(exponent);
+  }
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::pack<N>> ldexp(simd<T, simd_abi::pack<N>> const& a, simd<T, simd_abi::pack<N>> const& n) {
+  simd<T, simd_abi::pack<N>> result;
+  using std::ldexp;
+  SIMD_PRAGMA for (int i = 0; i < a.size(); ++i) result[i] = ldexp(a[i], impl::ldexp_exponent(n[i]));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::pack<N>> ilogb(simd<T, simd_abi::pack<N>> const& a) {
+  simd<T, simd_abi::pack<N>> result;
+  using std::ilogb;
+  SIMD_PRAGMA for (int i = 0; i < a.size(); ++i) result[i] = T(ilogb(a[i]));
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::pack<N>> logb(simd<T, simd_abi::pack<N>> const& a) {
+  simd<T, simd_abi::pack<N>> result;
+  using std::logb;
+  SIMD_PRAGMA for (int i = 0; i < a.size(); ++i) result[i] = logb(a[i]);
+  return result;
+}
+
 template <class T, int N>
 SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::pack<N>> exp(simd<T, simd_abi::pack<N>> const& a) {
   simd<T, simd_abi::pack<N>> result;
@@ -234,6 +481,99 @@ SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::pack<N>> exp(simd<T
   return result;
 }
 
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::pack<N>> log(simd<T, simd_abi::pack<N>> const& a) {
+  simd<T, simd_abi::pack<N>> result;
+  using std::log;
+  SIMD_PRAGMA for (int i = 0; i < a.size(); ++i) result[i] = log(a[i]);
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::pack<N>> sin(simd<T, simd_abi::pack<N>> const& a) {
+  simd<T, simd_abi::pack<N>> result;
+  using std::sin;
+  SIMD_PRAGMA for (int i = 0; i < a.size(); ++i) result[i] = sin(a[i]);
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::pack<N>> cos(simd<T, simd_abi::pack<N>> const& a) {
+  simd<T, simd_abi::pack<N>> result;
+  using std::cos;
+  SIMD_PRAGMA for (int i = 0; i < a.size(); ++i) result[i] = cos(a[i]);
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline void sincos(
+    simd<T, simd_abi::pack<N>> const& a,
+    simd<T, simd_abi::pack<N>>* s,
+    simd<T, simd_abi::pack<N>>* c) {
+  *s = sin(a);
+  *c = cos(a);
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::pack<N>> atan(simd<T, simd_abi::pack<N>> const& a) {
+  simd<T, simd_abi::pack<N>> result;
+  using std::atan;
+  SIMD_PRAGMA for (int i = 0; i < a.size(); ++i) result[i] = atan(a[i]);
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::pack<N>> asin(simd<T, simd_abi::pack<N>> const& a) {
+  simd<T, simd_abi::pack<N>> result;
+  using std::asin;
+  SIMD_PRAGMA for (int i = 0; i < a.size(); ++i) result[i] = asin(a[i]);
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::pack<N>> acos(simd<T, simd_abi::pack<N>> const& a) {
+  simd<T, simd_abi::pack<N>> result;
+  using std::acos;
+  SIMD_PRAGMA for (int i = 0; i < a.size(); ++i) result[i] = acos(a[i]);
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::pack<N>> atan2(
+    simd<T, simd_abi::pack<N>> const& a, simd<T, simd_abi::pack<N>> const& b) {
+  simd<T, simd_abi::pack<N>> result;
+  using std::atan2;
+  SIMD_PRAGMA for (int i = 0; i < a.size(); ++i) result[i] = atan2(a[i], b[i]);
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::pack<N>> pow(
+    simd<T, simd_abi::pack<N>> const& a, simd<T, simd_abi::pack<N>> const& b) {
+  simd<T, simd_abi::pack<N>> result;
+  using std::pow;
+  SIMD_PRAGMA for (int i = 0; i < a.size(); ++i) result[i] = pow(a[i], b[i]);
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::pack<N>> fmod(
+    simd<T, simd_abi::pack<N>> const& a, simd<T, simd_abi::pack<N>> const& b) {
+  simd<T, simd_abi::pack<N>> result;
+  using std::fmod;
+  SIMD_PRAGMA for (int i = 0; i < a.size(); ++i) result[i] = fmod(a[i], b[i]);
+  return result;
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::pack<N>> remainder(
+    simd<T, simd_abi::pack<N>> const& a, simd<T, simd_abi::pack<N>> const& b) {
+  simd<T, simd_abi::pack<N>> result;
+  using std::remainder;
+  SIMD_PRAGMA for (int i = 0; i < a.size(); ++i) result[i] = remainder(a[i], b[i]);
+  return result;
+}
+
 template <class T, int N>
 SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::pack<N>> fma(
     simd<T, simd_abi::pack<N>> const& a,
@@ -177,12 +177,38 @@ class simd<T, simd_abi::scalar> {
   SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd operator-() const {
     return simd(-m_value);
   }
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd operator&(simd const& other) const {
+    return simd(m_value & other.m_value);
+  }
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd operator|(simd const& other) const {
+    return simd(m_value | other.m_value);
+  }
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd operator^(simd const& other) const {
+    return simd(m_value ^ other.m_value);
+  }
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd operator~() const {
+    return simd(~m_value);
+  }
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd operator<<(int shift) const {
+    return simd(T(typename std::make_unsigned<T>::type(m_value) << shift));
+  }
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd operator>>(int shift) const {
+    return simd(m_value >> shift);
+  }
   SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE void copy_from(T const* ptr, element_aligned_tag) {
     m_value = *ptr;
   }
   SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE void copy_to(T* ptr, element_aligned_tag) const {
     *ptr = m_value;
   }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE void copy_from(T const* ptr, mask_type const& mask, Flags /*flags*/) {
+    if (mask.get()) m_value = *ptr;
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE void copy_to(T* ptr, mask_type const& mask, Flags /*flags*/) const {
+    if (mask.get()) *ptr = m_value;
+  }
   SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE constexpr T get() const { return m_value; }
   SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd_mask<T, simd_abi::scalar> operator<(simd const& other) const {
     return simd_mask<T, simd_abi::scalar>(m_value < other.m_value);
@@ -190,6 +216,18 @@ class simd<T, simd_abi::scalar> {
   SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd_mask<T, simd_abi::scalar> operator==(simd const& other) const {
     return simd_mask<T, simd_abi::scalar>(m_value == other.m_value);
   }
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd_mask<T, simd_abi::scalar> operator>(simd const& other) const {
+    return simd_mask<T, simd_abi::scalar>(m_value > other.m_value);
+  }
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd_mask<T, simd_abi::scalar> operator<=(simd const& other) const {
+    return simd_mask<T, simd_abi::scalar>(m_value <= other.m_value);
+  }
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd_mask<T, simd_abi::scalar> operator>=(simd const& other) const {
+    return simd_mask<T, simd_abi::scalar>(m_value >= other.m_value);
+  }
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd_mask<T, simd_abi::scalar> operator!=(simd const& other) const {
+    return simd_mask<T, simd_abi::scalar>(m_value != other.m_value);
+  }
 };
 
 template <class T>
@@ -207,11 +245,172 @@ SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::scalar> cbrt(simd<T
   return simd<T, simd_abi::scalar>(std::cbrt(a.get()));
 }
 
+template <class T>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::scalar> sinh(simd<T, simd_abi::scalar> const& a) {
+  return simd<T, simd_abi::scalar>(std::sinh(a.get()));
+}
+
+template <class T>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::scalar> cosh(simd<T, simd_abi::scalar> const& a) {
+  return simd<T, simd_abi::scalar>(std::cosh(a.get()));
+}
+
+template <class T>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::scalar> tanh(simd<T, simd_abi::scalar> const& a) {
+  return simd<T, simd_abi::scalar>(std::tanh(a.get()));
+}
+
+template <class T>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::scalar> erf(simd<T, simd_abi::scalar> const& a) {
+  return simd<T, simd_abi::scalar>(std::erf(a.get()));
+}
+
+template <class T>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::scalar> erfc(simd<T, simd_abi::scalar> const& a) {
+  return simd<T, simd_abi::scalar>(std::erfc(a.get()));
+}
+
+template <class T>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::scalar> log2(simd<T, simd_abi::scalar> const& a) {
+  return simd<T, simd_abi::scalar>(std::log2(a.get()));
+}
+
+template <class T>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::scalar> log10(simd<T, simd_abi::scalar> const& a) {
+  return simd<T, simd_abi::scalar>(std::log10(a.get()));
+}
+
+template <class T>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::scalar> log1p(simd<T, simd_abi::scalar> const& a) {
+  return simd<T, simd_abi::scalar>(std::log1p(a.get()));
+}
+
+template <class T>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::scalar> expm1(simd<T, simd_abi::scalar> const& a) {
+  return simd<T, simd_abi::scalar>(std::expm1(a.get()));
+}
+
+template <class T>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::scalar> exp2(simd<T, simd_abi::scalar> const& a) {
+  return simd<T, simd_abi::scalar>(std::exp2(a.get()));
+}
+
+template <class T>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::scalar> floor(simd<T, simd_abi::scalar> const& a) {
+  return simd<T, simd_abi::scalar>(std::floor(a.get()));
+}
+
+template <class T>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::scalar> ceil(simd<T, simd_abi::scalar> const& a) {
+  return simd<T, simd_abi::scalar>(std::ceil(a.get()));
+}
+
+template <class T>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::scalar> round(simd<T, simd_abi::scalar> const& a) {
+  return simd<T, simd_abi::scalar>(std::round(a.get()));
+}
+
+template <class T>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::scalar> trunc(simd<T, simd_abi::scalar> const& a) {
+  return simd<T, simd_abi::scalar>(std::trunc(a.get()));
+}
+
+template <class T>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::scalar> nearbyint(simd<T, simd_abi::scalar> const& a) {
+  return simd<T, simd_abi::scalar>(std::nearbyint(a.get()));
+}
+
+template <class T>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::scalar> frexp(simd<T, simd_abi::scalar> const& a, simd<T, simd_abi::scalar>* e) {
+  int exponent;
+  simd<T, simd_abi::scalar> const result(std::frexp(a.get(), &exponent));
+  *e = simd<T, simd_abi::scalar>(T(exponent));
+  return result;
+}
+
+template <class T>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::scalar> ldexp(simd<T, simd_abi::scalar> const& a, simd<T, simd_abi::scalar> const& n) {
+  return simd<T, simd_abi::scalar>(std::ldexp(a.get(), impl::ldexp_exponent(n.get())));
+}
+
+template <class T>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::scalar> ilogb(simd<T, simd_abi::scalar> const& a) {
+  return simd<T, simd_abi::scalar>(T(std::ilogb(a.get())));
+}
+
+template <class T>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::scalar> logb(simd<T, simd_abi::scalar> const& a) {
+  return simd<T, simd_abi::scalar>(std::logb(a.get()));
+}
+
 template <class T>
 SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::scalar> exp(simd<T, simd_abi::scalar> const& a) {
   return simd<T, simd_abi::scalar>(std::exp(a.get()));
 }
 
+template <class T>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::scalar> log(simd<T, simd_abi::scalar> const& a) {
+  return simd<T, simd_abi::scalar>(std::log(a.get()));
+}
+
+template <class T>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::scalar> sin(simd<T, simd_abi::scalar> const& a) {
+  return simd<T, simd_abi::scalar>(std::sin(a.get()));
+}
+
+template <class T>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::scalar> cos(simd<T, simd_abi::scalar> const& a) {
+  return simd<T, simd_abi::scalar>(std::cos(a.get()));
+}
+
+template <class T>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline void sincos(
+    simd<T, simd_abi::scalar> const& a,
+    simd<T, simd_abi::scalar>* s,
+    simd<T, simd_abi::scalar>* c) {
+  *s = sin(a);
+  *c = cos(a);
+}
+
+template <class T>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::scalar> atan(simd<T, simd_abi::scalar> const& a) {
+  return simd<T, simd_abi::scalar>(std::atan(a.get()));
+}
+
+template <class T>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::scalar> asin(simd<T, simd_abi::scalar> const& a) {
+  return simd<T, simd_abi::scalar>(std::asin(a.get()));
+}
+
+template <class T>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::scalar> acos(simd<T, simd_abi::scalar> const& a) {
+  return simd<T, simd_abi::scalar>(std::acos(a.get()));
+}
+
+template <class T>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::scalar> atan2(
+    simd<T, simd_abi::scalar> const& a, simd<T, simd_abi::scalar> const& b) {
+  return simd<T, simd_abi::scalar>(std::atan2(a.get(), b.get()));
+}
+
+template <class T>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::scalar> pow(
+    simd<T, simd_abi::scalar> const& a, simd<T, simd_abi::scalar> const& b) {
+  return simd<T, simd_abi::scalar>(std::pow(a.get(), b.get()));
+}
+
+template <class T>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::scalar> fmod(
+    simd<T, simd_abi::scalar> const& a, simd<T, simd_abi::scalar> const& b) {
+  return simd<T, simd_abi::scalar>(std::fmod(a.get(), b.get()));
+}
+
+template <class T>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::scalar> remainder(
+    simd<T, simd_abi::scalar> const& a, simd<T, simd_abi::scalar> const& b) {
+  return simd<T, simd_abi::scalar>(std::remainder(a.get(), b.get()));
+}
+
 template <class T>
 SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::scalar> fma(
     simd<T, simd_abi::scalar> const& a,
@@ -70,6 +70,7 @@
 
 #ifdef __AVX512F__
 #include "avx512.hpp"
+#include "avx512_256.hpp"
 #endif
 
 #ifdef __ARM_NEON
@@ -93,6 +94,10 @@ using native = scalar;
 using native = scalar;
 #elif defined(__HIPCC__) 
 using native = scalar;
+#elif defined(SIMD_PREFER_AVX512_256) && defined(__AVX512F__) && defined(__AVX512VL__)
+// opt-in: AVX-512 masking on ymm registers, for processors that lower
+// their clock speed under heavy 512-bit arithmetic
+using native = avx512_256;
 #elif defined(__AVX512F__)
 using native = avx512;
 #elif defined(__AVX__)
@@ -122,4 +127,116 @@ using native = pack<8>;
 template <class T>
 using native_simd = simd<T, simd_abi::native>;
 
+#ifndef SIMD_NONTEMPORAL_FENCE_DEFINED
+// without streaming stores nontemporal_tag stores are ordinary ones
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline void nontemporal_fence() {}
+#endif
+
+}
+
+#include "fixed_size.hpp"
+
+namespace SIMD_NAMESPACE {
+
+template <class T, int N>
+using fixed_size_simd = simd<T, simd_abi::fixed_size<N>>;
+
+/* Accuracy tiers.
+   Both namespaces offer exp, log, sin, cos, sincos, sqrt, cbrt and div for
+   every ABI, so that a kernel can pick its tier with a namespace alias:
+
+     namespace math = simd::fast;
+     y = math::exp(x);
+
+   precise is the default overload set, with maximum errors measured
+   against the C library (its long double cbrt, as the double one is off
+   by up to 3 ulp) over the whole normal range:
+     exp, log                  1 ulp
+     sin, cos, sincos          2 ulp
+     sqrt, div                 correctly rounded
+     cbrt                      1 ulp
+   The exception is cbrt, which precise takes from this library on every
+   ABI, where the default overload calls the C library on some.
+
+   fast shortens the exp polynomials, evaluates float log without a
+   division, builds sqrt and div on the reciprocal estimates of rsqrt and
+   rcp, drops the twice-precision residual from cbrt, and drops the
+   subnormal handling of all of these:
+     exp                       2 ulp
+     log, cbrt                 1 ulp
+     sqrt, div                 3 ulp
+     sin, cos, sincos          as precise
+   exp returns 0 below -708 (double) or -86.5 (float), where the result
+   would be close to or below the smallest normal number, log treats
+   subnormal arguments as 0, sqrt and cbrt return 0 for them, and div
+   may overflow early when b is subnormal.  Results that are themselves
+   subnormal are not covered by the bounds.
+
+   Both tiers aim at T's full precision.  Where about 12 bits are enough,
+   rcp<0>(a) and rsqrt<0>(a) return the bare estimates, with a relative
+   error below 2^(1 - reciprocal_estimate_bits(&a)): 11 bits for float on
+   SSE and AVX, 14 on AVX-512, 8 on NEON, and T's precision elsewhere.
+
+   The using-declarations below only see the overloads declared above them,
+   which is why the tiers live here, after every ABI has been included.
+ */
+
+namespace precise {
+
+using ::SIMD_NAMESPACE::exp;
+using ::SIMD_NAMESPACE::log;
+using ::SIMD_NAMESPACE::sin;
+using ::SIMD_NAMESPACE::cos;
+using ::SIMD_NAMESPACE::sincos;
+using ::SIMD_NAMESPACE::sqrt;
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> cbrt(simd<T, Abi> const& a) {
+  return impl::cbrt(a);
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> div(simd<T, Abi> const& a, simd<T, Abi> const& b) {
+  return a / b;
+}
+
+}
+
+namespace fast {
+
+using ::SIMD_NAMESPACE::sin;
+using ::SIMD_NAMESPACE::cos;
+using ::SIMD_NAMESPACE::sincos;
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> exp(simd<T, Abi> const& a) {
+  return impl::fast_exp(a);
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> log(simd<T, Abi> const& a) {
+  return impl::fast_log(a);
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> sqrt(simd<T, Abi> const& a) {
+  using simd_t = simd<T, Abi>;
+  simd_t result = choose(a == simd_t(std::numeric_limits<T>::infinity()), a, a * rsqrt(a));
+  // zeros and subnormals give a signed zero, then every negative lane gives NaN
+  result = choose(a < simd_t(std::numeric_limits<T>::min()), a * simd_t(T(0)), result);
+  return choose(a < simd_t(T(0)), simd_t(std::numeric_limits<T>::quiet_NaN()), result);
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> cbrt(simd<T, Abi> const& a) {
+  return impl::fast_cbrt(a);
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> div(simd<T, Abi> const& a, simd<T, Abi> const& b) {
+  return fast_div(a, b);
+}
+
+}
+
 }
@@ -44,7 +44,12 @@
 #pragma once
 
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <limits>
+#include <type_traits>
+#include <utility>
 
 #ifndef SIMD_ALWAYS_INLINE
 #if (defined(__clang__) && (__clang_major__ >= 12)) || \
@@ -100,8 +105,43 @@ class simd;
 template <class T, class Abi>
 class simd_mask;
 
+/* Load and store tags.  element_aligned_tag only promises the alignment
+   of T; vector_aligned_tag promises memory_alignment<simd<T, Abi>>::value,
+   which lets the ABIs use aligned loads and stores; overaligned_tag<N>
+   promises N bytes and picks whichever of the two that allows.
+   Both derive from element_aligned_tag so ABIs without aligned loads
+   accept them unchanged.
+ */
 class element_aligned_tag {};
 
+class vector_aligned_tag : public element_aligned_tag {};
+
+template <std::size_t N>
+class overaligned_tag : public element_aligned_tag {};
+
+/* A vector aligned store that bypasses the caches, for output that is
+   not read again soon; follow a run of them with nontemporal_fence().
+   ABIs without streaming stores treat it as vector_aligned_tag.
+ */
+class nontemporal_tag : public vector_aligned_tag {};
+
+namespace impl {
+
+template <std::size_t N, std::size_t Alignment>
+using overaligned_as = typename std::conditional<(N >= Alignment), vector_aligned_tag, element_aligned_tag>::type;
+
+/* n as the int exponent of std::ldexp.  Converting a non-finite or
+   out-of-range n to int is undefined, so n is first clamped to a bound
+   past which every finite nonzero a over- or underflows.
+ */
+template <class T>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline int ldexp_exponent(T n) {
+  constexpr T bound = T(std::numeric_limits<T>::max_exponent - std::numeric_limits<T>::min_exponent + std::numeric_limits<T>::digits + 1);
+  return int(n < -bound ? -bound : (n < bound ? n : bound));
+}
+
+}
+
 #ifndef SIMD_SCALAR_CHOOSE_DEFINED
 template <class T>
 SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE constexpr T const&
@@ -134,6 +174,36 @@ SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi>& operator/=(simd<T, Abi>
   return a;
 }
 
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi>& operator&=(simd<T, Abi>& a, simd<T, Abi> const& b) {
+  a = a & b;
+  return a;
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi>& operator|=(simd<T, Abi>& a, simd<T, Abi> const& b) {
+  a = a | b;
+  return a;
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi>& operator^=(simd<T, Abi>& a, simd<T, Abi> const& b) {
+  a = a ^ b;
+  return a;
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi>& operator<<=(simd<T, Abi>& a, int shift) {
+  a = a << shift;
+  return a;
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi>& operator>>=(simd<T, Abi>& a, int shift) {
+  a = a >> shift;
+  return a;
+}
+
 template <class T, class Abi>
 SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> operator+(T const& a, simd<T, Abi> const& b) {
   return simd<T, Abi>(a) + b;
@@ -214,81 +284,2506 @@ SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> abs(simd<T, Abi> a) {
 }
 
 template <class T, class Abi>
-SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> cbrt(simd<T, Abi> a) {
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> fma(simd<T, Abi> a, simd<T, Abi> const& b, simd<T, Abi> const& c) {
+  T stack_a[simd<T, Abi>::size()];
+  T stack_b[simd<T, Abi>::size()];
+  a.copy_to(stack_a, element_aligned_tag());
+  b.copy_to(stack_b, element_aligned_tag());
+  for (int i = 0; i < simd<T, Abi>::size(); ++i) stack_a[i] *= stack_b[i];
+  c.copy_to(stack_b, element_aligned_tag());
+  for (int i = 0; i < simd<T, Abi>::size(); ++i) stack_a[i] += stack_b[i];
+  a.copy_from(stack_a, element_aligned_tag());
+  return a;
+}
+
+/* Building blocks for the math functions below.
+   These fallbacks go lane by lane; every ABI with integer or rounding
+   instructions overloads them with register-only versions.
+ */
+
+// nearest integer, ties to even
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> roundeven(simd<T, Abi> a) {
   T tmp[simd<T, Abi>::size()];
   a.copy_to(tmp, element_aligned_tag());
-  for (int i = 0; i < simd<T, Abi>::size(); ++i) tmp[i] = std::cbrt(tmp[i]);
+  for (int i = 0; i < simd<T, Abi>::size(); ++i) tmp[i] = std::nearbyint(tmp[i]);
   a.copy_from(tmp, element_aligned_tag());
   return a;
 }
 
+/* The other roundings, built on roundeven so that they stay in registers
+   wherever it does.  The result always takes the sign of a, which keeps
+   -0 and the negative zeros of ceil(-0.5) and trunc(-0.5).
+ */
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> floor(simd<T, Abi> const& a) {
+  using simd_t = simd<T, Abi>;
+  simd_t const r = roundeven(a);
+  return copysign(r - choose(a < r, simd_t(T(1)), simd_t(T(0))), a);
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> ceil(simd<T, Abi> const& a) {
+  using simd_t = simd<T, Abi>;
+  simd_t const r = roundeven(a);
+  return copysign(r + choose(r < a, simd_t(T(1)), simd_t(T(0))), a);
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> trunc(simd<T, Abi> const& a) {
+  using simd_t = simd<T, Abi>;
+  simd_t const r = roundeven(a);
+  simd_t const overshoot = choose(abs(a) < abs(r), copysign(simd_t(T(1)), a), simd_t(T(0)));
+  return copysign(r - overshoot, a);
+}
+
+// nearest integer, ties away from zero
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> round(simd<T, Abi> const& a) {
+  using simd_t = simd<T, Abi>;
+  simd_t const t = trunc(a);
+  simd_t const step = choose(abs(a - t) < simd_t(T(0.5)), simd_t(T(0)), copysign(simd_t(T(1)), a));
+  return copysign(t + step, a);
+}
+
+// nearest integer in the default rounding mode, which is roundeven
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> nearbyint(simd<T, Abi> const& a) {
+  return roundeven(a);
+}
+
+// 2^n for integral n within the normal exponent range
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> pow2i(simd<T, Abi> n) {
+  T tmp[simd<T, Abi>::size()];
+  n.copy_to(tmp, element_aligned_tag());
+  for (int i = 0; i < simd<T, Abi>::size(); ++i) tmp[i] = std::ldexp(T(1), int(tmp[i]));
+  n.copy_from(tmp, element_aligned_tag());
+  return n;
+}
+
+// floor(log2(|a|)) for normal, finite, nonzero a
 template <class T, class Abi>
-SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> exp(simd<T, Abi> a) {
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> getexp(simd<T, Abi> a) {
   T tmp[simd<T, Abi>::size()];
   a.copy_to(tmp, element_aligned_tag());
-  for (int i = 0; i < simd<T, Abi>::size(); ++i) tmp[i] = std::exp(tmp[i]);
+  for (int i = 0; i < simd<T, Abi>::size(); ++i) tmp[i] = T(std::ilogb(tmp[i]));
   a.copy_from(tmp, element_aligned_tag());
   return a;
 }
 
+// |a| / 2^getexp(a), in [1, 2), for normal, finite, nonzero a
 template <class T, class Abi>
-SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> fma(simd<T, Abi> a, simd<T, Abi> const& b, simd<T, Abi> const& c) {
-  T stack_a[simd<T, Abi>::size()];
-  T stack_b[simd<T, Abi>::size()];
-  a.copy_to(stack_a, element_aligned_tag());
-  b.copy_to(stack_b, element_aligned_tag());
-  for (int i = 0; i < simd<T, Abi>::size(); ++i) stack_a[i] *= stack_b[i];
-  c.copy_to(stack_b, element_aligned_tag());
-  for (int i = 0; i < simd<T, Abi>::size(); ++i) stack_a[i] += stack_b[i];
-  a.copy_from(stack_a, element_aligned_tag());
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> getmant(simd<T, Abi> a) {
+  T tmp[simd<T, Abi>::size()];
+  a.copy_to(tmp, element_aligned_tag());
+  for (int i = 0; i < simd<T, Abi>::size(); ++i) tmp[i] = std::scalbn(std::abs(tmp[i]), -std::ilogb(tmp[i]));
+  a.copy_from(tmp, element_aligned_tag());
   return a;
 }
 
-SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline bool all_of(bool a) { return a; }
-SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline bool any_of(bool a) { return a; }
+/* Estimates of 1/a and 1/sqrt(a) with at least
+   reciprocal_estimate_bits(&a) correct bits, refined by rcp and rsqrt.
+   The fallbacks are exact; ABIs with estimate instructions overload them.
+ */
 
 template <class T, class Abi>
-class simd_storage {
-  T m_value[simd<T, Abi>::size()];
- public:
-  using value_type = T;
-  using simd_type = simd<T, Abi>;
-  SIMD_ALWAYS_INLINE inline simd_storage() = default;
-  SIMD_ALWAYS_INLINE inline static constexpr
-  int size() { return simd<T, Abi>::size(); }
-  SIMD_ALWAYS_INLINE explicit inline
-  simd_storage(simd<T, Abi> const& value) {
-    value.copy_to(m_value, element_aligned_tag());
-  }
-  SIMD_ALWAYS_INLINE explicit inline
-  simd_storage(T value)
-    :simd_storage(simd<T, Abi>(value))
-  {}
-  SIMD_ALWAYS_INLINE inline
-  simd_storage& operator=(simd<T, Abi> const& value) {
-    value.copy_to(m_value, element_aligned_tag());
-    return *this;
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> rcp_estimate(simd<T, Abi> const& a) {
+  return simd<T, Abi>(T(1)) / a;
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> rsqrt_estimate(simd<T, Abi> const& a) {
+  return simd<T, Abi>(T(1)) / sqrt(a);
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline constexpr int reciprocal_estimate_bits(simd<T, Abi> const*) {
+  return std::numeric_limits<T>::digits;
+}
+
+namespace impl {
+
+/* exp(a) = 2^n * exp(r) with n = round(a / ln2) and |r| <= ln2 / 2.
+   ln2 is split in two parts so that n * ln2_hi is exact.
+   2^n is applied in two halves so that subnormal results come out right.
+ */
+
+// ln2 = ln2_hi + ln2_lo with n * ln2_hi exact over the range of n exp reduces by
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline constexpr double ln2_hi(double) { return 6.93147180369123816490e-01; }
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline constexpr float ln2_hi(float) { return 0.693359375f; }
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline constexpr double ln2_lo(double) { return 1.90821492927058770002e-10; }
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline constexpr float ln2_lo(float) { return -2.12194440e-4f; }
+
+// exp(r) - 1 for |r| <= ln2 / 2
+template <class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<double, Abi> expm1_reduced(simd<double, Abi> const& r) {
+  using simd_t = simd<double, Abi>;
+  // Taylor series, truncated below 2^-57 on |r| <= ln2 / 2
+  simd_t p(1.6059043836821613e-10);
+  p = fma(p, r, simd_t(2.08767569878681e-09));
+  p = fma(p, r, simd_t(2.505210838544172e-08));
+  p = fma(p, r, simd_t(2.755731922398589e-07));
+  p = fma(p, r, simd_t(2.7557319223985893e-06));
+  p = fma(p, r, simd_t(2.48015873015873e-05));
+  p = fma(p, r, simd_t(1.984126984126984e-04));
+  p = fma(p, r, simd_t(1.388888888888889e-03));
+  p = fma(p, r, simd_t(8.333333333333333e-03));
+  p = fma(p, r, simd_t(4.1666666666666664e-02));
+  p = fma(p, r, simd_t(1.6666666666666666e-01));
+  p = fma(p, r, simd_t(0.5));
+  return fma(p, r * r, r);
+}
+
+template <class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<double, Abi> exp_scaled(simd<double, Abi> const& r, simd<double, Abi> const& n) {
+  using simd_t = simd<double, Abi>;
+  simd_t const p = expm1_reduced(r) + simd_t(1.0);
+  simd_t const n1 = roundeven(n * simd_t(0.5));
+  return (p * pow2i(n1)) * pow2i(n - n1);
+}
+
+template <class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<float, Abi> expm1_reduced(simd<float, Abi> const& r) {
+  using simd_t = simd<float, Abi>;
+  // Cephes minimax polynomial
+  simd_t p(1.9875691500e-4f);
+  p = fma(p, r, simd_t(1.3981999507e-3f));
+  p = fma(p, r, simd_t(8.3334519073e-3f));
+  p = fma(p, r, simd_t(4.1665795894e-2f));
+  p = fma(p, r, simd_t(1.6666665459e-1f));
+  p = fma(p, r, simd_t(5.0000001201e-1f));
+  return fma(p, r * r, r);
+}
+
+template <class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<float, Abi> exp_scaled(simd<float, Abi> const& r, simd<float, Abi> const& n) {
+  using simd_t = simd<float, Abi>;
+  simd_t const p = expm1_reduced(r) + simd_t(1.0f);
+  simd_t const n1 = roundeven(n * simd_t(0.5f));
+  return (p * pow2i(n1)) * pow2i(n - n1);
+}
+
+// exp(a + a_lo) for a tail |a_lo| well below ulp(a)
+template <class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<double, Abi> exp(simd<double, Abi> const& a, simd<double, Abi> const& a_lo) {
+  using simd_t = simd<double, Abi>;
+  simd_t const x = max(simd_t(-746.0), min(simd_t(710.0), a));
+  simd_t const n = roundeven(x * simd_t(1.4426950408889634));
+  simd_t r = fma(n, simd_t(-6.93147180369123816490e-01), x);
+  r = fma(n, simd_t(-1.90821492927058770002e-10), r) + choose(x == a, a_lo, simd_t(0.0));
+  return exp_scaled(r, n);
+}
+
+template <class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<float, Abi> exp(simd<float, Abi> const& a, simd<float, Abi> const& a_lo) {
+  using simd_t = simd<float, Abi>;
+  simd_t const x = max(simd_t(-104.0f), min(simd_t(89.0f), a));
+  simd_t const n = roundeven(x * simd_t(1.44269504088896341f));
+  simd_t r = fma(n, simd_t(-0.693359375f), x);
+  r = fma(n, simd_t(2.12194440e-4f), r) + choose(x == a, a_lo, simd_t(0.0f));
+  return exp_scaled(r, n);
+}
+
+template <class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<double, Abi> exp(simd<double, Abi> const& a) {
+  using simd_t = simd<double, Abi>;
+  simd_t const x = max(simd_t(-746.0), min(simd_t(710.0), a));
+  simd_t const n = roundeven(x * simd_t(1.4426950408889634));
+  simd_t r = fma(n, simd_t(-6.93147180369123816490e-01), x);
+  r = fma(n, simd_t(-1.90821492927058770002e-10), r);
+  return choose(a == a, exp_scaled(r, n), a);
+}
+
+template <class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<float, Abi> exp(simd<float, Abi> const& a) {
+  using simd_t = simd<float, Abi>;
+  simd_t const x = max(simd_t(-104.0f), min(simd_t(89.0f), a));
+  simd_t const n = roundeven(x * simd_t(1.44269504088896341f));
+  simd_t r = fma(n, simd_t(-0.693359375f), x);
+  r = fma(n, simd_t(2.12194440e-4f), r);
+  return choose(a == a, exp_scaled(r, n), a);
+}
+
+// a = 2^e * m with m in [1, 2), for positive finite a including subnormals
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline void decompose(simd<T, Abi> const& a, simd<T, Abi>& m, simd<T, Abi>& e) {
+  using simd_t = simd<T, Abi>;
+  // scale subnormals up so getexp and getmant see a normal number
+  constexpr int k = std::numeric_limits<T>::digits + 1;
+  auto const is_subnormal = a < simd_t(std::numeric_limits<T>::min());
+  simd_t const x = choose(is_subnormal, a * simd_t(T(1ull << k)), a);
+  m = getmant(x);
+  e = getexp(x) - choose(is_subnormal, simd_t(T(k)), simd_t(T(0)));
+}
+
+// the result of a logarithm at infinity, zero, negative arguments and NaN
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> log_specials(simd<T, Abi> const& a, simd<T, Abi> const& result) {
+  using simd_t = simd<T, Abi>;
+  simd_t const inf(std::numeric_limits<T>::infinity());
+  simd_t r = choose(a == inf, a, result);
+  r = choose(a == simd_t(T(0)), -inf, r);
+  return choose(a < simd_t(T(0)) || !(a == a), simd_t(std::numeric_limits<T>::quiet_NaN()), r);
+}
+
+/* log(a) = e * ln2 + log(1 + f) with a = 2^e * (1 + f) and
+   sqrt(2)/2 <= 1 + f < sqrt(2), following fdlibm:
+   log(1 + f) = f - f^2/2 + s * (f^2/2 + R(s^2)), s = f / (2 + f).
+ */
+
+template <class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<double, Abi> log(simd<double, Abi> const& a) {
+  using simd_t = simd<double, Abi>;
+  simd_t m, e;
+  decompose(a, m, e);
+  auto const is_big = simd_t(1.4142135623730951) < m;
+  m = choose(is_big, m * simd_t(0.5), m);
+  e = choose(is_big, e + simd_t(1.0), e);
+  simd_t const f = m - simd_t(1.0);
+  simd_t const s = f / (simd_t(2.0) + f);
+  simd_t const z = s * s;
+  simd_t const w = z * z;
+  simd_t t1 = fma(w, simd_t(1.531383769920937332e-01), simd_t(2.222219843214978396e-01));
+  t1 = fma(w, t1, simd_t(3.999999999940941908e-01));
+  t1 = t1 * w;
+  simd_t t2 = fma(w, simd_t(1.479819860511658591e-01), simd_t(1.818357216161805012e-01));
+  t2 = fma(w, t2, simd_t(2.857142874366239149e-01));
+  t2 = fma(w, t2, simd_t(6.666666666666735130e-01));
+  t2 = t2 * z;
+  simd_t const R = t1 + t2;
+  simd_t const hfsq = simd_t(0.5) * f * f;
+  simd_t result = fma(s, hfsq + R, e * simd_t(1.90821492927058770002e-10));
+  result = fma(e, simd_t(6.93147180369123816490e-01), f - (hfsq - result));
+  return log_specials(a, result);
+}
+
+template <class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<float, Abi> log(simd<float, Abi> const& a) {
+  using simd_t = simd<float, Abi>;
+  simd_t m, e;
+  decompose(a, m, e);
+  auto const is_big = simd_t(1.41421356f) < m;
+  m = choose(is_big, m * simd_t(0.5f), m);
+  e = choose(is_big, e + simd_t(1.0f), e);
+  simd_t const f = m - simd_t(1.0f);
+  simd_t const s = f / (simd_t(2.0f) + f);
+  simd_t const z = s * s;
+  simd_t const w = z * z;
+  simd_t const t1 = w * fma(w, simd_t(0.24279078841f), simd_t(0.40000972152f));
+  simd_t const t2 = z * fma(w, simd_t(0.28498786688f), simd_t(0.66666662693f));
+  simd_t const R = t1 + t2;
+  simd_t const hfsq = simd_t(0.5f) * f * f;
+  simd_t result = fma(s, hfsq + R, e * simd_t(9.0580006145e-06f));
+  result = fma(e, simd_t(6.9313812256e-01f), f - (hfsq - result));
+  return log_specials(a, result);
+}
+
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> exp(simd<T, Abi> const& a) {
+  return impl::exp(a);
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> log(simd<T, Abi> const& a) {
+  return impl::log(a);
+}
+
+namespace impl {
+
+/* Cody-Waite reduction: a = r + (4k + q) * pi/2 with |r| <= pi/4 and
+   q in {0, 1, 2, 3}.  pi/2 is split in parts short enough that n * part
+   is exact while |a| < max_reduce_pio2, beyond which sin and cos fall back
+   to the C library.
+ */
+
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline constexpr double max_reduce_pio2(double) { return 1048576.0; }
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline constexpr float max_reduce_pio2(float) { return 8192.0f; }
+
+template <class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline void reduce_pio2(
+    simd<double, Abi> const& a, simd<double, Abi>& r, simd<double, Abi>& q) {
+  using simd_t = simd<double, Abi>;
+  simd_t const n = roundeven(a * simd_t(6.36619772367581382433e-01));
+  r = fma(n, simd_t(-1.57079632673412561417e+00), a);
+  r = fma(n, simd_t(-6.07710050630396597660e-11), r);
+  r = fma(n, simd_t(-2.02226624871116645580e-21), r);
+  simd_t const t = n * simd_t(0.25);
+  simd_t k = roundeven(t);
+  k = k - choose(t < k, simd_t(1.0), simd_t(0.0));
+  q = fma(k, simd_t(-4.0), n);
+}
+
+template <class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline void reduce_pio2(
+    simd<float, Abi> const& a, simd<float, Abi>& r, simd<float, Abi>& q) {
+  using simd_t = simd<float, Abi>;
+  simd_t const n = roundeven(a * simd_t(0.636619772367581382433f));
+  r = fma(n, simd_t(-1.5703125f), a);
+  r = fma(n, simd_t(-4.837512969970703125e-4f), r);
+  r = fma(n, simd_t(-7.549533620476723e-8f), r);
+  r = fma(n, simd_t(-2.5633440682570896e-12f), r);
+  simd_t const t = n * simd_t(0.25f);
+  simd_t k = roundeven(t);
+  k = k - choose(t < k, simd_t(1.0f), simd_t(0.0f));
+  q = fma(k, simd_t(-4.0f), n);
+}
+
+// fdlibm's __kernel_sin and __kernel_cos on |r| <= pi/4
+
+template <class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<double, Abi> sin_kernel(simd<double, Abi> const& r) {
+  using simd_t = simd<double, Abi>;
+  simd_t const z = r * r;
+  simd_t p = fma(z, simd_t(1.58969099521155010221e-10), simd_t(-2.50507602534068634195e-08));
+  p = fma(z, p, simd_t(2.75573137070700676789e-06));
+  p = fma(z, p, simd_t(-1.98412698298579493134e-04));
+  p = fma(z, p, simd_t(8.33333333332248946124e-03));
+  p = fma(z, p, simd_t(-1.66666666666666324348e-01));
+  return fma(z * r, p, r);
+}
+
+template <class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<double, Abi> cos_kernel(simd<double, Abi> const& r) {
+  using simd_t = simd<double, Abi>;
+  simd_t const z = r * r;
+  simd_t p = fma(z, simd_t(-1.13596475577881948265e-11), simd_t(2.08757232129817482790e-09));
+  p = fma(z, p, simd_t(-2.75573143513906633035e-07));
+  p = fma(z, p, simd_t(2.48015872894767294178e-05));
+  p = fma(z, p, simd_t(-1.38888888888741095749e-03));
+  p = fma(z, p, simd_t(4.16666666666666019037e-02));
+  simd_t const hz = simd_t(0.5) * z;
+  simd_t const w = simd_t(1.0) - hz;
+  return w + fma(z * z, p, (simd_t(1.0) - w) - hz);
+}
+
+// Cephes' sinf and cosf polynomials on |r| <= pi/4
+
+template <class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<float, Abi> sin_kernel(simd<float, Abi> const& r) {
+  using simd_t = simd<float, Abi>;
+  simd_t const z = r * r;
+  simd_t p = fma(z, simd_t(-1.9515295891e-4f), simd_t(8.3321608736e-3f));
+  p = fma(z, p, simd_t(-1.6666654611e-1f));
+  return fma(z * r, p, r);
+}
+
+template <class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<float, Abi> cos_kernel(simd<float, Abi> const& r) {
+  using simd_t = simd<float, Abi>;
+  simd_t const z = r * r;
+  simd_t p = fma(z, simd_t(2.443315711809948e-5f), simd_t(-1.388731625493765e-3f));
+  p = fma(z, p, simd_t(4.166664568298827e-2f));
+  return fma(z * z, p, fma(z, simd_t(-0.5f), simd_t(1.0f)));
+}
+
+/* sin or cos per lane from one polynomial: r + r z S(z) where use_cos is
+   false and 1 + z C(z) where it is true, C(z) = -1/2 + z * (the cos
+   kernel's coefficients), with the coefficients chosen per lane.  sin
+   and cos alone use this so that each evaluates one polynomial; sincos
+   needs both and uses the two kernels above.
+ */
+
+template <class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<double, Abi> sin_or_cos_kernel(
+    simd<double, Abi> const& r, simd_mask<double, Abi> const& use_cos) {
+  using simd_t = simd<double, Abi>;
+  simd_t const z = r * r;
+  simd_t p = choose(use_cos, simd_t(-1.13596475577881948265e-11), simd_t(0.0));
+  p = fma(z, p, choose(use_cos, simd_t(2.08757232129817482790e-09), simd_t(1.58969099521155010221e-10)));
+  p = fma(z, p, choose(use_cos, simd_t(-2.75573143513906633035e-07), simd_t(-2.50507602534068634195e-08)));
+  p = fma(z, p, choose(use_cos, simd_t(2.48015872894767294178e-05), simd_t(2.75573137070700676789e-06)));
+  p = fma(z, p, choose(use_cos, simd_t(-1.38888888888741095749e-03), simd_t(-1.98412698298579493134e-04)));
+  p = fma(z, p, choose(use_cos, simd_t(4.16666666666666019037e-02), simd_t(8.33333333332248946124e-03)));
+  p = fma(z, p, choose(use_cos, simd_t(-0.5), simd_t(-1.66666666666666324348e-01)));
+  return fma(choose(use_cos, z, z * r), p, choose(use_cos, simd_t(1.0), r));
+}
+
+template <class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<float, Abi> sin_or_cos_kernel(
+    simd<float, Abi> const& r, simd_mask<float, Abi> const& use_cos) {
+  using simd_t = simd<float, Abi>;
+  simd_t const z = r * r;
+  simd_t p = choose(use_cos, simd_t(2.443315711809948e-5f), simd_t(0.0f));
+  p = fma(z, p, choose(use_cos, simd_t(-1.388731625493765e-3f), simd_t(-1.9515295891e-4f)));
+  p = fma(z, p, choose(use_cos, simd_t(4.166664568298827e-2f), simd_t(8.3321608736e-3f)));
+  p = fma(z, p, choose(use_cos, simd_t(-0.5f), simd_t(-1.6666654611e-1f)));
+  return fma(choose(use_cos, z, z * r), p, choose(use_cos, simd_t(1.0f), r));
+}
+
+// lanes beyond the reduction's range take f from the C library
+template <class T, class Abi, class F>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline void beyond_reduce_pio2(simd<T, Abi> const& a, simd<T, Abi>& result, F const& f) {
+  using simd_t = simd<T, Abi>;
+  if (all_of(abs(a) < simd_t(max_reduce_pio2(T())))) return;
+  T stack_a[simd_t::size()];
+  T stack_result[simd_t::size()];
+  a.copy_to(stack_a, element_aligned_tag());
+  result.copy_to(stack_result, element_aligned_tag());
+  for (int i = 0; i < simd_t::size(); ++i) {
+    if (!(std::abs(stack_a[i]) < max_reduce_pio2(T()))) stack_result[i] = f(stack_a[i]);
   }
-  SIMD_ALWAYS_INLINE inline
-  T const* data() const { return m_value; }
-  SIMD_ALWAYS_INLINE inline
-  T* data() { return m_value; }
-  SIMD_ALWAYS_INLINE inline
-  T const& operator[](int i) const { return m_value[i]; }
-  SIMD_ALWAYS_INLINE inline
-  T& operator[](int i) { return m_value[i]; }
+  result.copy_from(stack_result, element_aligned_tag());
+}
+
+template <class T>
+class libm_sin {
+ public:
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline T operator()(T a) const { return std::sin(a); }
 };
 
 template <class T>
-class simd_size {
-  public:
-  static constexpr int value = 1;
+class libm_cos {
+ public:
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline T operator()(T a) const { return std::cos(a); }
 };
 
+// odd quadrants swap sin and cos; sin is negative in 2 and 3, cos in 1 and 2
 template <class T, class Abi>
-class simd_size<simd<T, Abi>> {
-  public:
-  static constexpr int value = simd<T, Abi>::size();
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline void sincos(
+    simd<T, Abi> const& a, simd<T, Abi>& s, simd<T, Abi>& c) {
+  using simd_t = simd<T, Abi>;
+  simd_t r, q;
+  reduce_pio2(a, r, q);
+  simd_t const sin_r = sin_kernel(r);
+  simd_t const cos_r = cos_kernel(r);
+  auto const is_odd = (q == simd_t(T(1))) || (q == simd_t(T(3)));
+  s = choose(is_odd, cos_r, sin_r);
+  c = choose(is_odd, sin_r, cos_r);
+  s = choose(simd_t(T(1.5)) < q, -s, s);
+  c = choose((q == simd_t(T(1))) || (q == simd_t(T(2))), -c, c);
+  // the reduction turns -0 into +0
+  s = choose(a == simd_t(T(0)), a, s);
+  beyond_reduce_pio2(a, s, libm_sin<T>());
+  beyond_reduce_pio2(a, c, libm_cos<T>());
+}
+
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> sin(simd<T, Abi> const& a) {
+  using simd_t = simd<T, Abi>;
+  simd_t r, q;
+  impl::reduce_pio2(a, r, q);
+  simd_t s = impl::sin_or_cos_kernel(r, (q == simd_t(T(1))) || (q == simd_t(T(3))));
+  s = choose(simd_t(T(1.5)) < q, -s, s);
+  s = choose(a == simd_t(T(0)), a, s);
+  impl::beyond_reduce_pio2(a, s, impl::libm_sin<T>());
+  return s;
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> cos(simd<T, Abi> const& a) {
+  using simd_t = simd<T, Abi>;
+  simd_t r, q;
+  impl::reduce_pio2(a, r, q);
+  simd_t c = impl::sin_or_cos_kernel(r, (q == simd_t(T(0))) || (q == simd_t(T(2))));
+  c = choose((q == simd_t(T(1))) || (q == simd_t(T(2))), -c, c);
+  impl::beyond_reduce_pio2(a, c, impl::libm_cos<T>());
+  return c;
+}
+
+// sin and cos sharing a single range reduction
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline void sincos(simd<T, Abi> const& a, simd<T, Abi>* s, simd<T, Abi>* c) {
+  impl::sincos(a, *s, *c);
+}
+
+namespace impl {
+
+// multiples of pi split in a representable head and a small tail
+template <class T>
+struct pi_constants;
+
+template <>
+struct pi_constants<double> {
+  SIMD_HOST_DEVICE static constexpr double pio2_hi() { return 1.57079632679489655800e+00; }
+  SIMD_HOST_DEVICE static constexpr double pio2_lo() { return 6.12323399573676603587e-17; }
+  SIMD_HOST_DEVICE static constexpr double pi_hi() { return 3.14159265358979311600e+00; }
+  SIMD_HOST_DEVICE static constexpr double pi_lo() { return 1.22464679914735317720e-16; }
+};
+
+template <>
+struct pi_constants<float> {
+  SIMD_HOST_DEVICE static constexpr float pio2_hi() { return 1.5707962513e+00f; }
+  SIMD_HOST_DEVICE static constexpr float pio2_lo() { return 7.5497894159e-08f; }
+  SIMD_HOST_DEVICE static constexpr float pi_hi() { return 3.1415925026e+00f; }
+  SIMD_HOST_DEVICE static constexpr float pi_lo() { return 1.5099578832e-07f; }
+};
+
+/* Cephes atan: |a| is mapped to [0, tan(pi/8)] by t = -1/|a| above
+   tan(3pi/8) or t = (|a|-1)/(|a|+1) above the middle threshold, both
+   with a single division, and the offset pi/2 or pi/4 is added back.
+ */
+
+template <class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<double, Abi> atan(simd<double, Abi> const& a) {
+  using simd_t = simd<double, Abi>;
+  simd_t const x = abs(a);
+  auto const big = simd_t(2.41421356237309504880) < x;
+  auto const mid = simd_t(0.66) < x;
+  simd_t const num = choose(big, simd_t(-1.0), choose(mid, x - simd_t(1.0), x));
+  simd_t const den = choose(big, x, choose(mid, x + simd_t(1.0), simd_t(1.0)));
+  simd_t const hi = choose(big, simd_t(1.57079632679489661923), choose(mid, simd_t(7.85398163397448309616e-01), simd_t(0.0)));
+  simd_t const lo = choose(big, simd_t(6.123233995736765886130e-17), choose(mid, simd_t(3.061616997868382943065e-17), simd_t(0.0)));
+  simd_t const t = num / den;
+  simd_t const z = t * t;
+  simd_t p = fma(z, simd_t(-8.750608600031904122785e-01), simd_t(-1.615753718733365076637e+01));
+  p = fma(z, p, simd_t(-7.500855792314704667340e+01));
+  p = fma(z, p, simd_t(-1.228866684490136173410e+02));
+  p = fma(z, p, simd_t(-6.485021904942025371773e+01));
+  simd_t q = z + simd_t(2.485846490142306297962e+01);
+  q = fma(z, q, simd_t(1.650270098316988542046e+02));
+  q = fma(z, q, simd_t(4.328810604912902668951e+02));
+  q = fma(z, q, simd_t(4.853903996359136964868e+02));
+  q = fma(z, q, simd_t(1.945506571482613964425e+02));
+  simd_t const r = fma(t * z, p / q, t);
+  return copysign(hi + (r + lo), a);
+}
+
+template <class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<float, Abi> atan(simd<float, Abi> const& a) {
+  using simd_t = simd<float, Abi>;
+  simd_t const x = abs(a);
+  auto const big = simd_t(2.414213562373095f) < x;
+  auto const mid = simd_t(0.4142135623730950f) < x;
+  simd_t const num = choose(big, simd_t(-1.0f), choose(mid, x - simd_t(1.0f), x));
+  simd_t const den = choose(big, x, choose(mid, x + simd_t(1.0f), simd_t(1.0f)));
+  simd_t const hi = choose(big, simd_t(1.5707963267948966f), choose(mid, simd_t(0.7853981633974483f), simd_t(0.0f)));
+  simd_t const lo = choose(big, simd_t(-4.37113883e-8f), choose(mid, simd_t(-2.18556941e-8f), simd_t(0.0f)));
+  simd_t const t = num / den;
+  simd_t const z = t * t;
+  simd_t p = fma(z, simd_t(8.05374449538e-2f), simd_t(-1.38776856032e-1f));
+  p = fma(z, p, simd_t(1.99777106478e-1f));
+  p = fma(z, p, simd_t(-3.33329491539e-1f));
+  return copysign(hi + (fma(t * z, p, t) + lo), a);
+}
+
+/* atan2 reduces to atan(min(|x|,|y|) / max(|x|,|y|)) on [0, 1] and
+   reflects about pi/4 and pi/2 by the octant, so 0/0 and inf/inf are
+   the only special quotients; the sign of x is read through copysign
+   so that -0 selects the left half-plane.
+ */
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> atan2(simd<T, Abi> const& y, simd<T, Abi> const& x) {
+  using simd_t = simd<T, Abi>;
+  using pi = pi_constants<T>;
+  simd_t const ax = abs(x);
+  simd_t const ay = abs(y);
+  simd_t const num = min(ax, ay);
+  simd_t const den = max(ax, ay);
+  simd_t const inf(std::numeric_limits<T>::infinity());
+  simd_t ratio = choose(den == simd_t(T(0)), simd_t(T(0)), num / den);
+  ratio = choose(num == inf, simd_t(T(1)), ratio);
+  simd_t t = impl::atan(ratio);
+  t = choose(ax < ay, simd_t(pi::pio2_hi()) - (t - simd_t(pi::pio2_lo())), t);
+  t = choose(copysign(simd_t(T(1)), x) < simd_t(T(0)), simd_t(pi::pi_hi()) - (t - simd_t(pi::pi_lo())), t);
+  t = copysign(t, y);
+  return choose((x == x) && (y == y), t, x + y);
+}
+
+/* fdlibm asin/acos: one rational R(z) approximates (asin(s) - s) / s^3
+   with z = s*s, evaluated on z = a*a for |a| < 1/2 and on
+   z = (1 - |a|) / 2, s = sqrt(z) otherwise through
+   asin(|a|) = pi/2 - 2 asin(s).  Both regions share the evaluation.
+ */
+
+template <class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<double, Abi> asin_rational(simd<double, Abi> const& z) {
+  using simd_t = simd<double, Abi>;
+  simd_t p = fma(z, simd_t(3.47933107596021167570e-05), simd_t(7.91534994289814532176e-04));
+  p = fma(z, p, simd_t(-4.00555345006794114027e-02));
+  p = fma(z, p, simd_t(2.01212532134862925881e-01));
+  p = fma(z, p, simd_t(-3.25565818622400915405e-01));
+  p = fma(z, p, simd_t(1.66666666666666657415e-01));
+  simd_t q = fma(z, simd_t(7.70381505559019352791e-02), simd_t(-6.88283971605453293030e-01));
+  q = fma(z, q, simd_t(2.02094576023350569471e+00));
+  q = fma(z, q, simd_t(-2.40339491173441421878e+00));
+  q = fma(z, q, simd_t(1.0));
+  return z * p / q;
+}
+
+template <class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<float, Abi> asin_rational(simd<float, Abi> const& z) {
+  using simd_t = simd<float, Abi>;
+  simd_t p = fma(z, simd_t(-8.6563630030e-03f), simd_t(-4.2743422091e-02f));
+  p = fma(z, p, simd_t(1.6666586697e-01f));
+  simd_t const q = fma(z, simd_t(-7.0662963390e-01f), simd_t(1.0f));
+  return z * p / q;
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> asin(simd<T, Abi> const& a) {
+  using simd_t = simd<T, Abi>;
+  using pi = pi_constants<T>;
+  simd_t const x = abs(a);
+  auto const is_small = x < simd_t(T(0.5));
+  simd_t const z = choose(is_small, x * x, (simd_t(T(1)) - x) * simd_t(T(0.5)));
+  simd_t const r = asin_rational(z);
+  simd_t const s = sqrt(z);
+  // s + c is sqrt(z) to twice the working precision
+  simd_t const c = choose(z == simd_t(T(0)), z, fma(-s, s, z) / (s + s));
+  simd_t const big = (simd_t(pi::pio2_hi()) - (s + s)) + (simd_t(pi::pio2_lo()) - simd_t(T(2)) * fma(s, r, c));
+  return copysign(choose(is_small, fma(x, r, x), big), a);
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> acos(simd<T, Abi> const& a) {
+  using simd_t = simd<T, Abi>;
+  using pi = pi_constants<T>;
+  simd_t const x = abs(a);
+  auto const is_small = x < simd_t(T(0.5));
+  simd_t const z = choose(is_small, a * a, (simd_t(T(1)) - x) * simd_t(T(0.5)));
+  simd_t const r = asin_rational(z);
+  simd_t const s = sqrt(z);
+  // acos(a) = pi/2 - asin(a) near zero, 2 asin(s) for a > 1/2, pi - 2 asin(s) for a < -1/2
+  simd_t const small = simd_t(pi::pio2_hi()) - (a - (simd_t(pi::pio2_lo()) - a * r));
+  simd_t const positive = simd_t(T(2)) * fma(s, r, s);
+  simd_t const negative = simd_t(pi::pi_hi()) - simd_t(T(2)) * (s + (s * r - simd_t(pi::pio2_lo())));
+  return choose(is_small, small, choose(a < simd_t(T(0)), negative, positive));
+}
+
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> atan(simd<T, Abi> const& a) {
+  return impl::atan(a);
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> atan2(simd<T, Abi> const& y, simd<T, Abi> const& x) {
+  return impl::atan2(y, x);
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> asin(simd<T, Abi> const& a) {
+  return impl::asin(a);
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> acos(simd<T, Abi> const& a) {
+  return impl::acos(a);
+}
+
+namespace impl {
+
+/* Error-free products, barring overflow.  With FMA hardware (the
+   detection sse.hpp and avx.hpp use; NEON and VSX always fuse) the
+   rounding error of a * b is a single fma; otherwise it comes from
+   Dekker's product on a Veltkamp split.  The compiler may contract a
+   plain product into a later addition, so a residual c - a * b is
+   formed inside one call rather than from a rounded a * b.
+ */
+
+#if defined(__FMA__) || defined(__AVX2__) || defined(__ARM_NEON) || defined(__VSX__)
+#define SIMD_EXACT_FMA
+#endif
+
+// a * b = hi + lo
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline void two_prod(
+    simd<T, Abi> const& a, simd<T, Abi> const& b, simd<T, Abi>& hi, simd<T, Abi>& lo) {
+  hi = a * b;
+#ifdef SIMD_EXACT_FMA
+  lo = fma(a, b, -hi);
+#else
+  using simd_t = simd<T, Abi>;
+  simd_t const splitter(T((1 << ((std::numeric_limits<T>::digits + 1) / 2)) + 1));
+  simd_t const ca = splitter * a;
+  simd_t const a_hi = ca - (ca - a);
+  simd_t const a_lo = a - a_hi;
+  simd_t const cb = splitter * b;
+  simd_t const b_hi = cb - (cb - b);
+  simd_t const b_lo = b - b_hi;
+  lo = ((a_hi * b_hi - hi) + a_hi * b_lo + a_lo * b_hi) + a_lo * b_lo;
+#endif
+}
+
+// c - a * b, exact when it is representable (c close to a * b)
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> exact_residual(
+    simd<T, Abi> const& c, simd<T, Abi> const& a, simd<T, Abi> const& b) {
+#ifdef SIMD_EXACT_FMA
+  return fma(-a, b, c);
+#else
+  simd<T, Abi> hi, lo;
+  two_prod(a, b, hi, lo);
+  return (c - hi) - lo;
+#endif
+}
+
+/* log(a) as an unevaluated sum hi + lo carrying about 2^-70 relative
+   error, for finite positive a.  The mantissa m in [1, 2) is divided by
+   the nearest of 1, 2^(1/3), 2^(2/3) and 2 (rounded to short binary
+   fractions whose logarithms are tabulated in two parts), so that
+   s = (m - c) / (m + c) stays below 0.058 and
+   log(m) = log(c) + 2s + s * R(s^2)
+   needs only a short polynomial; s and e * ln2 + log(c) are carried to
+   twice the working precision.
+ */
+
+template <class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline void log_decomposed(
+    simd<double, Abi> const& m, simd<double, Abi> const& e, simd<double, Abi>& hi, simd<double, Abi>& lo) {
+  using simd_t = simd<double, Abi>;
+  auto const above1 = simd_t(1.1223928122542481) < m;
+  auto const above2 = simd_t(1.4143443801404119) < m;
+  auto const above3 = simd_t(1.7820721786729066) < m;
+  simd_t const c = choose(above3, simd_t(2.0),
+      choose(above2, simd_t(1.587890625), choose(above1, simd_t(1.259765625), simd_t(1.0))));
+  simd_t const log_c_hi = choose(above3, simd_t(6.93147180369123816490e-01),
+      choose(above2, simd_t(4.62406484410166740417e-01), choose(above1, simd_t(2.30925691779702901840e-01), simd_t(0.0))));
+  simd_t const log_c_lo = choose(above3, simd_t(1.90821492927058770002e-10),
+      choose(above2, simd_t(9.81360663195457517763e-11), choose(above1, simd_t(-2.34381971264519709592e-11), simd_t(0.0))));
+  simd_t const f = m - c;
+  simd_t const d = m + c;
+  simd_t const d_lo = (c - d) + m;
+  simd_t const s = f / d;
+  simd_t const s_lo = (exact_residual(f, s, d) - s * d_lo) / d;
+  simd_t const z = s * s;
+  simd_t R = fma(z, simd_t(1.83116629205350905929e-01), simd_t(2.22218399023606683063e-01));
+  R = fma(z, R, simd_t(2.85714290305227380795e-01));
+  R = fma(z, R, simd_t(3.99999999998071231744e-01));
+  R = fma(z, R, simd_t(6.66666666666666851704e-01));
+  R = R * z;
+  // ln2_hi and log_c_hi have 32 significant bits, so t is exact
+  simd_t const t = fma(e, simd_t(6.93147180369123816490e-01), log_c_hi);
+  simd_t const u = s + s;
+  simd_t const sum = t + u;
+  simd_t const u_part = sum - t;
+  simd_t const tail = ((t - (sum - u_part)) + (u - u_part))
+    + (fma(s, R, s_lo + s_lo) + fma(e, simd_t(1.90821492927058770002e-10), log_c_lo));
+  hi = sum + tail;
+  lo = (sum - hi) + tail;
+}
+
+template <class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline void log_decomposed(
+    simd<float, Abi> const& m, simd<float, Abi> const& e, simd<float, Abi>& hi, simd<float, Abi>& lo) {
+  using simd_t = simd<float, Abi>;
+  auto const above1 = simd_t(1.12239281f) < m;
+  auto const above2 = simd_t(1.41434438f) < m;
+  auto const above3 = simd_t(1.78207218f) < m;
+  simd_t const c = choose(above3, simd_t(2.0f),
+      choose(above2, simd_t(1.587890625f), choose(above1, simd_t(1.259765625f), simd_t(1.0f))));
+  simd_t const log_c_hi = choose(above3, simd_t(0.693145751953125f),
+      choose(above2, simd_t(0.46240234375f), choose(above1, simd_t(0.230926513671875f), simd_t(0.0f))));
+  simd_t const log_c_lo = choose(above3, simd_t(1.428606765330187045e-06f),
+      choose(above2, simd_t(4.140758392168e-06f), choose(above1, simd_t(-8.219155915867e-07f), simd_t(0.0f))));
+  simd_t const f = m - c;
+  simd_t const d = m + c;
+  simd_t const d_lo = (c - d) + m;
+  simd_t const s = f / d;
+  simd_t const s_lo = (exact_residual(f, s, d) - s * d_lo) / d;
+  simd_t const z = s * s;
+  simd_t const R = z * fma(z, simd_t(4.0096220374e-01f), simd_t(6.6666626930e-01f));
+  // ln2_hi and log_c_hi are multiples of 2^-15, so t is exact
+  simd_t const t = fma(e, simd_t(0.693145751953125f), log_c_hi);
+  simd_t const u = s + s;
+  simd_t const sum = t + u;
+  simd_t const u_part = sum - t;
+  simd_t const tail = ((t - (sum - u_part)) + (u - u_part))
+    + (fma(s, R, s_lo + s_lo) + fma(e, simd_t(1.428606765330187045e-06f), log_c_lo));
+  hi = sum + tail;
+  lo = (sum - hi) + tail;
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline void log(simd<T, Abi> const& a, simd<T, Abi>& hi, simd<T, Abi>& lo) {
+  simd<T, Abi> m, e;
+  decompose(a, m, e);
+  log_decomposed(m, e, hi, lo);
+}
+
+/* pow(a, b) = exp(b * log|a|) with log|a| and the product carried to
+   twice the working precision, so large b * log|a| keep their accuracy.
+   Zeros, infinities, negative bases and NaN follow C99 Annex F.
+ */
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> pow(simd<T, Abi> const& a, simd<T, Abi> const& b) {
+  using simd_t = simd<T, Abi>;
+  simd_t const zero(T(0));
+  simd_t const one(T(1));
+  simd_t const inf(std::numeric_limits<T>::infinity());
+  simd_t const x = abs(a);
+  simd_t log_hi, log_lo;
+  impl::log(x, log_hi, log_lo);
+  simd_t y_hi, y_lo;
+  two_prod(b, log_hi, y_hi, y_lo);
+  y_lo = fma(b, log_lo, y_lo);
+  simd_t result = impl::exp(y_hi, y_lo);
+  // b * log|a| is infinite: the result overflows or underflows
+  auto const is_extreme = (x == zero) || (x == inf) || (abs(b) == inf);
+  auto const grows = ((one < x) && (zero < b)) || ((x < one) && (b < zero));
+  result = choose(is_extreme, choose(grows, inf, zero), result);
+  result = choose(x == one, one, result);
+  auto const is_integer = roundeven(b) == b;
+  simd_t const half_b = b * simd_t(T(0.5));
+  auto const is_odd = is_integer && !(roundeven(half_b) == half_b);
+  // copysign rather than -result, which is 0 - result on some ABIs and loses -0
+  result = choose(is_odd, copysign(result, a), result);
+  result = choose((a < zero) && (-inf < a) && !is_integer, simd_t(std::numeric_limits<T>::quiet_NaN()), result);
+  result = choose((a == a) && (b == b), result, a + b);
+  return choose((b == zero) || (a == one), one, result);
+}
+
+// x^N by repeated squaring, unrolled at compile time
+template <int N, bool = (N < 0)>
+struct integer_pow {
+  template <class Simd>
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE static inline Simd apply(Simd const& x) {
+    Simd const half = integer_pow<N / 2>::apply(x);
+    return (N % 2 == 1) ? half * half * x : half * half;
+  }
+};
+
+template <int N>
+struct integer_pow<N, true> {
+  template <class Simd>
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE static inline Simd apply(Simd const& x) {
+    return Simd(typename Simd::value_type(1)) / integer_pow<-N>::apply(x);
+  }
+};
+
+template <>
+struct integer_pow<1, false> {
+  template <class Simd>
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE static inline Simd apply(Simd const& x) {
+    return x;
+  }
+};
+
+template <>
+struct integer_pow<0, false> {
+  template <class Simd>
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE static inline Simd apply(Simd const&) {
+    return Simd(typename Simd::value_type(1));
+  }
+};
+
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> pow(simd<T, Abi> const& a, simd<T, Abi> const& b) {
+  return impl::pow(a, b);
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> pow(simd<T, Abi> const& a, T const& b) {
+  return pow(a, simd<T, Abi>(b));
+}
+
+// pow(a, N) for a compile-time integer N as a chain of multiplications
+template <int N, class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> pow(simd<T, Abi> const& a) {
+  return impl::integer_pow<N>::apply(a);
+}
+
+namespace impl {
+
+/* Kernels behind the fast accuracy tier (see the fast namespace in simd.hpp).
+   They share the range reductions of exp and log above but use shorter
+   polynomials, skip the subnormal handling and, for float log, the division.
+ */
+
+template <class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<double, Abi> fast_exp(simd<double, Abi> const& a) {
+  using simd_t = simd<double, Abi>;
+  simd_t const x = max(simd_t(-708.0), min(simd_t(709.782712893384), a));
+  simd_t const n = roundeven(x * simd_t(1.4426950408889634));
+  simd_t r = fma(n, simd_t(-6.93147180369123816490e-01), x);
+  r = fma(n, simd_t(-1.90821492927058770002e-10), r);
+  // Chebyshev interpolant of (exp(r) - 1 - r) / r^2 on |r| <= ln2 / 2
+  simd_t p(2.51003831958670213e-08);
+  p = fma(p, r, simd_t(2.76200854550184136e-07));
+  p = fma(p, r, simd_t(2.75572684648316275e-06));
+  p = fma(p, r, simd_t(2.48015213022410817e-05));
+  p = fma(p, r, simd_t(1.98412698630505061e-04));
+  p = fma(p, r, simd_t(1.38888889172096705e-03));
+  p = fma(p, r, simd_t(8.33333333333006326e-03));
+  p = fma(p, r, simd_t(4.16666666666241359e-02));
+  p = fma(p, r, simd_t(1.66666666666666685e-01));
+  p = fma(p, r, simd_t(5.00000000000000111e-01));
+  p = fma(p, r * r, r) + simd_t(1.0);
+  // n - 1 keeps 2^n within the normal range at the overflow threshold
+  simd_t result = p * pow2i(n - simd_t(1.0)) * simd_t(2.0);
+  result = choose(a < simd_t(-708.0), simd_t(0.0), result);
+  result = choose(simd_t(709.782712893384) < a, simd_t(std::numeric_limits<double>::infinity()), result);
+  return choose(a == a, result, a);
+}
+
+template <class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<float, Abi> fast_exp(simd<float, Abi> const& a) {
+  using simd_t = simd<float, Abi>;
+  // clamping at -86.5 keeps n >= -125, so that 2^(n - 1) stays normal
+  simd_t const x = max(simd_t(-86.5f), min(simd_t(88.7228394f), a));
+  simd_t const n = roundeven(x * simd_t(1.44269504088896341f));
+  simd_t r = fma(n, simd_t(-0.693359375f), x);
+  r = fma(n, simd_t(2.12194440e-4f), r);
+  simd_t p(1.3926181709e-3f);
+  p = fma(p, r, simd_t(8.3631779999e-3f));
+  p = fma(p, r, simd_t(4.1666556150e-2f));
+  p = fma(p, r, simd_t(1.6666576266e-1f));
+  p = fma(p, r, simd_t(0.5f));
+  p = fma(p, r * r, r) + simd_t(1.0f);
+  simd_t result = p * pow2i(n - simd_t(1.0f)) * simd_t(2.0f);
+  result = choose(a < simd_t(-86.5f), simd_t(0.0f), result);
+  result = choose(simd_t(88.7228394f) < a, simd_t(std::numeric_limits<float>::infinity()), result);
+  return choose(a == a, result, a);
+}
+
+template <class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<double, Abi> fast_log(simd<double, Abi> const& a) {
+  using simd_t = simd<double, Abi>;
+  auto const is_zero = a < simd_t(std::numeric_limits<double>::min());
+  simd_t const x = choose(is_zero, simd_t(1.0), a);
+  simd_t m = getmant(x);
+  simd_t e = getexp(x);
+  auto const is_big = simd_t(1.4142135623730951) < m;
+  m = choose(is_big, m * simd_t(0.5), m);
+  e = choose(is_big, e + simd_t(1.0), e);
+  simd_t const f = m - simd_t(1.0);
+  simd_t const s = f / (simd_t(2.0) + f);
+  simd_t const z = s * s;
+  simd_t const w = z * z;
+  simd_t t1 = fma(w, simd_t(1.531383769920937332e-01), simd_t(2.222219843214978396e-01));
+  t1 = fma(w, t1, simd_t(3.999999999940941908e-01));
+  t1 = t1 * w;
+  simd_t t2 = fma(w, simd_t(1.479819860511658591e-01), simd_t(1.818357216161805012e-01));
+  t2 = fma(w, t2, simd_t(2.857142874366239149e-01));
+  t2 = fma(w, t2, simd_t(6.666666666666735130e-01));
+  t2 = t2 * z;
+  simd_t const R = t1 + t2;
+  simd_t const hfsq = simd_t(0.5) * f * f;
+  simd_t result = fma(s, hfsq + R, e * simd_t(1.90821492927058770002e-10));
+  result = fma(e, simd_t(6.93147180369123816490e-01), f - (hfsq - result));
+  result = choose(a == simd_t(std::numeric_limits<double>::infinity()), a, result);
+  result = choose(is_zero, simd_t(-std::numeric_limits<double>::infinity()), result);
+  return choose(a < simd_t(0.0) || !(a == a), simd_t(std::numeric_limits<double>::quiet_NaN()), result);
+}
+
+template <class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<float, Abi> fast_log(simd<float, Abi> const& a) {
+  using simd_t = simd<float, Abi>;
+  auto const is_zero = a < simd_t(std::numeric_limits<float>::min());
+  simd_t const x = choose(is_zero, simd_t(1.0f), a);
+  simd_t m = getmant(x);
+  simd_t e = getexp(x);
+  auto const is_big = simd_t(1.41421356f) < m;
+  m = choose(is_big, m * simd_t(0.5f), m);
+  e = choose(is_big, e + simd_t(1.0f), e);
+  simd_t const f = m - simd_t(1.0f);
+  // log(1 + f) = f - f^2/2 + f^3 * P(f), a polynomial in f needing no division
+  simd_t p(-7.9027436674e-2f);
+  p = fma(p, f, simd_t(1.2622319162e-1f));
+  p = fma(p, f, simd_t(-1.2998183072e-1f));
+  p = fma(p, f, simd_t(1.4214496315e-1f));
+  p = fma(p, f, simd_t(-1.6641281545e-1f));
+  p = fma(p, f, simd_t(2.0001044869e-1f));
+  p = fma(p, f, simd_t(-2.5000306964e-1f));
+  p = fma(p, f, simd_t(3.3333331347e-1f));
+  simd_t const z = f * f;
+  simd_t result = fma(z * f, p, e * simd_t(9.0580006145e-06f));
+  result = fma(z, simd_t(-0.5f), result) + f;
+  result = fma(e, simd_t(6.9313812256e-01f), result);
+  result = choose(a == simd_t(std::numeric_limits<float>::infinity()), a, result);
+  result = choose(is_zero, simd_t(-std::numeric_limits<float>::infinity()), result);
+  return choose(a < simd_t(0.0f) || !(a == a), simd_t(std::numeric_limits<float>::quiet_NaN()), result);
+}
+
+}
+
+namespace impl {
+
+// Newton-Raphson steps taking an estimate to within about two bits of T's precision
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline constexpr int newton_steps(int bits, int target) {
+  return bits >= target ? 0 : 1 + newton_steps(2 * bits, target);
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline constexpr int default_newton_steps() {
+  return newton_steps(reciprocal_estimate_bits(static_cast<simd<T, Abi> const*>(nullptr)), std::numeric_limits<T>::digits - 2);
+}
+
+}
+
+/* 1/a and 1/sqrt(a) from the ABI's estimate instruction followed by
+   NewtonSteps Newton-Raphson steps, each of which roughly doubles the
+   number of correct bits.  Without NewtonSteps, enough steps are taken to
+   land within a few ulp.  Zeros and infinities come out as they would
+   from 1/a and 1/sqrt(a); subnormal arguments and results may be flushed.
+ */
+
+template <int NewtonSteps, class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> rcp(simd<T, Abi> const& a) {
+  using simd_t = simd<T, Abi>;
+  simd_t const estimate = rcp_estimate(a);
+  simd_t x = estimate;
+  for (int i = 0; i < NewtonSteps; ++i) {
+    simd_t const e = fma(-a, x, simd_t(T(1)));
+    x = fma(x, e, x);
+  }
+  // a zero or infinite a turns the step into 0 * inf
+  return choose(x == x, x, estimate);
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> rcp(simd<T, Abi> const& a) {
+  return rcp<impl::default_newton_steps<T, Abi>()>(a);
+}
+
+template <int NewtonSteps, class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> rsqrt(simd<T, Abi> const& a) {
+  using simd_t = simd<T, Abi>;
+  simd_t const estimate = rsqrt_estimate(a);
+  simd_t x = estimate;
+  for (int i = 0; i < NewtonSteps; ++i) {
+    simd_t const e = fma(-(a * x), x, simd_t(T(1)));
+    x = fma(x * simd_t(T(0.5)), e, x);
+  }
+  // the estimates take negative subnormals for -0 and give -inf
+  x = choose(x == x, x, estimate);
+  return choose(a < simd_t(T(0)), simd_t(std::numeric_limits<T>::quiet_NaN()), x);
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> rsqrt(simd<T, Abi> const& a) {
+  return rsqrt<impl::default_newton_steps<T, Abi>()>(a);
+}
+
+/* a / b as a * rcp(b), off by a few ulp.  Where |b| >= 2^(max_exponent - 2)
+   1/b is subnormal, which the estimates flush to zero, so there b is
+   scaled by 1/4 before the reciprocal and the quotient after it.  The
+   quotient may still overflow early when b is subnormal.
+ */
+template <int NewtonSteps, class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> fast_div(simd<T, Abi> const& a, simd<T, Abi> const& b) {
+  using simd_t = simd<T, Abi>;
+  auto const is_huge = simd_t(T(1) / std::numeric_limits<T>::min()) <= abs(b);
+  simd_t const scale = choose(is_huge, simd_t(T(0.25)), simd_t(T(1)));
+  return (a * rcp<NewtonSteps>(b * scale)) * scale;
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> fast_div(simd<T, Abi> const& a, simd<T, Abi> const& b) {
+  return fast_div<impl::default_newton_steps<T, Abi>()>(a, b);
+}
+
+namespace impl {
+
+/* cbrt(a) = 2^q * cbrt(y) with the exponent of |a| split as 3q + r,
+   r in {0, 1, 2}, and y = 2^r * m for the mantissa m in [1, 2).
+   A cubic fit of cbrt(m), good to 13 bits and scaled by 2^(r/3), is
+   refined by Halley steps g += g * (y - g^3) / (2g^3 + y), each of which
+   triples the number of correct bits.  The residual y - g^3 is carried to
+   twice the working precision so that the last step rounds well.
+ */
+
+// the seed g for a normal x = 2^e * m, along with y and q
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> cbrt_seed(
+    simd<T, Abi> const& e, simd<T, Abi> const& m, simd<T, Abi>* y, simd<T, Abi>* q) {
+  using simd_t = simd<T, Abi>;
+  // (e - 1) / 3 is never within 1/3 of a half-integer, so rounding it gives floor(e / 3)
+  *q = roundeven((e - simd_t(T(1))) * simd_t(T(1) / T(3)));
+  simd_t const r = fma(*q, simd_t(T(-3)), e);
+  auto const r_is_1 = r == simd_t(T(1));
+  auto const r_is_2 = r == simd_t(T(2));
+  *y = m * choose(r_is_2, simd_t(T(4)), choose(r_is_1, simd_t(T(2)), simd_t(T(1))));
+  simd_t g = fma(m, simd_t(T(0.022148699208245193)), simd_t(T(-0.1586624600531909)));
+  g = fma(m, g, simd_t(T(0.5808263911380952)));
+  g = fma(m, g, simd_t(T(0.55579096026913877)));
+  return g * choose(r_is_2, simd_t(T(1.5874010519681994)), choose(r_is_1, simd_t(T(1.2599210498948732)), simd_t(T(1))));
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> cbrt(simd<T, Abi> const& a) {
+  using simd_t = simd<T, Abi>;
+  // scaling subnormals by 2^k, k a multiple of 3, keeps cbrt(2^k) exact
+  constexpr int k = 3 * ((std::numeric_limits<T>::digits + 2) / 3);
+  simd_t const x = abs(a);
+  auto const is_subnormal = x < simd_t(std::numeric_limits<T>::min());
+  simd_t const xs = choose(is_subnormal, x * simd_t(T(1ull << k)), x);
+  simd_t const e = getexp(xs) - choose(is_subnormal, simd_t(T(k)), simd_t(T(0)));
+  simd_t y, q;
+  simd_t g = cbrt_seed(e, getmant(xs), &y, &q);
+  for (int i = 0; i < (std::numeric_limits<T>::digits > 39 ? 2 : 1); ++i) {
+    simd_t const gg = g * g;
+    simd_t const residual = fma(exact_residual(gg, g, g), g, exact_residual(y, gg, g));
+    g = fma(g, residual / fma(simd_t(T(2)) * gg, g, y), g);
+  }
+  simd_t const result = copysign(g * pow2i(q), a);
+  // zeros, infinities and NaN are their own cube roots
+  return choose(x == simd_t(T(0)) || !(x < simd_t(std::numeric_limits<T>::infinity())), a, result);
+}
+
+// the same steps with a plain residual, and subnormal arguments taken as zeros
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> fast_cbrt(simd<T, Abi> const& a) {
+  using simd_t = simd<T, Abi>;
+  simd_t const x = abs(a);
+  simd_t y, q;
+  simd_t g = cbrt_seed(getexp(x), getmant(x), &y, &q);
+  for (int i = 0; i < (std::numeric_limits<T>::digits > 39 ? 2 : 1); ++i) {
+    simd_t const gg = g * g;
+    g = fma(g, fma(-gg, g, y) / fma(simd_t(T(2)) * gg, g, y), g);
+  }
+  simd_t result = copysign(g * pow2i(q), a);
+  result = choose(x < simd_t(std::numeric_limits<T>::min()), a * simd_t(T(0)), result);
+  return choose(x < simd_t(std::numeric_limits<T>::infinity()), result, a);
+}
+
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> cbrt(simd<T, Abi> const& a) {
+  return impl::cbrt(a);
+}
+
+namespace impl {
+
+/* sinh, cosh and tanh.  Small arguments use odd minimax fits in x^2;
+   elsewhere everything comes from h = e^|x| / 2, computed as
+   exp(|x| - ln2) so that it stays finite wherever sinh and cosh do.
+ */
+
+template <class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<double, Abi> sinh_small(simd<double, Abi> const& x) {
+  using simd_t = simd<double, Abi>;
+  simd_t const z = x * x;
+  simd_t p(7.746178593018827e-13);
+  p = fma(p, z, simd_t(1.6057679623801638e-10));
+  p = fma(p, z, simd_t(2.5052117695907823e-08));
+  p = fma(p, z, simd_t(2.7557319191381816e-06));
+  p = fma(p, z, simd_t(0.00019841269841324198));
+  p = fma(p, z, simd_t(0.008333333333333299));
+  p = fma(p, z, simd_t(0.16666666666666666));
+  return fma(x * z, p, x);
+}
+
+template <class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<float, Abi> sinh_small(simd<float, Abi> const& x) {
+  using simd_t = simd<float, Abi>;
+  simd_t const z = x * x;
+  simd_t p(2.80628024e-06f);
+  p = fma(p, z, simd_t(0.000198381022f));
+  p = fma(p, z, simd_t(0.00833333936f));
+  p = fma(p, z, simd_t(0.166666672f));
+  return fma(x * z, p, x);
+}
+
+template <class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<double, Abi> tanh_small(simd<double, Abi> const& x) {
+  using simd_t = simd<double, Abi>;
+  simd_t const z = x * x;
+  simd_t p(-0.0001991780435861287);
+  p = fma(p, z, simd_t(-0.020498799708498872));
+  p = fma(p, z, simd_t(-0.3333333333333333));
+  simd_t q(0.0002065337374875025);
+  q = fma(q, z, simd_t(0.02329133187629886));
+  q = fma(q, z, simd_t(0.4614963991254931));
+  q = fma(q, z, simd_t(1.0));
+  return fma(x * z, p / q, x);
+}
+
+template <class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<float, Abi> tanh_small(simd<float, Abi> const& x) {
+  using simd_t = simd<float, Abi>;
+  simd_t const z = x * x;
+  simd_t p(0.00229274482f);
+  p = fma(p, z, simd_t(-0.00834394526f));
+  p = fma(p, z, simd_t(0.0217689183f));
+  p = fma(p, z, simd_t(-0.0539592579f));
+  p = fma(p, z, simd_t(0.133333042f));
+  p = fma(p, z, simd_t(-0.333333343f));
+  return fma(x * z, p, x);
+}
+
+// |x| - ln2_hi is exact for |x| >= 1, where sinh relies on h alone
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> half_exp(simd<T, Abi> const& ax) {
+  using simd_t = simd<T, Abi>;
+  return impl::exp(ax - simd_t(ln2_hi(T())), simd_t(-ln2_lo(T())));
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> sinh(simd<T, Abi> const& a) {
+  using simd_t = simd<T, Abi>;
+  simd_t const ax = abs(a);
+  simd_t const h = impl::half_exp(ax);
+  simd_t const big = copysign(h - simd_t(T(0.25)) / h, a);
+  return choose(ax < simd_t(T(1)), impl::sinh_small(a), big);
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> cosh(simd<T, Abi> const& a) {
+  using simd_t = simd<T, Abi>;
+  simd_t const h = impl::half_exp(abs(a));
+  return h + simd_t(T(0.25)) / h;
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> tanh(simd<T, Abi> const& a) {
+  using simd_t = simd<T, Abi>;
+  simd_t const ax = abs(a);
+  // exp overflows to infinity well after tanh has rounded to 1
+  simd_t const big = simd_t(T(1)) - simd_t(T(2)) / (impl::exp(ax + ax) + simd_t(T(1)));
+  // the fit is odd in x, but its p < 0 would turn -0 into +0
+  return copysign(choose(ax < simd_t(T(0.625)), impl::tanh_small(ax), big), a);
+}
+
+/* erf and erfc follow the fdlibm split of |x| into
+     [0, 0.84375):    erf = x + x * P(x^2) / Q(x^2)
+     [0.84375, 1.25): erf = erx + P(s) / Q(s), s = |x| - 1
+     [1.25, cutoff):  erfc = exp(-x^2 - 0.5625 + R(1/x^2) / S(1/x^2)) / |x|
+   with R / S fitted separately below and above 1/0.35.  Each pair of
+   regions shares one rational whose coefficients are picked per lane, so
+   there is a single division and no branch.  x^2 in the exponent is
+   carried as z^2 + (x - z)(x + z) for a z with half as many bits as x,
+   which keeps the large exponent exact.
+ */
+
+template <class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<double, Abi> erf_rational(simd<double, Abi> const& ax, simd_mask<double, Abi> const& is_small) {
+  using simd_t = simd<double, Abi>;
+  simd_t const t = choose(is_small, ax * ax, ax - simd_t(1.0));
+  simd_t p = choose(is_small, simd_t(0.0), simd_t(-0.0021384725717794053));
+  p = fma(p, t, choose(is_small, simd_t(0.0), simd_t(0.035196813339774105)));
+  p = fma(p, t, choose(is_small, simd_t(-2.46830285454317e-05), simd_t(-0.11040724555759479)));
+  p = fma(p, t, choose(is_small, simd_t(-0.0057755160404937885), simd_t(0.3174963374553275)));
+  p = fma(p, t, choose(is_small, simd_t(-0.02854218716531547), simd_t(-0.3720996478587144)));
+  p = fma(p, t, choose(is_small, simd_t(-0.325018252562454), simd_t(0.41485552704511164)));
+  p = fma(p, t, choose(is_small, simd_t(0.12837916709551256), simd_t(-0.00236211856075266)));
+  simd_t q = choose(is_small, simd_t(0.0), simd_t(0.011890635173064644));
+  q = fma(q, t, choose(is_small, simd_t(-3.948101677256517e-06), simd_t(0.013448268959373897)));
+  q = fma(q, t, choose(is_small, simd_t(0.00013327940528704374), simd_t(0.12533500935482428)));
+  q = fma(q, t, choose(is_small, simd_t(0.005092835529299097), simd_t(0.07111273013053433)));
+  q = fma(q, t, choose(is_small, simd_t(0.06509587619051482), simd_t(0.5385959705333492)));
+  q = fma(q, t, choose(is_small, simd_t(0.3981030382550957), simd_t(0.10667134989315517)));
+  q = fma(q, t, simd_t(1.0));
+  return p / q;
+}
+
+template <class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<double, Abi> erfc_rational(simd<double, Abi> const& ax) {
+  using simd_t = simd<double, Abi>;
+  auto const is_near = ax < simd_t(2.857142857142857);
+  simd_t const t = simd_t(1.0) / (ax * ax);
+  simd_t p = choose(is_near, simd_t(-6.569763424467585), simd_t(0.0));
+  p = fma(p, t, choose(is_near, simd_t(-58.906375461865785), simd_t(-396.5572377451829)));
+  p = fma(p, t, choose(is_near, simd_t(-144.17809722637867), simd_t(-880.8244770598254)));
+  p = fma(p, t, choose(is_near, simd_t(-135.95256700233892), simd_t(-571.1111068594341)));
+  p = fma(p, t, choose(is_near, simd_t(-55.61562370754902), simd_t(-149.36357042086956)));
+  p = fma(p, t, choose(is_near, simd_t(-9.952494834720612), simd_t(-17.06856034418432)));
+  p = fma(p, t, choose(is_near, simd_t(-0.6845145642394083), simd_t(-0.7897373653273387)));
+  p = fma(p, t, choose(is_near, simd_t(-0.009864945292581005), simd_t(-0.00986494292470017)));
+  simd_t q = choose(is_near, simd_t(-0.036126714729646084), simd_t(0.0));
+  q = fma(q, t, choose(is_near, simd_t(4.311162715435034), simd_t(-17.065962337819567)));
+  q = fma(q, t, choose(is_near, simd_t(76.29936998417766), simd_t(383.45848955738677)));
+  q = fma(q, t, choose(is_near, simd_t(322.36487460947626), simd_t(2141.7095922396406)));
+  q = fma(q, t, choose(is_near, simd_t(517.3659341364272), simd_t(2788.1932855531645)));
+  q = fma(q, t, choose(is_near, simd_t(370.3260045338826), simd_t(1388.877014637679)));
+  q = fma(q, t, choose(is_near, simd_t(124.22197882707225), simd_t(304.95442834984436)));
+  q = fma(q, t, choose(is_near, simd_t(18.704088036808614), simd_t(29.370404627682383)));
+  q = fma(q, t, simd_t(1.0));
+  return p / q;
+}
+
+template <class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<float, Abi> erf_rational(simd<float, Abi> const& ax, simd_mask<float, Abi> const& is_small) {
+  using simd_t = simd<float, Abi>;
+  simd_t const t = choose(is_small, ax * ax, ax - simd_t(1.0f));
+  simd_t p = choose(is_small, simd_t(0.0f), simd_t(0.0864872709f));
+  p = fma(p, t, choose(is_small, simd_t(-0.0019753098f), simd_t(-0.209377676f)));
+  p = fma(p, t, choose(is_small, simd_t(-0.335987419f), simd_t(0.413931787f)));
+  p = fma(p, t, choose(is_small, simd_t(0.128379166f), simd_t(-0.0023621174f)));
+  simd_t q = choose(is_small, simd_t(-0.00198290171f), simd_t(0.0402413644f));
+  q = fma(q, t, choose(is_small, simd_t(0.0217101108f), simd_t(0.372973323f)));
+  q = fma(q, t, choose(is_small, simd_t(0.312658936f), simd_t(0.497730106f)));
+  q = fma(q, t, simd_t(1.0f));
+  return p / q;
+}
+
+template <class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<float, Abi> erfc_rational(simd<float, Abi> const& ax) {
+  using simd_t = simd<float, Abi>;
+  auto const is_near = ax < simd_t(2.857142857142857f);
+  simd_t const t = simd_t(1.0f) / (ax * ax);
+  simd_t p = choose(is_near, simd_t(-0.739540994f), simd_t(0.0f));
+  p = fma(p, t, choose(is_near, simd_t(-3.53624272f), simd_t(-3.19249678f)));
+  p = fma(p, t, choose(is_near, simd_t(-2.97354341f), simd_t(-3.28496838f)));
+  p = fma(p, t, choose(is_near, simd_t(-0.568399787f), simd_t(-0.574669182f)));
+  p = fma(p, t, choose(is_near, simd_t(-0.00986727979f), simd_t(-0.00986494683f)));
+  simd_t q = choose(is_near, simd_t(0.509164453f), simd_t(0.0f));
+  q = fma(q, t, choose(is_near, simd_t(6.2039752f), simd_t(3.43083429f)));
+  q = fma(q, t, choose(is_near, simd_t(12.6066628f), simd_t(12.7008667f)));
+  q = fma(q, t, choose(is_near, simd_t(6.94403887f), simd_t(7.56922388f)));
+  q = fma(q, t, simd_t(1.0f));
+  return p / q;
+}
+
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline constexpr double erx(double) { return 8.45062911510467529297e-01; }
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline constexpr float erx(float) { return 8.45062911510467529297e-01f; }
+// erfc underflows to zero past the cutoff
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline constexpr double erfc_cutoff(double) { return 28.0; }
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline constexpr float erfc_cutoff(float) { return 10.1f; }
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline constexpr double erfc_split(double) { return 65536.0; }
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline constexpr float erfc_split(float) { return 256.0f; }
+
+// erfc(|x|) for |x| >= 1.25
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> erfc_tail(simd<T, Abi> const& ax) {
+  using simd_t = simd<T, Abi>;
+  simd_t const x = min(ax, simd_t(erfc_cutoff(T())));
+  simd_t const z = roundeven(x * simd_t(erfc_split(T()))) * simd_t(T(1) / erfc_split(T()));
+  simd_t const r = impl::exp(-(z * z) - simd_t(T(0.5625))) * impl::exp(fma(z - x, z + x, impl::erfc_rational(x)));
+  return r / x;
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> erf(simd<T, Abi> const& a) {
+  using simd_t = simd<T, Abi>;
+  simd_t const ax = abs(a);
+  auto const is_small = ax < simd_t(T(0.84375));
+  simd_t const q = impl::erf_rational(ax, is_small);
+  simd_t const near = choose(is_small, fma(ax, q, ax), simd_t(erx(T())) + q);
+  simd_t const result = choose(ax < simd_t(T(1.25)), near, simd_t(T(1)) - impl::erfc_tail(ax));
+  return choose(a == a, copysign(result, a), a);
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> erfc(simd<T, Abi> const& a) {
+  using simd_t = simd<T, Abi>;
+  simd_t const ax = abs(a);
+  simd_t const one(T(1));
+  auto const is_small = ax < simd_t(T(0.84375));
+  auto const is_negative = a < simd_t(T(0));
+  simd_t const q = impl::erf_rational(ax, is_small);
+  // 1 - erf(a) loses bits once erf(a) passes 1/4; 0.5 - (erf(a) - 0.5) does not
+  simd_t const small = choose(a < simd_t(T(0.25)), one - fma(a, q, a), simd_t(T(0.5)) - fma(a, q, a - simd_t(T(0.5))));
+  simd_t const e = simd_t(erx(T()));
+  simd_t const near = choose(is_negative, one + (e + q), (one - e) - q);
+  simd_t const r = impl::erfc_tail(ax);
+  simd_t const tail = choose(is_negative, simd_t(T(2)) - r, r);
+  simd_t const result = choose(is_small, small, choose(ax < simd_t(T(1.25)), near, tail));
+  return choose(a == a, result, a);
+}
+
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> sinh(simd<T, Abi> const& a) {
+  return impl::sinh(a);
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> cosh(simd<T, Abi> const& a) {
+  return impl::cosh(a);
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> tanh(simd<T, Abi> const& a) {
+  return impl::tanh(a);
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> erf(simd<T, Abi> const& a) {
+  return impl::erf(a);
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> erfc(simd<T, Abi> const& a) {
+  return impl::erfc(a);
+}
+
+namespace impl {
+
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline constexpr double ivln2_hi(double) { return 1.4426950408889634; }
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline constexpr float ivln2_hi(float) { return 1.44269502f; }
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline constexpr double ivln2_lo(double) { return 2.0355273740931033e-17; }
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline constexpr float ivln2_lo(float) { return 1.92596303e-08f; }
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline constexpr double ivln10_hi(double) { return 0.4342944819032518; }
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline constexpr float ivln10_hi(float) { return 0.434294492f; }
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline constexpr double ivln10_lo(double) { return 1.098319650216765e-17; }
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline constexpr float ivln10_lo(float) { return -1.010305e-08f; }
+
+/* log2 and log10 scale the twice-precise log(a) = hi + lo by 1/ln2 or
+   1/ln10, itself split in two parts, so that only the final sum rounds.
+ */
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> scaled_log(
+    simd<T, Abi> const& m, simd<T, Abi> const& e, simd<T, Abi> const& scale_hi, simd<T, Abi> const& scale_lo) {
+  simd<T, Abi> hi, lo, y_hi, y_lo;
+  log_decomposed(m, e, hi, lo);
+  two_prod(hi, scale_hi, y_hi, y_lo);
+  return y_hi + fma(hi, scale_lo, fma(lo, scale_hi, y_lo));
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> log2(simd<T, Abi> const& a) {
+  using simd_t = simd<T, Abi>;
+  simd_t m, e;
+  decompose(a, m, e);
+  simd_t const result = impl::scaled_log(m, e, simd_t(ivln2_hi(T())), simd_t(ivln2_lo(T())));
+  // powers of two take their exponent as is
+  return log_specials(a, choose(m == simd_t(T(1)), e, result));
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> log10(simd<T, Abi> const& a) {
+  using simd_t = simd<T, Abi>;
+  simd_t m, e;
+  decompose(a, m, e);
+  return log_specials(a, impl::scaled_log(m, e, simd_t(ivln10_hi(T())), simd_t(ivln10_lo(T()))));
+}
+
+/* log1p(a) = log(u) + c / u for u = 1 + a rounded and c its rounding
+   error, which is what keeps log1p accurate near zero.
+ */
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> log1p(simd<T, Abi> const& a) {
+  using simd_t = simd<T, Abi>;
+  simd_t const one(T(1));
+  simd_t const u = one + a;
+  simd_t const a_part = u - one;
+  simd_t const c = (one - (u - a_part)) + (a - a_part);
+  simd_t hi, lo;
+  impl::log(u, hi, lo);
+  simd_t const result = hi + (lo + c / u);
+  return log_specials(u, choose(a == simd_t(T(0)), a, result));
+}
+
+/* expm1(a) = 2^n * (1 + p) - 1 = 2^n * (p + (1 - 2^-n)) with
+   a = n * ln2 + r and p = exp(r) - 1 from the polynomial behind exp.
+   Below -(digits + 2), expm1 has rounded to -1.
+ */
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> expm1(simd<T, Abi> const& a) {
+  using simd_t = simd<T, Abi>;
+  constexpr int digits = std::numeric_limits<T>::digits;
+  simd_t const x = max(simd_t(T(-(digits + 2))), min(simd_t(T(std::numeric_limits<T>::max_exponent)), a));
+  simd_t const n = roundeven(x * simd_t(ivln2_hi(T())));
+  simd_t r = fma(n, simd_t(-ln2_hi(T())), x);
+  r = fma(n, simd_t(-ln2_lo(T())), r);
+  simd_t const p = expm1_reduced(r);
+  // 1 - 2^-n is 1 once n exceeds the precision
+  simd_t const q = p + (simd_t(T(1)) - pow2i(-min(n, simd_t(T(digits + 2)))));
+  simd_t const n1 = roundeven(n * simd_t(T(0.5)));
+  simd_t const result = (q * pow2i(n1)) * pow2i(n - n1);
+  return choose(a == simd_t(T(0)) || !(a == a), a, result);
+}
+
+// exp2(a) = 2^n * exp((a - n) * ln2), exact for integral a
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> exp2(simd<T, Abi> const& a) {
+  using simd_t = simd<T, Abi>;
+  constexpr int lowest = std::numeric_limits<T>::min_exponent - std::numeric_limits<T>::digits - 1;
+  simd_t const x = max(simd_t(T(lowest)), min(simd_t(T(std::numeric_limits<T>::max_exponent)), a));
+  simd_t const n = roundeven(x);
+  simd_t const r = (x - n) * simd_t(T(0.6931471805599453));
+  return choose(a == a, exp_scaled(r, n), a);
+}
+
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> log2(simd<T, Abi> const& a) {
+  return impl::log2(a);
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> log10(simd<T, Abi> const& a) {
+  return impl::log10(a);
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> log1p(simd<T, Abi> const& a) {
+  return impl::log1p(a);
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> expm1(simd<T, Abi> const& a) {
+  return impl::expm1(a);
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> exp2(simd<T, Abi> const& a) {
+  return impl::exp2(a);
+}
+
+namespace impl {
+
+/* r mod d for finite r >= 0 and d > 0 by long division.  Each step takes
+   away the largest multiple of d * 2^k below r, with k chosen so that the
+   quotient has fewer bits than T; the residual is then exactly
+   representable and exact_residual finds it.  A step clears about
+   digits - 2 bits of the exponent gap between r and d.
+ */
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> fmod_positive(simd<T, Abi> r, simd<T, Abi> const& d) {
+  using simd_t = simd<T, Abi>;
+  constexpr int max_exponent = std::numeric_limits<T>::max_exponent;
+  simd_t const zero(T(0));
+  // large lanes are scaled down so that a split product cannot overflow
+  simd_t const big = pow2i(simd_t(T(max_exponent / 2)));
+  simd_t const down = pow2i(simd_t(T(-(max_exponent / 4))));
+  simd_t const up = pow2i(simd_t(T(max_exponent / 4)));
+  simd_t m, e_d, e_r;
+  decompose(d, m, e_d);
+  auto active = (d < r) || (d == r);
+  while (any_of(active)) {
+    decompose(r, m, e_r);
+    simd_t const k = max(zero, e_r - e_d - simd_t(T(std::numeric_limits<T>::digits - 2)));
+    simd_t const k1 = roundeven(k * simd_t(T(0.5)));
+    auto const is_big = big < r;
+    simd_t const scale = choose(is_big, down, simd_t(T(1)));
+    simd_t const rs = r * scale;
+    simd_t const dk = ((d * pow2i(k1)) * pow2i(k - k1)) * scale;
+    // r / dk may round up to the next integer, leaving one dk too many
+    simd_t const q = trunc(rs / dk);
+    simd_t next = exact_residual(rs, q, dk);
+    next = choose(next < zero, next + dk, next);
+    r = choose(active, next * choose(is_big, up, simd_t(T(1))), r);
+    active = (d < r) || (d == r);
+  }
+  return r;
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> fmod(simd<T, Abi> const& a, simd<T, Abi> const& b) {
+  using simd_t = simd<T, Abi>;
+  simd_t const x = abs(a);
+  simd_t const d = abs(b);
+  auto const is_valid = (x < simd_t(std::numeric_limits<T>::infinity())) && (simd_t(T(0)) < d);
+  simd_t const r = impl::fmod_positive(choose(is_valid, x, simd_t(T(0))), choose(is_valid, d, simd_t(T(1))));
+  return choose(is_valid, copysign(r, a), simd_t(std::numeric_limits<T>::quiet_NaN()));
+}
+
+// a - n * b for n the nearest integer to a / b, ties to even
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> remainder(simd<T, Abi> const& a, simd<T, Abi> const& b) {
+  using simd_t = simd<T, Abi>;
+  simd_t const x = abs(a);
+  auto const is_valid = (x < simd_t(std::numeric_limits<T>::infinity())) && (simd_t(T(0)) < abs(b));
+  simd_t const d = choose(is_valid, abs(b), simd_t(T(1)));
+  // reducing modulo 2d first tells whether the quotient is odd
+  simd_t r = impl::fmod_positive(choose(is_valid, x, simd_t(T(0))), d + d);
+  auto const is_odd = !(r < d);
+  r = choose(is_odd, r - d, r);
+  simd_t const twice = r + r;
+  r = choose(d < twice || (twice == d && is_odd), r - d, r);
+  return choose(is_valid, r * copysign(simd_t(T(1)), a), simd_t(std::numeric_limits<T>::quiet_NaN()));
+}
+
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> fmod(simd<T, Abi> const& a, simd<T, Abi> const& b) {
+  return impl::fmod(a, b);
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> remainder(simd<T, Abi> const& a, simd<T, Abi> const& b) {
+  return impl::remainder(a, b);
+}
+
+/* Exponent manipulation over the whole range, subnormals included.
+   Exponents are carried as integral values of T, as getexp and pow2i do.
+ */
+
+// a = m * 2^e with 0.5 <= |m| < 1; zeros, infinities and NaN come back as is with e = 0
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> frexp(simd<T, Abi> const& a, simd<T, Abi>* e) {
+  using simd_t = simd<T, Abi>;
+  simd_t const x = abs(a);
+  simd_t m, exponent;
+  impl::decompose(x, m, exponent);
+  auto const is_special = (x == simd_t(T(0))) || !(x < simd_t(std::numeric_limits<T>::infinity()));
+  *e = choose(is_special, simd_t(T(0)), exponent + simd_t(T(1)));
+  return choose(is_special, a, copysign(m * simd_t(T(0.5)), a));
+}
+
+// a * 2^n for integral n, rounded once
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> ldexp(simd<T, Abi> const& a, simd<T, Abi> const& n) {
+  using simd_t = simd<T, Abi>;
+  simd_t const x = abs(a);
+  simd_t m, e;
+  impl::decompose(x, m, e);
+  simd_t const t = e + n;
+  // m * 2^t1 stays normal and exact; only the product with 2^t2 can round
+  simd_t const t1 = max(simd_t(T(std::numeric_limits<T>::min_exponent - 1)), min(simd_t(T(std::numeric_limits<T>::max_exponent - 1)), t));
+  simd_t const t2 = max(simd_t(T(-std::numeric_limits<T>::digits - 2)), min(simd_t(T(1)), t - t1));
+  simd_t const result = copysign((m * pow2i(t1)) * pow2i(t2), a);
+  return choose((x == simd_t(T(0))) || !(x < simd_t(std::numeric_limits<T>::infinity())), a, result);
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> scalbn(simd<T, Abi> const& a, simd<T, Abi> const& n) {
+  return ldexp(a, n);
+}
+
+// the unbiased exponent of a, with FP_ILOGB0, INT_MAX and FP_ILOGBNAN as in the C library
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> ilogb(simd<T, Abi> const& a) {
+  using simd_t = simd<T, Abi>;
+  simd_t const x = abs(a);
+  simd_t m, e;
+  impl::decompose(x, m, e);
+  e = choose(x == simd_t(T(0)), simd_t(T(FP_ILOGB0)), e);
+  e = choose(x == simd_t(std::numeric_limits<T>::infinity()), simd_t(T(std::numeric_limits<int>::max())), e);
+  return choose(a == a, e, simd_t(T(FP_ILOGBNAN)));
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> logb(simd<T, Abi> const& a) {
+  using simd_t = simd<T, Abi>;
+  simd_t const x = abs(a);
+  simd_t m, e;
+  impl::decompose(x, m, e);
+  e = choose(x == simd_t(T(0)), simd_t(-std::numeric_limits<T>::infinity()), e);
+  return choose(x < simd_t(std::numeric_limits<T>::infinity()), e, x);
+}
+
+/* Conversions between lane types.
+   static_simd_cast converts each lane as static_cast does: floating point
+   to integer truncates toward zero, int64_t to int32_t keeps the low bits
+   and double to float rounds to nearest.  rounding_simd_cast instead rounds
+   floating point to integer in the current rounding mode (ties to even by
+   default), and saturating_simd_cast clamps integer results to the range
+   of U, with NaN going to 0.  Otherwise, lanes that do not fit in U are
+   unspecified.
+
+   Every simd in an ABI is the same number of bytes, so U may have twice or
+   half the lanes of T, as with 8 doubles and 16 floats in avx512.  Then
+   the side with fewer lanes comes in pairs: lanes [0, n) of the wide side
+   go with the first of the pair and lanes [n, 2n) with the second.
+
+     simd<float, Abi> f = static_simd_cast<float>(d_lo, d_hi);
+     static_simd_cast(f, &d_lo, &d_hi);
+
+   The building block is convert, with the mode as a tag.  The fallbacks
+   go lane by lane; ABIs overload them for the conversions they have
+   instructions for.
+ */
+
+namespace impl {
+
+class truncating_tag {};
+class rounding_tag {};
+class saturating_tag {};
+
+// the mode only matters for floating point to integer and narrowing integer conversions
+template <class U, class T>
+using rounding_mode = typename std::conditional<
+    std::is_floating_point<T>::value && std::is_integral<U>::value, rounding_tag, truncating_tag>::type;
+
+template <class U, class T>
+using saturating_mode = typename std::conditional<
+    std::is_integral<U>::value && (std::is_floating_point<T>::value || sizeof(U) < sizeof(T)),
+    saturating_tag, truncating_tag>::type;
+
+template <class U, class T>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline U convert_lane(T a, truncating_tag) {
+  return static_cast<U>(a);
+}
+
+template <class U, class T>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline U convert_lane(T a, rounding_tag) {
+  return static_cast<U>(std::nearbyint(a));
+}
+
+template <class U, class T>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline U saturate_lane(T a, std::true_type /* from floating point */) {
+  // the lowest value of U is a power of two, so it converts to T exactly
+  T const lowest = T(std::numeric_limits<U>::min());
+  if (!(a == a)) return U(0);
+  if (!(a < -lowest)) return std::numeric_limits<U>::max();
+  if (a < lowest) return std::numeric_limits<U>::min();
+  return static_cast<U>(a);
+}
+
+template <class U, class T>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline U saturate_lane(T a, std::false_type /* from integer */) {
+  if (a < std::numeric_limits<U>::min()) return std::numeric_limits<U>::min();
+  if (std::numeric_limits<U>::max() < a) return std::numeric_limits<U>::max();
+  return static_cast<U>(a);
+}
+
+template <class U, class T>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline U convert_lane(T a, saturating_tag) {
+  return saturate_lane<U>(a, std::is_floating_point<T>());
+}
+
+}
+
+template <class U, class T, class Abi, class Mode>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<U, Abi> convert(simd<T, Abi> const& a, simd<U, Abi> const*, Mode mode) {
+  T from[simd<T, Abi>::size()];
+  U to[simd<U, Abi>::size()];
+  a.copy_to(from, element_aligned_tag());
+  for (int i = 0; i < simd<U, Abi>::size(); ++i) to[i] = impl::convert_lane<U>(from[i], mode);
+  return simd<U, Abi>(to, element_aligned_tag());
+}
+
+template <class U, class T, class Abi, class Mode>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<U, Abi> convert(
+    simd<T, Abi> const& lo, simd<T, Abi> const& hi, simd<U, Abi> const*, Mode mode) {
+  T from[2 * simd<T, Abi>::size()];
+  U to[simd<U, Abi>::size()];
+  lo.copy_to(from, element_aligned_tag());
+  hi.copy_to(from + simd<T, Abi>::size(), element_aligned_tag());
+  for (int i = 0; i < simd<U, Abi>::size(); ++i) to[i] = impl::convert_lane<U>(from[i], mode);
+  return simd<U, Abi>(to, element_aligned_tag());
+}
+
+template <class U, class T, class Abi, class Mode>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline void convert(
+    simd<T, Abi> const& a, simd<U, Abi>* lo, simd<U, Abi>* hi, Mode mode) {
+  T from[simd<T, Abi>::size()];
+  U to[simd<T, Abi>::size()];
+  a.copy_to(from, element_aligned_tag());
+  for (int i = 0; i < simd<T, Abi>::size(); ++i) to[i] = impl::convert_lane<U>(from[i], mode);
+  lo->copy_from(to, element_aligned_tag());
+  hi->copy_from(to + simd<U, Abi>::size(), element_aligned_tag());
+}
+
+// narrowing to int32_t saturates by clamping first, so the truncating conversion can do the rest
+template <class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<std::int32_t, Abi> convert(
+    simd<std::int64_t, Abi> const& lo, simd<std::int64_t, Abi> const& hi,
+    simd<std::int32_t, Abi> const* to, impl::saturating_tag) {
+  using simd_t = simd<std::int64_t, Abi>;
+  simd_t const lowest(std::int64_t(std::numeric_limits<std::int32_t>::min()));
+  simd_t const highest(std::int64_t(std::numeric_limits<std::int32_t>::max()));
+  return convert(max(min(lo, highest), lowest), max(min(hi, highest), lowest), to, impl::truncating_tag());
+}
+
+template <class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<std::int32_t, Abi> convert(
+    simd<double, Abi> const& lo, simd<double, Abi> const& hi,
+    simd<std::int32_t, Abi> const* to, impl::saturating_tag) {
+  using simd_t = simd<double, Abi>;
+  simd_t const lowest(double(std::numeric_limits<std::int32_t>::min()));
+  simd_t const highest(double(std::numeric_limits<std::int32_t>::max()));
+  simd_t const zero(0.0);
+  return convert(
+      choose(lo == lo, max(min(lo, highest), lowest), zero),
+      choose(hi == hi, max(min(hi, highest), lowest), zero),
+      to, impl::truncating_tag());
+}
+
+template <class U, class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<U, Abi> static_simd_cast(simd<T, Abi> const& a) {
+  static_assert(simd<U, Abi>::size() == simd<T, Abi>::size(), "U has a different number of lanes; convert a pair");
+  return convert(a, static_cast<simd<U, Abi> const*>(nullptr), impl::truncating_tag());
+}
+
+template <class U, class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<U, Abi> static_simd_cast(simd<T, Abi> const& lo, simd<T, Abi> const& hi) {
+  static_assert(simd<U, Abi>::size() == 2 * simd<T, Abi>::size(), "U must have twice the lanes of T");
+  return convert(lo, hi, static_cast<simd<U, Abi> const*>(nullptr), impl::truncating_tag());
+}
+
+template <class U, class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline void static_simd_cast(simd<T, Abi> const& a, simd<U, Abi>* lo, simd<U, Abi>* hi) {
+  static_assert(2 * simd<U, Abi>::size() == simd<T, Abi>::size(), "U must have half the lanes of T");
+  convert(a, lo, hi, impl::truncating_tag());
+}
+
+template <class U, class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<U, Abi> rounding_simd_cast(simd<T, Abi> const& a) {
+  static_assert(simd<U, Abi>::size() == simd<T, Abi>::size(), "U has a different number of lanes; convert a pair");
+  return convert(a, static_cast<simd<U, Abi> const*>(nullptr), impl::rounding_mode<U, T>());
+}
+
+template <class U, class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<U, Abi> rounding_simd_cast(simd<T, Abi> const& lo, simd<T, Abi> const& hi) {
+  static_assert(simd<U, Abi>::size() == 2 * simd<T, Abi>::size(), "U must have twice the lanes of T");
+  return convert(lo, hi, static_cast<simd<U, Abi> const*>(nullptr), impl::rounding_mode<U, T>());
+}
+
+template <class U, class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline void rounding_simd_cast(simd<T, Abi> const& a, simd<U, Abi>* lo, simd<U, Abi>* hi) {
+  static_assert(2 * simd<U, Abi>::size() == simd<T, Abi>::size(), "U must have half the lanes of T");
+  convert(a, lo, hi, impl::rounding_mode<U, T>());
+}
+
+template <class U, class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<U, Abi> saturating_simd_cast(simd<T, Abi> const& a) {
+  static_assert(simd<U, Abi>::size() == simd<T, Abi>::size(), "U has a different number of lanes; convert a pair");
+  return convert(a, static_cast<simd<U, Abi> const*>(nullptr), impl::saturating_mode<U, T>());
+}
+
+template <class U, class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<U, Abi> saturating_simd_cast(simd<T, Abi> const& lo, simd<T, Abi> const& hi) {
+  static_assert(simd<U, Abi>::size() == 2 * simd<T, Abi>::size(), "U must have twice the lanes of T");
+  return convert(lo, hi, static_cast<simd<U, Abi> const*>(nullptr), impl::saturating_mode<U, T>());
+}
+
+template <class U, class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline void saturating_simd_cast(simd<T, Abi> const& a, simd<U, Abi>* lo, simd<U, Abi>* hi) {
+  static_assert(2 * simd<U, Abi>::size() == simd<T, Abi>::size(), "U must have half the lanes of T");
+  convert(a, lo, hi, impl::saturating_mode<U, T>());
+}
+
+/* Masked loads and stores read and write memory only in the lanes of
+   the mask, so a loop can finish its last few elements with
+   first_n_mask<simd_t>(n - i) instead of a scalar epilogue:
+
+     simd_t x;
+     x.copy_from(ptr + i, first_n_mask<simd_t>(n - i), element_aligned_tag());
+
+   A masked load leaves the other lanes of x unchanged.  ABIs with masked
+   load and store instructions use them; the others go lane by lane.
+ */
+
+namespace impl {
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline void masked_copy_from(simd<T, Abi>* a, T const* ptr, simd_mask<T, Abi> const& mask) {
+  using simd_t = simd<T, Abi>;
+  T lanes[simd_t::size()];
+  T selected[simd_t::size()];
+  a->copy_to(lanes, element_aligned_tag());
+  choose(mask, simd_t(T(1)), simd_t(T(0))).copy_to(selected, element_aligned_tag());
+  for (int i = 0; i < simd_t::size(); ++i) {
+    if (selected[i] != T(0)) lanes[i] = ptr[i];
+  }
+  a->copy_from(lanes, element_aligned_tag());
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline void masked_copy_to(simd<T, Abi> const& a, T* ptr, simd_mask<T, Abi> const& mask) {
+  using simd_t = simd<T, Abi>;
+  T lanes[simd_t::size()];
+  T selected[simd_t::size()];
+  a.copy_to(lanes, element_aligned_tag());
+  choose(mask, simd_t(T(1)), simd_t(T(0))).copy_to(selected, element_aligned_tag());
+  for (int i = 0; i < simd_t::size(); ++i) {
+    if (selected[i] != T(0)) ptr[i] = lanes[i];
+  }
+}
+
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd_mask<T, Abi> first_n_mask(int n, simd<T, Abi> const*) {
+  using simd_t = simd<T, Abi>;
+  T lane[simd_t::size()];
+  for (int i = 0; i < simd_t::size(); ++i) lane[i] = T(i);
+  return simd_t(lane, element_aligned_tag()) < simd_t(T(n < simd_t::size() ? n : simd_t::size()));
+}
+
+// the first n lanes of a Simd, none if n <= 0 and all if n >= Simd::size()
+template <class Simd>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline typename Simd::mask_type first_n_mask(int n) {
+  return first_n_mask(n, static_cast<Simd const*>(nullptr));
+}
+
+/* gather(ptr, idx) loads lane i from ptr[idx[i]] and scatter(ptr, idx, a)
+   stores lane i of a to ptr[idx[i]], the higher lane winning when two
+   indices are the same.  The index simd must have as many lanes as the
+   data, so on most ABIs doubles are indexed with int64_t and floats with
+   int32_t.  The masked forms touch memory only in the lanes of the mask;
+   gather takes the other lanes from other.  ABIs with gather and scatter
+   instructions overload these for their own types.
+ */
+
+template <class T, class I, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> gather(T const* ptr, simd<I, Abi> const& idx) {
+  static_assert(simd<I, Abi>::size() == simd<T, Abi>::size(), "the index simd must have one index per lane");
+  using simd_t = simd<T, Abi>;
+  I index[simd_t::size()];
+  T lanes[simd_t::size()];
+  idx.copy_to(index, element_aligned_tag());
+  for (int i = 0; i < simd_t::size(); ++i) lanes[i] = ptr[index[i]];
+  return simd_t(lanes, element_aligned_tag());
+}
+
+template <class T, class I, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> gather(
+    T const* ptr, simd<I, Abi> const& idx, simd_mask<T, Abi> const& mask, simd<T, Abi> const& other) {
+  static_assert(simd<I, Abi>::size() == simd<T, Abi>::size(), "the index simd must have one index per lane");
+  using simd_t = simd<T, Abi>;
+  I index[simd_t::size()];
+  T lanes[simd_t::size()];
+  T selected[simd_t::size()];
+  idx.copy_to(index, element_aligned_tag());
+  other.copy_to(lanes, element_aligned_tag());
+  choose(mask, simd_t(T(1)), simd_t(T(0))).copy_to(selected, element_aligned_tag());
+  for (int i = 0; i < simd_t::size(); ++i) {
+    if (selected[i] != T(0)) lanes[i] = ptr[index[i]];
+  }
+  return simd_t(lanes, element_aligned_tag());
+}
+
+template <class T, class I, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline void scatter(T* ptr, simd<I, Abi> const& idx, simd<T, Abi> const& a) {
+  static_assert(simd<I, Abi>::size() == simd<T, Abi>::size(), "the index simd must have one index per lane");
+  using simd_t = simd<T, Abi>;
+  I index[simd_t::size()];
+  T lanes[simd_t::size()];
+  idx.copy_to(index, element_aligned_tag());
+  a.copy_to(lanes, element_aligned_tag());
+  for (int i = 0; i < simd_t::size(); ++i) ptr[index[i]] = lanes[i];
+}
+
+template <class T, class I, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline void scatter(
+    T* ptr, simd<I, Abi> const& idx, simd<T, Abi> const& a, simd_mask<T, Abi> const& mask) {
+  static_assert(simd<I, Abi>::size() == simd<T, Abi>::size(), "the index simd must have one index per lane");
+  using simd_t = simd<T, Abi>;
+  I index[simd_t::size()];
+  T lanes[simd_t::size()];
+  T selected[simd_t::size()];
+  idx.copy_to(index, element_aligned_tag());
+  a.copy_to(lanes, element_aligned_tag());
+  choose(mask, simd_t(T(1)), simd_t(T(0))).copy_to(selected, element_aligned_tag());
+  for (int i = 0; i < simd_t::size(); ++i) {
+    if (selected[i] != T(0)) ptr[index[i]] = lanes[i];
+  }
+}
+
+/* Masked arithmetic: the lanes of the mask get a op b, the others keep a.
+   ABIs whose instructions take a mask, like AVX-512, overload these;
+   the fallbacks compute every lane and blend.
+ */
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> masked_plus(
+    simd_mask<T, Abi> const& mask, simd<T, Abi> const& a, simd<T, Abi> const& b) {
+  return choose(mask, a + b, a);
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> masked_minus(
+    simd_mask<T, Abi> const& mask, simd<T, Abi> const& a, simd<T, Abi> const& b) {
+  return choose(mask, a - b, a);
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> masked_multiplies(
+    simd_mask<T, Abi> const& mask, simd<T, Abi> const& a, simd<T, Abi> const& b) {
+  return choose(mask, a * b, a);
+}
+
+// lanes outside the mask divide by one, so integer division cannot trap there
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> masked_divides(
+    simd_mask<T, Abi> const& mask, simd<T, Abi> const& a, simd<T, Abi> const& b) {
+  return choose(mask, a / choose(mask, b, simd<T, Abi>(T(1))), a);
+}
+
+/* where(mask, x) applies assignments, compound assignments and copies
+   to the lanes of x in the mask only:
+
+     where(x < simd_t(0.0), x) *= simd_t(-1.0);
+     where(first_n_mask<simd_t>(n - i), y).copy_to(ptr + i, element_aligned_tag());
+ */
+
+template <class T, class Abi>
+class const_where_expression {
+  simd_mask<T, Abi> m_mask;
+  simd<T, Abi> const& m_value;
+ public:
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline
+  const_where_expression(simd_mask<T, Abi> const& mask, simd<T, Abi> const& value)
+    :m_mask(mask)
+    ,m_value(value)
+  {}
+  template <class Flags>
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline void copy_to(T* ptr, Flags flags) const {
+    m_value.copy_to(ptr, m_mask, flags);
+  }
+};
+
+template <class T, class Abi>
+class where_expression {
+  simd_mask<T, Abi> m_mask;
+  simd<T, Abi>& m_value;
+ public:
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline
+  where_expression(simd_mask<T, Abi> const& mask, simd<T, Abi>& value)
+    :m_mask(mask)
+    ,m_value(value)
+  {}
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline void operator=(simd<T, Abi> const& a) {
+    m_value = choose(m_mask, a, m_value);
+  }
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline void operator+=(simd<T, Abi> const& a) {
+    m_value = masked_plus(m_mask, m_value, a);
+  }
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline void operator-=(simd<T, Abi> const& a) {
+    m_value = masked_minus(m_mask, m_value, a);
+  }
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline void operator*=(simd<T, Abi> const& a) {
+    m_value = masked_multiplies(m_mask, m_value, a);
+  }
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline void operator/=(simd<T, Abi> const& a) {
+    m_value = masked_divides(m_mask, m_value, a);
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline void copy_from(T const* ptr, Flags flags) {
+    m_value.copy_from(ptr, m_mask, flags);
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline void copy_to(T* ptr, Flags flags) const {
+    m_value.copy_to(ptr, m_mask, flags);
+  }
+};
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline where_expression<T, Abi> where(
+    typename simd<T, Abi>::mask_type const& mask, simd<T, Abi>& value) {
+  return where_expression<T, Abi>(mask, value);
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline const_where_expression<T, Abi> where(
+    typename simd<T, Abi>::mask_type const& mask, simd<T, Abi> const& value) {
+  return const_where_expression<T, Abi>(mask, value);
+}
+
+/* Horizontal reductions of the lanes of a simd to one value.  The
+   fallbacks fold the upper half of the lanes onto the lower half until
+   one is left, which is the order the ABIs' shuffle trees use as well;
+   ABIs overload reduce(a, std::plus<>()), hmin and hmax.  The masked
+   forms reduce the lanes of the mask only and give the identity when
+   the mask is empty.
+ */
+
+template <class T, class Abi, class BinaryOp>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline T reduce(simd<T, Abi> const& a, BinaryOp const& op) {
+  T lanes[simd<T, Abi>::size()];
+  a.copy_to(lanes, element_aligned_tag());
+  int n = simd<T, Abi>::size();
+  for (; n > 1; n = (n + 1) / 2) {
+    for (int i = 0; i < n / 2; ++i) lanes[i] = op(lanes[i], lanes[i + (n + 1) / 2]);
+  }
+  return lanes[0];
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline T reduce(simd<T, Abi> const& a) {
+  return reduce(a, std::plus<>());
+}
+
+namespace impl {
+
+template <class T>
+class min_op {
+ public:
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline T operator()(T const& a, T const& b) const { return b < a ? b : a; }
+};
+
+template <class T>
+class max_op {
+ public:
+  SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline T operator()(T const& a, T const& b) const { return a < b ? b : a; }
+};
+
+// the identities of hmin and hmax
+template <class T>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline constexpr T highest() {
+  return std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity() : std::numeric_limits<T>::max();
+}
+
+template <class T>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline constexpr T lowest() {
+  return std::numeric_limits<T>::has_infinity ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::lowest();
+}
+
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline T hmin(simd<T, Abi> const& a) {
+  return reduce(a, impl::min_op<T>());
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline T hmax(simd<T, Abi> const& a) {
+  return reduce(a, impl::max_op<T>());
+}
+
+template <class T, class Abi, class BinaryOp>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline T reduce(
+    simd<T, Abi> const& a, simd_mask<T, Abi> const& mask, T identity, BinaryOp const& op) {
+  return reduce(choose(mask, a, simd<T, Abi>(identity)), op);
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline T reduce(simd<T, Abi> const& a, simd_mask<T, Abi> const& mask) {
+  return reduce(choose(mask, a, simd<T, Abi>(T(0))), std::plus<>());
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline T hmin(simd<T, Abi> const& a, simd_mask<T, Abi> const& mask) {
+  return hmin(choose(mask, a, simd<T, Abi>(impl::highest<T>())));
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline T hmax(simd<T, Abi> const& a, simd_mask<T, Abi> const& mask) {
+  return hmax(choose(mask, a, simd<T, Abi>(impl::lowest<T>())));
+}
+
+/* Inspecting a mask: to_bitmask packs the lanes of a mask into the low
+   bits of an integer, lane i in bit i, and from_bitmask<Mask>(bits) is
+   its inverse.  ABIs with a movemask or mask register overload both;
+   popcount, find_first_set and find_last_set are built on to_bitmask,
+   the find functions giving -1 when no lane is set.
+ */
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline bool none_of(simd_mask<T, Abi> const& a) {
+  return !any_of(a);
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline std::uint64_t to_bitmask(simd_mask<T, Abi> const& a) {
+  using simd_t = simd<T, Abi>;
+  static_assert(simd_t::size() <= 64, "to_bitmask needs at most 64 lanes");
+  T selected[simd_t::size()];
+  choose(a, simd_t(T(1)), simd_t(T(0))).copy_to(selected, element_aligned_tag());
+  std::uint64_t bits = 0;
+  for (int i = 0; i < simd_t::size(); ++i) {
+    if (selected[i] != T(0)) bits |= std::uint64_t(1) << i;
+  }
+  return bits;
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd_mask<T, Abi> from_bitmask(std::uint64_t bits, simd_mask<T, Abi> const*) {
+  using simd_t = simd<T, Abi>;
+  static_assert(simd_t::size() <= 64, "from_bitmask needs at most 64 lanes");
+  T lane[simd_t::size()];
+  for (int i = 0; i < simd_t::size(); ++i) lane[i] = T((bits >> i) & 1);
+  return simd_t(lane, element_aligned_tag()) == simd_t(T(1));
+}
+
+// the mask whose lane i is bit i of bits, the bits above Mask::size() ignored
+template <class Mask>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline Mask from_bitmask(std::uint64_t bits) {
+  return from_bitmask(bits, static_cast<Mask const*>(nullptr));
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline int popcount(simd_mask<T, Abi> const& a) {
+  std::uint64_t bits = to_bitmask(a);
+#if defined(__GNUC__) && !defined(__CUDA_ARCH__) && !defined(__HIP_DEVICE_COMPILE__)
+  return __builtin_popcountll(bits);
+#else
+  int count = 0;
+  for (; bits != 0; bits &= bits - 1) ++count;
+  return count;
+#endif
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline int find_first_set(simd_mask<T, Abi> const& a) {
+  std::uint64_t bits = to_bitmask(a);
+  if (bits == 0) return -1;
+#if defined(__GNUC__) && !defined(__CUDA_ARCH__) && !defined(__HIP_DEVICE_COMPILE__)
+  return __builtin_ctzll(bits);
+#else
+  int i = 0;
+  for (; (bits & 1) == 0; bits >>= 1) ++i;
+  return i;
+#endif
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline int find_last_set(simd_mask<T, Abi> const& a) {
+  std::uint64_t bits = to_bitmask(a);
+  if (bits == 0) return -1;
+#if defined(__GNUC__) && !defined(__CUDA_ARCH__) && !defined(__HIP_DEVICE_COMPILE__)
+  return 63 - __builtin_clzll(bits);
+#else
+  int i = 0;
+  for (; bits > 1; bits >>= 1) ++i;
+  return i;
+#endif
+}
+
+/* Lane permutations.  permute<Idx...>(a) gives lane i the value of lane
+   Idx_i of a, and rotate<k>, broadcast_lane<i> and reverse are the
+   permutes their names describe, rotate<k> moving lane i + k down to
+   lane i.  interleave_lo(a, b) is a0 b0 a1 b1 ..., the first size()
+   lanes of the two interleaved, and interleave_hi is the next size().
+   shift_in(a, b, k) is lanes k through size() - 1 of a followed by the
+   first k lanes of b, for 0 <= k <= size().  ABIs overload
+   permute(a, std::integer_sequence<int, Idx...>()), interleave_lo,
+   interleave_hi and shift_in with their shuffles; the fallbacks go
+   through memory, which is also what crosses the parts of fixed_size.
+ */
+
+template <class T, class Abi, int... Idx>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> permute(simd<T, Abi> const& a, std::integer_sequence<int, Idx...>) {
+  using simd_t = simd<T, Abi>;
+  static_assert(sizeof...(Idx) == simd_t::size(), "permute needs one index per lane");
+  T lanes[simd_t::size()];
+  a.copy_to(lanes, element_aligned_tag());
+  T const result[] = {lanes[Idx]...};
+  return simd_t(result, element_aligned_tag());
+}
+
+template <int... Idx, class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> permute(simd<T, Abi> const& a) {
+  return permute(a, std::integer_sequence<int, Idx...>());
+}
+
+namespace impl {
+
+template <int K, class T, class Abi, int... I>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> rotate(simd<T, Abi> const& a, std::integer_sequence<int, I...>) {
+  constexpr int n = int(sizeof...(I));
+  return permute(a, std::integer_sequence<int, (((I + K) % n + n) % n)...>());
+}
+
+template <int L, class T, class Abi, int... I>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> broadcast_lane(simd<T, Abi> const& a, std::integer_sequence<int, I...>) {
+  return permute(a, std::integer_sequence<int, (I * 0 + L)...>());
+}
+
+template <class T, class Abi, int... I>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> reverse(simd<T, Abi> const& a, std::integer_sequence<int, I...>) {
+  return permute(a, std::integer_sequence<int, (int(sizeof...(I)) - 1 - I)...>());
+}
+
+}
+
+template <int K, class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> rotate(simd<T, Abi> const& a) {
+  return impl::rotate<K>(a, std::make_integer_sequence<int, simd<T, Abi>::size()>());
+}
+
+template <int L, class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> broadcast_lane(simd<T, Abi> const& a) {
+  static_assert(0 <= L && L < simd<T, Abi>::size(), "broadcast_lane needs a lane of a");
+  return impl::broadcast_lane<L>(a, std::make_integer_sequence<int, simd<T, Abi>::size()>());
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> reverse(simd<T, Abi> const& a) {
+  return impl::reverse(a, std::make_integer_sequence<int, simd<T, Abi>::size()>());
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> interleave_lo(simd<T, Abi> const& a, simd<T, Abi> const& b) {
+  using simd_t = simd<T, Abi>;
+  constexpr int n = simd_t::size();
+  T lanes[2 * n];
+  T result[n];
+  a.copy_to(lanes, element_aligned_tag());
+  b.copy_to(lanes + n, element_aligned_tag());
+  for (int i = 0; i < n; ++i) result[i] = lanes[(i % 2) * n + i / 2];
+  return simd_t(result, element_aligned_tag());
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> interleave_hi(simd<T, Abi> const& a, simd<T, Abi> const& b) {
+  using simd_t = simd<T, Abi>;
+  constexpr int n = simd_t::size();
+  T lanes[2 * n];
+  T result[n];
+  a.copy_to(lanes, element_aligned_tag());
+  b.copy_to(lanes + n, element_aligned_tag());
+  for (int i = n; i < 2 * n; ++i) result[i - n] = lanes[(i % 2) * n + i / 2];
+  return simd_t(result, element_aligned_tag());
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> shift_in(simd<T, Abi> const& a, simd<T, Abi> const& b, int k) {
+  using simd_t = simd<T, Abi>;
+  T lanes[2 * simd_t::size()];
+  a.copy_to(lanes, element_aligned_tag());
+  b.copy_to(lanes + simd_t::size(), element_aligned_tag());
+  return simd_t(lanes + k, element_aligned_tag());
+}
+
+/* Prefix sums.  inclusive_scan(a) gives lane i the sum of lanes 0
+   through i of a, and exclusive_scan(a) the sum of lanes 0 through
+   i - 1, in log2(size()) steps that each add a copy of the partial sums
+   rotated up by 1, 2, 4, ... lanes with the wrapped lanes zeroed.  The
+   array forms scan in[0, n) into out, which may be in, starting from
+   init and carrying the running total from one simd to the next; they
+   return the total.
+ */
+
+namespace impl {
+
+template <int K, class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> inclusive_scan_from(simd<T, Abi> const& a, std::false_type) {
+  return a;
+}
+
+template <int K, class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> inclusive_scan_from(simd<T, Abi> const& a, std::true_type) {
+  using simd_t = simd<T, Abi>;
+  simd_t const b = a + choose(first_n_mask<simd_t>(K), simd_t(T(0)), rotate<-K>(a));
+  return inclusive_scan_from<2 * K>(b, std::integral_constant<bool, (2 * K < simd_t::size())>());
+}
+
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> inclusive_scan(simd<T, Abi> const& a) {
+  return impl::inclusive_scan_from<1>(a, std::integral_constant<bool, (1 < simd<T, Abi>::size())>());
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> exclusive_scan(simd<T, Abi> const& a) {
+  using simd_t = simd<T, Abi>;
+  return choose(first_n_mask<simd_t>(1), simd_t(T(0)), rotate<-1>(inclusive_scan(a)));
+}
+
+template <class Simd>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline typename Simd::value_type inclusive_scan(
+    typename Simd::value_type const* in, typename Simd::value_type* out, int n,
+    typename Simd::value_type init = typename Simd::value_type(0)) {
+  using T = typename Simd::value_type;
+  Simd carry(init);
+  int i = 0;
+  for (; i + Simd::size() <= n; i += Simd::size()) {
+    Simd const sum = inclusive_scan(Simd(in + i, element_aligned_tag())) + carry;
+    sum.copy_to(out + i, element_aligned_tag());
+    carry = broadcast_lane<Simd::size() - 1>(sum);
+  }
+  if (i < n) {
+    auto const mask = first_n_mask<Simd>(n - i);
+    Simd x(T(0));
+    x.copy_from(in + i, mask, element_aligned_tag());
+    Simd const sum = inclusive_scan(x) + carry;
+    sum.copy_to(out + i, mask, element_aligned_tag());
+    carry = broadcast_lane<Simd::size() - 1>(sum);
+  }
+  T total[Simd::size()];
+  carry.copy_to(total, element_aligned_tag());
+  return total[0];
+}
+
+template <class Simd>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline typename Simd::value_type exclusive_scan(
+    typename Simd::value_type const* in, typename Simd::value_type* out, int n,
+    typename Simd::value_type init = typename Simd::value_type(0)) {
+  using T = typename Simd::value_type;
+  auto const first_lane = first_n_mask<Simd>(1);
+  Simd carry(init);
+  int i = 0;
+  for (; i + Simd::size() <= n; i += Simd::size()) {
+    Simd const sum = inclusive_scan(Simd(in + i, element_aligned_tag())) + carry;
+    choose(first_lane, carry, rotate<-1>(sum)).copy_to(out + i, element_aligned_tag());
+    carry = broadcast_lane<Simd::size() - 1>(sum);
+  }
+  if (i < n) {
+    auto const mask = first_n_mask<Simd>(n - i);
+    Simd x(T(0));
+    x.copy_from(in + i, mask, element_aligned_tag());
+    Simd const sum = inclusive_scan(x) + carry;
+    choose(first_lane, carry, rotate<-1>(sum)).copy_to(out + i, mask, element_aligned_tag());
+    carry = broadcast_lane<Simd::size() - 1>(sum);
+  }
+  T total[Simd::size()];
+  carry.copy_to(total, element_aligned_tag());
+  return total[0];
+}
+
+/* Stream compaction.  compress_store(ptr, mask, a) stores the lanes of
+   a in the mask one after another from ptr and returns how many it
+   stored, writing nothing past them; expand_load(ptr, mask) is its
+   inverse, giving the lanes of the mask the next values from ptr, in
+   order, and the other lanes zero.  ABIs with compress and expand
+   instructions or a cross-lane permute overload both.
+ */
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline int compress_store(T* ptr, simd_mask<T, Abi> const& mask, simd<T, Abi> const& a) {
+  T lanes[simd<T, Abi>::size()];
+  a.copy_to(lanes, element_aligned_tag());
+  std::uint64_t const bits = to_bitmask(mask);
+  int count = 0;
+  for (int i = 0; i < simd<T, Abi>::size(); ++i) {
+    if ((bits >> i) & 1) ptr[count++] = lanes[i];
+  }
+  return count;
+}
+
+template <class T, class Abi>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, Abi> expand_load(T const* ptr, simd_mask<T, Abi> const& mask) {
+  T lanes[simd<T, Abi>::size()];
+  std::uint64_t const bits = to_bitmask(mask);
+  int count = 0;
+  for (int i = 0; i < simd<T, Abi>::size(); ++i) lanes[i] = ((bits >> i) & 1) ? ptr[count++] : T(0);
+  return simd<T, Abi>(lanes, element_aligned_tag());
+}
+
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline bool all_of(bool a) { return a; }
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline bool any_of(bool a) { return a; }
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline bool none_of(bool a) { return !a; }
+
+template <class T, class Abi>
+class simd_storage {
+  alignas(simd<T, Abi>) T m_value[simd<T, Abi>::size()];
+ public:
+  using value_type = T;
+  using simd_type = simd<T, Abi>;
+  SIMD_ALWAYS_INLINE inline simd_storage() = default;
+  SIMD_ALWAYS_INLINE inline static constexpr
+  int size() { return simd<T, Abi>::size(); }
+  SIMD_ALWAYS_INLINE explicit inline
+  simd_storage(simd<T, Abi> const& value) {
+    value.copy_to(m_value, vector_aligned_tag());
+  }
+  SIMD_ALWAYS_INLINE explicit inline
+  simd_storage(T value)
+    :simd_storage(simd<T, Abi>(value))
+  {}
+  SIMD_ALWAYS_INLINE inline
+  simd_storage& operator=(simd<T, Abi> const& value) {
+    value.copy_to(m_value, vector_aligned_tag());
+    return *this;
+  }
+  SIMD_ALWAYS_INLINE inline
+  T const* data() const { return m_value; }
+  SIMD_ALWAYS_INLINE inline
+  T* data() { return m_value; }
+  SIMD_ALWAYS_INLINE inline
+  T const& operator[](int i) const { return m_value[i]; }
+  SIMD_ALWAYS_INLINE inline
+  T& operator[](int i) { return m_value[i]; }
+};
+
+template <class T>
+class simd_size {
+  public:
+  static constexpr int value = 1;
+};
+
+template <class T, class Abi>
+class simd_size<simd<T, Abi>> {
+  public:
+  static constexpr int value = simd<T, Abi>::size();
+};
+
+template <class T>
+class memory_alignment {
+  public:
+  static constexpr std::size_t value = alignof(T);
+};
+
+template <class T, class Abi>
+class memory_alignment<simd<T, Abi>> {
+  public:
+  static constexpr std::size_t value = alignof(simd<T, Abi>);
 };
 
 }
@@ -53,7 +53,19 @@
 #include <emmintrin.h>
 #endif
 
-#if defined(__FMA__) || defined(__AVX2__)
+#ifdef __SSSE3__
+#include <tmmintrin.h>
+#endif
+
+#ifdef __SSE4_1__
+#include <smmintrin.h>
+#endif
+
+#ifdef __SSE4_2__
+#include <nmmintrin.h>
+#endif
+
+#if defined(__AVX__) || defined(__FMA__) || defined(__AVX2__)
 #include <immintrin.h>
 #endif
 
@@ -77,6 +89,15 @@ class sse {};
 
 }
 
+/* copy_to(..., nontemporal_tag) streams past the caches with weakly
+   ordered stores; this orders them before the stores that follow, e.g.
+   before another thread is told the data is ready.
+ */
+#define SIMD_NONTEMPORAL_FENCE_DEFINED
+SIMD_ALWAYS_INLINE inline void nontemporal_fence() {
+  _mm_sfence();
+}
+
 template <>
 class simd_mask<float, simd_abi::sse> {
   __m128 m_value;
@@ -112,6 +133,16 @@ SIMD_ALWAYS_INLINE inline bool any_of(simd_mask<float, simd_abi::sse> const& a)
   return _mm_movemask_ps(a.get()) != 0x0;
 }
 
+SIMD_ALWAYS_INLINE inline std::uint64_t to_bitmask(simd_mask<float, simd_abi::sse> const& a) {
+  return std::uint64_t(_mm_movemask_ps(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd_mask<float, simd_abi::sse> from_bitmask(std::uint64_t bits, simd_mask<float, simd_abi::sse> const*) {
+  __m128i const lane_bits = _mm_setr_epi32(1, 2, 4, 8);
+  __m128i const set = _mm_and_si128(_mm_set1_epi32(int(bits)), lane_bits);
+  return simd_mask<float, simd_abi::sse>(_mm_castsi128_ps(_mm_cmpeq_epi32(set, lane_bits)));
+}
+
 template <>
 class simd<float, simd_abi::sse> {
   __m128 m_value;
@@ -131,17 +162,17 @@ class simd<float, simd_abi::sse> {
   {}
   SIMD_ALWAYS_INLINE inline
   simd(storage_type const& value) {
-    copy_from(value.data(), element_aligned_tag());
+    copy_from(value.data(), vector_aligned_tag());
   }
   SIMD_ALWAYS_INLINE inline
   simd& operator=(storage_type const& value) {
-    copy_from(value.data(), element_aligned_tag());
+    copy_from(value.data(), vector_aligned_tag());
     return *this;
   }
   template <class Flags>
-  SIMD_ALWAYS_INLINE inline simd(float const* ptr, Flags /*flags*/)
-    :m_value(_mm_loadu_ps(ptr))
-  {}
+  SIMD_ALWAYS_INLINE inline simd(float const* ptr, Flags flags) {
+    copy_from(ptr, flags);
+  }
   SIMD_ALWAYS_INLINE inline simd(float const* ptr, int stride)
     :simd(ptr[0], ptr[stride], ptr[2*stride], ptr[3*stride])
   {}
@@ -169,6 +200,39 @@ class simd<float, simd_abi::sse> {
   SIMD_ALWAYS_INLINE void copy_to(float* ptr, element_aligned_tag) const {
     _mm_storeu_ps(ptr, m_value);
   }
+  SIMD_ALWAYS_INLINE void copy_from(float const* ptr, vector_aligned_tag) {
+    m_value = _mm_load_ps(ptr);
+  }
+  SIMD_ALWAYS_INLINE void copy_to(float* ptr, vector_aligned_tag) const {
+    _mm_store_ps(ptr, m_value);
+  }
+  SIMD_ALWAYS_INLINE void copy_to(float* ptr, nontemporal_tag) const {
+    _mm_stream_ps(ptr, m_value);
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE void copy_from(float const* ptr, mask_type const& mask, Flags /*flags*/) {
+#ifdef __AVX__
+    m_value = _mm_blendv_ps(m_value, _mm_maskload_ps(ptr, _mm_castps_si128(mask.get())), mask.get());
+#else
+    impl::masked_copy_from(this, ptr, mask);
+#endif
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE void copy_to(float* ptr, mask_type const& mask, Flags /*flags*/) const {
+#ifdef __AVX__
+    _mm_maskstore_ps(ptr, _mm_castps_si128(mask.get()), m_value);
+#else
+    impl::masked_copy_to(*this, ptr, mask);
+#endif
+  }
+  template <std::size_t N>
+  SIMD_ALWAYS_INLINE void copy_from(float const* ptr, overaligned_tag<N>) {
+    copy_from(ptr, impl::overaligned_as<N, alignof(simd)>());
+  }
+  template <std::size_t N>
+  SIMD_ALWAYS_INLINE void copy_to(float* ptr, overaligned_tag<N>) const {
+    copy_to(ptr, impl::overaligned_as<N, alignof(simd)>());
+  }
   SIMD_ALWAYS_INLINE constexpr __m128 get() const { return m_value; }
   SIMD_ALWAYS_INLINE simd_mask<float, simd_abi::sse> operator<(simd const& other) const {
     return simd_mask<float, simd_abi::sse>(_mm_cmplt_ps(m_value, other.m_value));
@@ -176,6 +240,18 @@ class simd<float, simd_abi::sse> {
   SIMD_ALWAYS_INLINE simd_mask<float, simd_abi::sse> operator==(simd const& other) const {
     return simd_mask<float, simd_abi::sse>(_mm_cmpeq_ps(m_value, other.m_value));
   }
+  SIMD_ALWAYS_INLINE simd_mask<float, simd_abi::sse> operator>(simd const& other) const {
+    return simd_mask<float, simd_abi::sse>(_mm_cmpgt_ps(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE simd_mask<float, simd_abi::sse> operator<=(simd const& other) const {
+    return simd_mask<float, simd_abi::sse>(_mm_cmple_ps(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE simd_mask<float, simd_abi::sse> operator>=(simd const& other) const {
+    return simd_mask<float, simd_abi::sse>(_mm_cmpge_ps(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE simd_mask<float, simd_abi::sse> operator!=(simd const& other) const {
+    return simd_mask<float, simd_abi::sse>(_mm_cmpneq_ps(m_value, other.m_value));
+  }
 };
 
 SIMD_ALWAYS_INLINE inline simd<float, simd_abi::sse> multiplysign(simd<float, simd_abi::sse> const& a, simd<float, simd_abi::sse> const& b) {
@@ -197,6 +273,17 @@ SIMD_ALWAYS_INLINE inline simd<float, simd_abi::sse> sqrt(simd<float, simd_abi::
   return simd<float, simd_abi::sse>(_mm_sqrt_ps(a.get()));
 }
 
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::sse> rcp_estimate(simd<float, simd_abi::sse> const& a) {
+  return simd<float, simd_abi::sse>(_mm_rcp_ps(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::sse> rsqrt_estimate(simd<float, simd_abi::sse> const& a) {
+  return simd<float, simd_abi::sse>(_mm_rsqrt_ps(a.get()));
+}
+
+// rcpps and rsqrtps have a relative error of at most 1.5 * 2^-12
+SIMD_ALWAYS_INLINE inline constexpr int reciprocal_estimate_bits(simd<float, simd_abi::sse> const*) { return 11; }
+
 #ifdef __INTEL_COMPILER
 SIMD_ALWAYS_INLINE inline simd<float, simd_abi::sse> cbrt(simd<float, simd_abi::sse> const& a) {
   return simd<float, simd_abi::sse>(_mm_cbrt_ps(a.get()));
@@ -218,6 +305,13 @@ SIMD_ALWAYS_INLINE inline simd<float, simd_abi::sse> fma(
     simd<float, simd_abi::sse> const& c) {
   return simd<float, simd_abi::sse>(_mm_fmadd_ps(a.get(), b.get(), c.get()));
 }
+#else
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::sse> fma(
+    simd<float, simd_abi::sse> const& a,
+    simd<float, simd_abi::sse> const& b,
+    simd<float, simd_abi::sse> const& c) {
+  return simd<float, simd_abi::sse>(_mm_add_ps(_mm_mul_ps(a.get(), b.get()), c.get()));
+}
 #endif
 
 SIMD_ALWAYS_INLINE inline simd<float, simd_abi::sse> max(
@@ -232,9 +326,61 @@ SIMD_ALWAYS_INLINE inline simd<float, simd_abi::sse> min(
 
 SIMD_ALWAYS_INLINE inline simd<float, simd_abi::sse> choose(
     simd_mask<float, simd_abi::sse> const& a, simd<float, simd_abi::sse> const& b, simd<float, simd_abi::sse> const& c) {
-  return simd<float, simd_abi::sse>(_mm_add_ps(_mm_and_ps(a.get(), b.get()), _mm_andnot_ps(a.get(), c.get())));
+  return simd<float, simd_abi::sse>(_mm_or_ps(_mm_and_ps(a.get(), b.get()), _mm_andnot_ps(a.get(), c.get())));
+}
+
+#ifdef __SSE2__
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::sse> roundeven(simd<float, simd_abi::sse> const& a) {
+#ifdef __SSE4_1__
+  return simd<float, simd_abi::sse>(_mm_round_ps(a.get(), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+#else
+  // adding and subtracting 2^23 drops the fraction bits; larger values are already integral
+  __m128 const sign_mask = _mm_set1_ps(-0.f);
+  __m128 const two23 = _mm_set1_ps(8388608.f);
+  __m128 const sign = _mm_and_ps(sign_mask, a.get());
+  __m128 const magic = _mm_or_ps(two23, sign);
+  __m128 const rounded = _mm_or_ps(_mm_sub_ps(_mm_add_ps(a.get(), magic), magic), sign);
+  __m128 const is_small = _mm_cmplt_ps(_mm_andnot_ps(sign_mask, a.get()), two23);
+  return simd<float, simd_abi::sse>(_mm_or_ps(_mm_and_ps(is_small, rounded), _mm_andnot_ps(is_small, a.get())));
+#endif
+}
+
+#ifdef __SSE4_1__
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::sse> floor(simd<float, simd_abi::sse> const& a) {
+  return simd<float, simd_abi::sse>(_mm_round_ps(a.get(), _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC));
 }
 
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::sse> ceil(simd<float, simd_abi::sse> const& a) {
+  return simd<float, simd_abi::sse>(_mm_round_ps(a.get(), _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::sse> trunc(simd<float, simd_abi::sse> const& a) {
+  return simd<float, simd_abi::sse>(_mm_round_ps(a.get(), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::sse> nearbyint(simd<float, simd_abi::sse> const& a) {
+  return simd<float, simd_abi::sse>(_mm_round_ps(a.get(), _MM_FROUND_CUR_DIRECTION | _MM_FROUND_NO_EXC));
+}
+#endif
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::sse> pow2i(simd<float, simd_abi::sse> const& n) {
+  // the low bits of 2^23 + 127 + n hold the biased exponent of 2^n
+  __m128 const biased = _mm_add_ps(n.get(), _mm_set1_ps(8388735.f));
+  return simd<float, simd_abi::sse>(_mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(biased), 23)));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::sse> getexp(simd<float, simd_abi::sse> const& a) {
+  __m128i const biased = _mm_srli_epi32(_mm_slli_epi32(_mm_castps_si128(a.get()), 1), 24);
+  __m128 const two23 = _mm_set1_ps(8388608.f);
+  return simd<float, simd_abi::sse>(_mm_sub_ps(_mm_or_ps(_mm_castsi128_ps(biased), two23), _mm_set1_ps(8388735.f)));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::sse> getmant(simd<float, simd_abi::sse> const& a) {
+  __m128 const mantissa_mask = _mm_castsi128_ps(_mm_set1_epi32(0x007FFFFF));
+  return simd<float, simd_abi::sse>(_mm_or_ps(_mm_and_ps(mantissa_mask, a.get()), _mm_set1_ps(1.f)));
+}
+#endif
+
 #endif
 
 #ifdef __SSE2__
@@ -250,7 +396,7 @@ class simd_mask<double, simd_abi::sse> {
   SIMD_ALWAYS_INLINE inline simd_mask(bool value)
     :m_value(_mm_castsi128_pd(_mm_set1_epi64x(-std::int64_t(value))))
   {}
-  SIMD_ALWAYS_INLINE inline static constexpr int size() { return 4; }
+  SIMD_ALWAYS_INLINE inline static constexpr int size() { return 2; }
   SIMD_ALWAYS_INLINE inline constexpr simd_mask(__m128d const& value_in)
     :m_value(value_in)
   {}
@@ -274,6 +420,17 @@ SIMD_ALWAYS_INLINE inline bool any_of(simd_mask<double, simd_abi::sse> const& a)
   return _mm_movemask_pd(a.get()) != 0x0;
 }
 
+SIMD_ALWAYS_INLINE inline std::uint64_t to_bitmask(simd_mask<double, simd_abi::sse> const& a) {
+  return std::uint64_t(_mm_movemask_pd(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd_mask<double, simd_abi::sse> from_bitmask(std::uint64_t bits, simd_mask<double, simd_abi::sse> const*) {
+  // both 32-bit halves of lane i test bit i, so their equality masks fill the lane
+  __m128i const lane_bits = _mm_setr_epi32(1, 1, 2, 2);
+  __m128i const set = _mm_and_si128(_mm_set1_epi32(int(bits)), lane_bits);
+  return simd_mask<double, simd_abi::sse>(_mm_castsi128_pd(_mm_cmpeq_epi32(set, lane_bits)));
+}
+
 template <>
 class simd<double, simd_abi::sse> {
   __m128d m_value;
@@ -296,7 +453,7 @@ class simd<double, simd_abi::sse> {
   {}
   SIMD_ALWAYS_INLINE inline
   simd(storage_type const& value) {
-    copy_from(value.data(), element_aligned_tag());
+    copy_from(value.data(), vector_aligned_tag());
   }
 #ifdef STK_VOLATILE_SIMD
   SIMD_ALWAYS_INLINE inline
@@ -306,13 +463,13 @@ class simd<double, simd_abi::sse> {
 #endif
   SIMD_ALWAYS_INLINE inline
   simd& operator=(storage_type const& value) {
-    copy_from(value.data(), element_aligned_tag());
+    copy_from(value.data(), vector_aligned_tag());
     return *this;
   }
   template <class Flags>
-  SIMD_ALWAYS_INLINE inline simd(double const* ptr, Flags /*flags*/)
-    :m_value(_mm_loadu_pd(ptr))
-  {}
+  SIMD_ALWAYS_INLINE inline simd(double const* ptr, Flags flags) {
+    copy_from(ptr, flags);
+  }
   SIMD_ALWAYS_INLINE inline simd(double const* ptr, int stride)
     :simd(ptr[0], ptr[stride])
   {}
@@ -345,6 +502,39 @@ class simd<double, simd_abi::sse> {
   SIMD_ALWAYS_INLINE inline void copy_to(double* ptr, element_aligned_tag) const {
     _mm_storeu_pd(ptr, m_value);
   }
+  SIMD_ALWAYS_INLINE inline void copy_from(double const* ptr, vector_aligned_tag) {
+    m_value = _mm_load_pd(ptr);
+  }
+  SIMD_ALWAYS_INLINE inline void copy_to(double* ptr, vector_aligned_tag) const {
+    _mm_store_pd(ptr, m_value);
+  }
+  SIMD_ALWAYS_INLINE inline void copy_to(double* ptr, nontemporal_tag) const {
+    _mm_stream_pd(ptr, m_value);
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline void copy_from(double const* ptr, mask_type const& mask, Flags /*flags*/) {
+#ifdef __AVX__
+    m_value = _mm_blendv_pd(m_value, _mm_maskload_pd(ptr, _mm_castpd_si128(mask.get())), mask.get());
+#else
+    impl::masked_copy_from(this, ptr, mask);
+#endif
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline void copy_to(double* ptr, mask_type const& mask, Flags /*flags*/) const {
+#ifdef __AVX__
+    _mm_maskstore_pd(ptr, _mm_castpd_si128(mask.get()), m_value);
+#else
+    impl::masked_copy_to(*this, ptr, mask);
+#endif
+  }
+  template <std::size_t N>
+  SIMD_ALWAYS_INLINE inline void copy_from(double const* ptr, overaligned_tag<N>) {
+    copy_from(ptr, impl::overaligned_as<N, alignof(simd)>());
+  }
+  template <std::size_t N>
+  SIMD_ALWAYS_INLINE inline void copy_to(double* ptr, overaligned_tag<N>) const {
+    copy_to(ptr, impl::overaligned_as<N, alignof(simd)>());
+  }
   SIMD_ALWAYS_INLINE inline constexpr __m128d get() const { return m_value; }
   SIMD_ALWAYS_INLINE inline simd_mask<double, simd_abi::sse> operator<(simd const& other) const {
     return simd_mask<double, simd_abi::sse>(_mm_cmplt_pd(m_value, other.m_value));
@@ -352,6 +542,18 @@ class simd<double, simd_abi::sse> {
   SIMD_ALWAYS_INLINE inline simd_mask<double, simd_abi::sse> operator==(simd const& other) const {
     return simd_mask<double, simd_abi::sse>(_mm_cmpeq_pd(m_value, other.m_value));
   }
+  SIMD_ALWAYS_INLINE inline simd_mask<double, simd_abi::sse> operator>(simd const& other) const {
+    return simd_mask<double, simd_abi::sse>(_mm_cmpgt_pd(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<double, simd_abi::sse> operator<=(simd const& other) const {
+    return simd_mask<double, simd_abi::sse>(_mm_cmple_pd(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<double, simd_abi::sse> operator>=(simd const& other) const {
+    return simd_mask<double, simd_abi::sse>(_mm_cmpge_pd(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<double, simd_abi::sse> operator!=(simd const& other) const {
+    return simd_mask<double, simd_abi::sse>(_mm_cmpneq_pd(m_value, other.m_value));
+  }
 };
 
 SIMD_ALWAYS_INLINE inline simd<double, simd_abi::sse> multiplysign(simd<double, simd_abi::sse> const& a, simd<double, simd_abi::sse> const& b) {
@@ -394,6 +596,13 @@ SIMD_ALWAYS_INLINE inline simd<double, simd_abi::sse> fma(
     simd<double, simd_abi::sse> const& c) {
   return simd<double, simd_abi::sse>(_mm_fmadd_pd(a.get(), b.get(), c.get()));
 }
+#else
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::sse> fma(
+    simd<double, simd_abi::sse> const& a,
+    simd<double, simd_abi::sse> const& b,
+    simd<double, simd_abi::sse> const& c) {
+  return simd<double, simd_abi::sse>(_mm_add_pd(_mm_mul_pd(a.get(), b.get()), c.get()));
+}
 #endif
 
 SIMD_ALWAYS_INLINE inline simd<double, simd_abi::sse> max(
@@ -409,11 +618,701 @@ SIMD_ALWAYS_INLINE inline simd<double, simd_abi::sse> min(
 SIMD_ALWAYS_INLINE inline simd<double, simd_abi::sse> choose(
     simd_mask<double, simd_abi::sse> const& a, simd<double, simd_abi::sse> const& b, simd<double, simd_abi::sse> const& c) {
   return simd<double, simd_abi::sse>(
-      _mm_add_pd(
+      _mm_or_pd(
         _mm_and_pd(a.get(), b.get()),
         _mm_andnot_pd(a.get(), c.get())));
 }
 
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::sse> roundeven(simd<double, simd_abi::sse> const& a) {
+#ifdef __SSE4_1__
+  return simd<double, simd_abi::sse>(_mm_round_pd(a.get(), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+#else
+  // adding and subtracting 2^52 drops the fraction bits; larger values are already integral
+  __m128d const sign_mask = _mm_set1_pd(-0.);
+  __m128d const two52 = _mm_set1_pd(4503599627370496.);
+  __m128d const sign = _mm_and_pd(sign_mask, a.get());
+  __m128d const magic = _mm_or_pd(two52, sign);
+  __m128d const rounded = _mm_or_pd(_mm_sub_pd(_mm_add_pd(a.get(), magic), magic), sign);
+  __m128d const is_small = _mm_cmplt_pd(_mm_andnot_pd(sign_mask, a.get()), two52);
+  return simd<double, simd_abi::sse>(_mm_or_pd(_mm_and_pd(is_small, rounded), _mm_andnot_pd(is_small, a.get())));
+#endif
+}
+
+#ifdef __SSE4_1__
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::sse> floor(simd<double, simd_abi::sse> const& a) {
+  return simd<double, simd_abi::sse>(_mm_round_pd(a.get(), _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::sse> ceil(simd<double, simd_abi::sse> const& a) {
+  return simd<double, simd_abi::sse>(_mm_round_pd(a.get(), _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::sse> trunc(simd<double, simd_abi::sse> const& a) {
+  return simd<double, simd_abi::sse>(_mm_round_pd(a.get(), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::sse> nearbyint(simd<double, simd_abi::sse> const& a) {
+  return simd<double, simd_abi::sse>(_mm_round_pd(a.get(), _MM_FROUND_CUR_DIRECTION | _MM_FROUND_NO_EXC));
+}
+#endif
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::sse> pow2i(simd<double, simd_abi::sse> const& n) {
+  // the low bits of 2^52 + 1023 + n hold the biased exponent of 2^n
+  __m128d const biased = _mm_add_pd(n.get(), _mm_set1_pd(4503599627371519.));
+  return simd<double, simd_abi::sse>(_mm_castsi128_pd(_mm_slli_epi64(_mm_castpd_si128(biased), 52)));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::sse> getexp(simd<double, simd_abi::sse> const& a) {
+  __m128i const biased = _mm_srli_epi64(_mm_slli_epi64(_mm_castpd_si128(a.get()), 1), 53);
+  __m128d const two52 = _mm_set1_pd(4503599627370496.);
+  return simd<double, simd_abi::sse>(_mm_sub_pd(_mm_or_pd(_mm_castsi128_pd(biased), two52), _mm_set1_pd(4503599627371519.)));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::sse> getmant(simd<double, simd_abi::sse> const& a) {
+  __m128d const mantissa_mask = _mm_castsi128_pd(_mm_set1_epi64x(0x000FFFFFFFFFFFFF));
+  return simd<double, simd_abi::sse>(_mm_or_pd(_mm_and_pd(mantissa_mask, a.get()), _mm_set1_pd(1.)));
+}
+
+/* Integer lanes.  SSE2 has no 32-bit low multiply, no 64-bit compares and
+   no 64-bit arithmetic shift, so those are assembled from the 32-bit
+   instructions unless SSE4.1, SSE4.2 or AVX-512VL provide them, and
+   integer division goes lane by lane on every ABI.
+ */
+
+template <>
+class simd_mask<std::int32_t, simd_abi::sse> {
+  __m128i m_value;
+ public:
+  using value_type = bool;
+  using simd_type = simd<std::int32_t, simd_abi::sse>;
+  using abi_type = simd_abi::sse;
+  SIMD_ALWAYS_INLINE inline simd_mask() = default;
+  SIMD_ALWAYS_INLINE inline simd_mask(bool value)
+    :m_value(_mm_set1_epi32(-int(value)))
+  {}
+  SIMD_ALWAYS_INLINE inline static constexpr int size() { return 4; }
+  SIMD_ALWAYS_INLINE inline constexpr simd_mask(__m128i const& value_in)
+    :m_value(value_in)
+  {}
+  SIMD_ALWAYS_INLINE inline constexpr __m128i get() const { return m_value; }
+  SIMD_ALWAYS_INLINE inline simd_mask operator||(simd_mask const& other) const {
+    return simd_mask(_mm_or_si128(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask operator&&(simd_mask const& other) const {
+    return simd_mask(_mm_and_si128(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask operator!() const {
+    return simd_mask(_mm_andnot_si128(m_value, simd_mask(true).get()));
+  }
+};
+
+SIMD_ALWAYS_INLINE inline bool all_of(simd_mask<std::int32_t, simd_abi::sse> const& a) {
+  return _mm_movemask_ps(_mm_castsi128_ps(a.get())) == 0xF;
+}
+
+SIMD_ALWAYS_INLINE inline bool any_of(simd_mask<std::int32_t, simd_abi::sse> const& a) {
+  return _mm_movemask_ps(_mm_castsi128_ps(a.get())) != 0x0;
+}
+
+SIMD_ALWAYS_INLINE inline std::uint64_t to_bitmask(simd_mask<std::int32_t, simd_abi::sse> const& a) {
+  return std::uint64_t(_mm_movemask_ps(_mm_castsi128_ps(a.get())));
+}
+
+SIMD_ALWAYS_INLINE inline simd_mask<std::int32_t, simd_abi::sse> from_bitmask(std::uint64_t bits, simd_mask<std::int32_t, simd_abi::sse> const*) {
+  __m128i const lane_bits = _mm_setr_epi32(1, 2, 4, 8);
+  __m128i const set = _mm_and_si128(_mm_set1_epi32(int(bits)), lane_bits);
+  return simd_mask<std::int32_t, simd_abi::sse>(_mm_cmpeq_epi32(set, lane_bits));
+}
+
+template <>
+class simd<std::int32_t, simd_abi::sse> {
+  __m128i m_value;
+ public:
+  using value_type = std::int32_t;
+  using abi_type = simd_abi::sse;
+  using mask_type = simd_mask<std::int32_t, abi_type>;
+  using storage_type = simd_storage<std::int32_t, abi_type>;
+  SIMD_ALWAYS_INLINE inline simd() = default;
+  SIMD_ALWAYS_INLINE inline static constexpr int size() { return 4; }
+  SIMD_ALWAYS_INLINE inline simd(std::int32_t value)
+    :m_value(_mm_set1_epi32(value))
+  {}
+  SIMD_ALWAYS_INLINE inline simd(
+      std::int32_t a, std::int32_t b, std::int32_t c, std::int32_t d)
+    :m_value(_mm_setr_epi32(a, b, c, d))
+  {}
+  SIMD_ALWAYS_INLINE inline
+  simd(storage_type const& value) {
+    copy_from(value.data(), vector_aligned_tag());
+  }
+  SIMD_ALWAYS_INLINE inline
+  simd& operator=(storage_type const& value) {
+    copy_from(value.data(), vector_aligned_tag());
+    return *this;
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline simd(std::int32_t const* ptr, Flags flags) {
+    copy_from(ptr, flags);
+  }
+  SIMD_ALWAYS_INLINE inline simd(std::int32_t const* ptr, int stride)
+    :simd(ptr[0], ptr[stride], ptr[2*stride], ptr[3*stride])
+  {}
+  SIMD_ALWAYS_INLINE inline constexpr simd(__m128i const& value_in)
+    :m_value(value_in)
+  {}
+  SIMD_ALWAYS_INLINE inline simd operator*(simd const& other) const {
+#ifdef __SSE4_1__
+    return simd(_mm_mullo_epi32(m_value, other.m_value));
+#else
+    // pmuludq multiplies lanes 0 and 2 into 64 bits; the low halves of the products are the result
+    __m128i const even = _mm_mul_epu32(m_value, other.m_value);
+    __m128i const odd = _mm_mul_epu32(_mm_srli_epi64(m_value, 32), _mm_srli_epi64(other.m_value, 32));
+    return simd(_mm_unpacklo_epi32(
+          _mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+          _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0))));
+#endif
+  }
+  SIMD_ALWAYS_INLINE inline simd operator/(simd const& other) const {
+    std::int32_t a[4], b[4];
+    copy_to(a, element_aligned_tag());
+    other.copy_to(b, element_aligned_tag());
+    for (int i = 0; i < 4; ++i) a[i] /= b[i];
+    return simd(a, element_aligned_tag());
+  }
+  SIMD_ALWAYS_INLINE inline simd operator+(simd const& other) const {
+    return simd(_mm_add_epi32(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator-(simd const& other) const {
+    return simd(_mm_sub_epi32(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator-() const {
+    return simd(_mm_sub_epi32(_mm_setzero_si128(), m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator&(simd const& other) const {
+    return simd(_mm_and_si128(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator|(simd const& other) const {
+    return simd(_mm_or_si128(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator^(simd const& other) const {
+    return simd(_mm_xor_si128(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator~() const {
+    return simd(_mm_xor_si128(m_value, _mm_set1_epi32(-1)));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator<<(int shift) const {
+    return simd(_mm_sll_epi32(m_value, _mm_cvtsi32_si128(shift)));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator>>(int shift) const {
+    return simd(_mm_sra_epi32(m_value, _mm_cvtsi32_si128(shift)));
+  }
+  SIMD_ALWAYS_INLINE inline void copy_from(std::int32_t const* ptr, element_aligned_tag) {
+    m_value = _mm_loadu_si128(reinterpret_cast<__m128i const*>(ptr));
+  }
+  SIMD_ALWAYS_INLINE inline void copy_to(std::int32_t* ptr, element_aligned_tag) const {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), m_value);
+  }
+  SIMD_ALWAYS_INLINE inline void copy_from(std::int32_t const* ptr, vector_aligned_tag) {
+    m_value = _mm_load_si128(reinterpret_cast<__m128i const*>(ptr));
+  }
+  SIMD_ALWAYS_INLINE inline void copy_to(std::int32_t* ptr, vector_aligned_tag) const {
+    _mm_store_si128(reinterpret_cast<__m128i*>(ptr), m_value);
+  }
+  SIMD_ALWAYS_INLINE inline void copy_to(std::int32_t* ptr, nontemporal_tag) const {
+    _mm_stream_si128(reinterpret_cast<__m128i*>(ptr), m_value);
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline void copy_from(std::int32_t const* ptr, mask_type const& mask, Flags /*flags*/) {
+#ifdef __AVX__
+    __m128 const loaded = _mm_maskload_ps(reinterpret_cast<float const*>(ptr), mask.get());
+    m_value = _mm_castps_si128(_mm_blendv_ps(_mm_castsi128_ps(m_value), loaded, _mm_castsi128_ps(mask.get())));
+#else
+    impl::masked_copy_from(this, ptr, mask);
+#endif
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline void copy_to(std::int32_t* ptr, mask_type const& mask, Flags /*flags*/) const {
+#ifdef __AVX__
+    _mm_maskstore_ps(reinterpret_cast<float*>(ptr), mask.get(), _mm_castsi128_ps(m_value));
+#else
+    impl::masked_copy_to(*this, ptr, mask);
+#endif
+  }
+  template <std::size_t N>
+  SIMD_ALWAYS_INLINE inline void copy_from(std::int32_t const* ptr, overaligned_tag<N>) {
+    copy_from(ptr, impl::overaligned_as<N, alignof(simd)>());
+  }
+  template <std::size_t N>
+  SIMD_ALWAYS_INLINE inline void copy_to(std::int32_t* ptr, overaligned_tag<N>) const {
+    copy_to(ptr, impl::overaligned_as<N, alignof(simd)>());
+  }
+  SIMD_ALWAYS_INLINE inline constexpr __m128i get() const { return m_value; }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int32_t, simd_abi::sse> operator<(simd const& other) const {
+    return simd_mask<std::int32_t, simd_abi::sse>(_mm_cmplt_epi32(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int32_t, simd_abi::sse> operator==(simd const& other) const {
+    return simd_mask<std::int32_t, simd_abi::sse>(_mm_cmpeq_epi32(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int32_t, simd_abi::sse> operator>(simd const& other) const {
+    return other < *this;
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int32_t, simd_abi::sse> operator<=(simd const& other) const {
+    return !(other < *this);
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int32_t, simd_abi::sse> operator>=(simd const& other) const {
+    return !(*this < other);
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int32_t, simd_abi::sse> operator!=(simd const& other) const {
+    return !(*this == other);
+  }
+};
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::sse> choose(
+    simd_mask<std::int32_t, simd_abi::sse> const& a, simd<std::int32_t, simd_abi::sse> const& b, simd<std::int32_t, simd_abi::sse> const& c) {
+  return simd<std::int32_t, simd_abi::sse>(_mm_or_si128(_mm_and_si128(a.get(), b.get()), _mm_andnot_si128(a.get(), c.get())));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::sse> abs(simd<std::int32_t, simd_abi::sse> const& a) {
+#ifdef __SSSE3__
+  return simd<std::int32_t, simd_abi::sse>(_mm_abs_epi32(a.get()));
+#else
+  __m128i const sign = _mm_srai_epi32(a.get(), 31);
+  return simd<std::int32_t, simd_abi::sse>(_mm_sub_epi32(_mm_xor_si128(a.get(), sign), sign));
+#endif
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::sse> max(
+    simd<std::int32_t, simd_abi::sse> const& a, simd<std::int32_t, simd_abi::sse> const& b) {
+#ifdef __SSE4_1__
+  return simd<std::int32_t, simd_abi::sse>(_mm_max_epi32(a.get(), b.get()));
+#else
+  return choose(b < a, a, b);
+#endif
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::sse> min(
+    simd<std::int32_t, simd_abi::sse> const& a, simd<std::int32_t, simd_abi::sse> const& b) {
+#ifdef __SSE4_1__
+  return simd<std::int32_t, simd_abi::sse>(_mm_min_epi32(a.get(), b.get()));
+#else
+  return choose(a < b, a, b);
+#endif
+}
+
+template <>
+class simd_mask<std::int64_t, simd_abi::sse> {
+  __m128i m_value;
+ public:
+  using value_type = bool;
+  using simd_type = simd<std::int64_t, simd_abi::sse>;
+  using abi_type = simd_abi::sse;
+  SIMD_ALWAYS_INLINE inline simd_mask() = default;
+  SIMD_ALWAYS_INLINE inline simd_mask(bool value)
+    :m_value(_mm_set1_epi64x(-std::int64_t(value)))
+  {}
+  SIMD_ALWAYS_INLINE inline static constexpr int size() { return 2; }
+  SIMD_ALWAYS_INLINE inline constexpr simd_mask(__m128i const& value_in)
+    :m_value(value_in)
+  {}
+  SIMD_ALWAYS_INLINE inline constexpr __m128i get() const { return m_value; }
+  SIMD_ALWAYS_INLINE inline simd_mask operator||(simd_mask const& other) const {
+    return simd_mask(_mm_or_si128(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask operator&&(simd_mask const& other) const {
+    return simd_mask(_mm_and_si128(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask operator!() const {
+    return simd_mask(_mm_andnot_si128(m_value, simd_mask(true).get()));
+  }
+};
+
+SIMD_ALWAYS_INLINE inline bool all_of(simd_mask<std::int64_t, simd_abi::sse> const& a) {
+  return _mm_movemask_pd(_mm_castsi128_pd(a.get())) == 0x3;
+}
+
+SIMD_ALWAYS_INLINE inline bool any_of(simd_mask<std::int64_t, simd_abi::sse> const& a) {
+  return _mm_movemask_pd(_mm_castsi128_pd(a.get())) != 0x0;
+}
+
+SIMD_ALWAYS_INLINE inline std::uint64_t to_bitmask(simd_mask<std::int64_t, simd_abi::sse> const& a) {
+  return std::uint64_t(_mm_movemask_pd(_mm_castsi128_pd(a.get())));
+}
+
+SIMD_ALWAYS_INLINE inline simd_mask<std::int64_t, simd_abi::sse> from_bitmask(std::uint64_t bits, simd_mask<std::int64_t, simd_abi::sse> const*) {
+  __m128i const lane_bits = _mm_setr_epi32(1, 1, 2, 2);
+  __m128i const set = _mm_and_si128(_mm_set1_epi32(int(bits)), lane_bits);
+  return simd_mask<std::int64_t, simd_abi::sse>(_mm_cmpeq_epi32(set, lane_bits));
+}
+
+template <>
+class simd<std::int64_t, simd_abi::sse> {
+  __m128i m_value;
+ public:
+  using value_type = std::int64_t;
+  using abi_type = simd_abi::sse;
+  using mask_type = simd_mask<std::int64_t, abi_type>;
+  using storage_type = simd_storage<std::int64_t, abi_type>;
+  SIMD_ALWAYS_INLINE inline simd() = default;
+  SIMD_ALWAYS_INLINE inline static constexpr int size() { return 2; }
+  SIMD_ALWAYS_INLINE inline simd(std::int64_t value)
+    :m_value(_mm_set1_epi64x(value))
+  {}
+  SIMD_ALWAYS_INLINE inline simd(std::int64_t a, std::int64_t b)
+    :m_value(_mm_set_epi64x(b, a))
+  {}
+  SIMD_ALWAYS_INLINE inline
+  simd(storage_type const& value) {
+    copy_from(value.data(), vector_aligned_tag());
+  }
+  SIMD_ALWAYS_INLINE inline
+  simd& operator=(storage_type const& value) {
+    copy_from(value.data(), vector_aligned_tag());
+    return *this;
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline simd(std::int64_t const* ptr, Flags flags) {
+    copy_from(ptr, flags);
+  }
+  SIMD_ALWAYS_INLINE inline simd(std::int64_t const* ptr, int stride)
+    :simd(ptr[0], ptr[stride])
+  {}
+  SIMD_ALWAYS_INLINE inline constexpr simd(__m128i const& value_in)
+    :m_value(value_in)
+  {}
+  SIMD_ALWAYS_INLINE inline simd operator*(simd const& other) const {
+#if defined(__AVX512DQ__) && defined(__AVX512VL__)
+    return simd(_mm_mullo_epi64(m_value, other.m_value));
+#else
+    // lo*lo + ((hi*lo + lo*hi) << 32), the hi*hi term falls off the top
+    __m128i const cross = _mm_add_epi64(
+        _mm_mul_epu32(_mm_srli_epi64(m_value, 32), other.m_value),
+        _mm_mul_epu32(m_value, _mm_srli_epi64(other.m_value, 32)));
+    return simd(_mm_add_epi64(_mm_mul_epu32(m_value, other.m_value), _mm_slli_epi64(cross, 32)));
+#endif
+  }
+  SIMD_ALWAYS_INLINE inline simd operator/(simd const& other) const {
+    std::int64_t a[2], b[2];
+    copy_to(a, element_aligned_tag());
+    other.copy_to(b, element_aligned_tag());
+    for (int i = 0; i < 2; ++i) a[i] /= b[i];
+    return simd(a, element_aligned_tag());
+  }
+  SIMD_ALWAYS_INLINE inline simd operator+(simd const& other) const {
+    return simd(_mm_add_epi64(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator-(simd const& other) const {
+    return simd(_mm_sub_epi64(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator-() const {
+    return simd(_mm_sub_epi64(_mm_setzero_si128(), m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator&(simd const& other) const {
+    return simd(_mm_and_si128(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator|(simd const& other) const {
+    return simd(_mm_or_si128(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator^(simd const& other) const {
+    return simd(_mm_xor_si128(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator~() const {
+    return simd(_mm_xor_si128(m_value, _mm_set1_epi32(-1)));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator<<(int shift) const {
+    return simd(_mm_sll_epi64(m_value, _mm_cvtsi32_si128(shift)));
+  }
+  SIMD_ALWAYS_INLINE inline simd operator>>(int shift) const {
+#ifdef __AVX512VL__
+    return simd(_mm_sra_epi64(m_value, _mm_cvtsi32_si128(shift)));
+#else
+    // shift in copies of the sign from the left; a shift by 64 gives zero
+    __m128i const sign = _mm_srai_epi32(_mm_shuffle_epi32(m_value, _MM_SHUFFLE(3, 3, 1, 1)), 31);
+    return simd(_mm_or_si128(
+          _mm_srl_epi64(m_value, _mm_cvtsi32_si128(shift)),
+          _mm_sll_epi64(sign, _mm_cvtsi32_si128(64 - shift))));
+#endif
+  }
+  SIMD_ALWAYS_INLINE inline void copy_from(std::int64_t const* ptr, element_aligned_tag) {
+    m_value = _mm_loadu_si128(reinterpret_cast<__m128i const*>(ptr));
+  }
+  SIMD_ALWAYS_INLINE inline void copy_to(std::int64_t* ptr, element_aligned_tag) const {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), m_value);
+  }
+  SIMD_ALWAYS_INLINE inline void copy_from(std::int64_t const* ptr, vector_aligned_tag) {
+    m_value = _mm_load_si128(reinterpret_cast<__m128i const*>(ptr));
+  }
+  SIMD_ALWAYS_INLINE inline void copy_to(std::int64_t* ptr, vector_aligned_tag) const {
+    _mm_store_si128(reinterpret_cast<__m128i*>(ptr), m_value);
+  }
+  SIMD_ALWAYS_INLINE inline void copy_to(std::int64_t* ptr, nontemporal_tag) const {
+    _mm_stream_si128(reinterpret_cast<__m128i*>(ptr), m_value);
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline void copy_from(std::int64_t const* ptr, mask_type const& mask, Flags /*flags*/) {
+#ifdef __AVX__
+    __m128d const loaded = _mm_maskload_pd(reinterpret_cast<double const*>(ptr), mask.get());
+    m_value = _mm_castpd_si128(_mm_blendv_pd(_mm_castsi128_pd(m_value), loaded, _mm_castsi128_pd(mask.get())));
+#else
+    impl::masked_copy_from(this, ptr, mask);
+#endif
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline void copy_to(std::int64_t* ptr, mask_type const& mask, Flags /*flags*/) const {
+#ifdef __AVX__
+    _mm_maskstore_pd(reinterpret_cast<double*>(ptr), mask.get(), _mm_castsi128_pd(m_value));
+#else
+    impl::masked_copy_to(*this, ptr, mask);
+#endif
+  }
+  template <std::size_t N>
+  SIMD_ALWAYS_INLINE inline void copy_from(std::int64_t const* ptr, overaligned_tag<N>) {
+    copy_from(ptr, impl::overaligned_as<N, alignof(simd)>());
+  }
+  template <std::size_t N>
+  SIMD_ALWAYS_INLINE inline void copy_to(std::int64_t* ptr, overaligned_tag<N>) const {
+    copy_to(ptr, impl::overaligned_as<N, alignof(simd)>());
+  }
+  SIMD_ALWAYS_INLINE inline constexpr __m128i get() const { return m_value; }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int64_t, simd_abi::sse> operator<(simd const& other) const {
+#ifdef __SSE4_2__
+    return simd_mask<std::int64_t, simd_abi::sse>(_mm_cmpgt_epi64(other.m_value, m_value));
+#else
+    // compare the high halves, and where they are equal take the borrow of the low ones,
+    // then copy each high-half verdict over its lane
+    __m128i const low_borrow = _mm_and_si128(_mm_cmpeq_epi32(other.m_value, m_value), _mm_sub_epi64(m_value, other.m_value));
+    __m128i const verdict = _mm_or_si128(low_borrow, _mm_cmpgt_epi32(other.m_value, m_value));
+    return simd_mask<std::int64_t, simd_abi::sse>(_mm_shuffle_epi32(verdict, _MM_SHUFFLE(3, 3, 1, 1)));
+#endif
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int64_t, simd_abi::sse> operator==(simd const& other) const {
+#ifdef __SSE4_1__
+    return simd_mask<std::int64_t, simd_abi::sse>(_mm_cmpeq_epi64(m_value, other.m_value));
+#else
+    __m128i const halves_equal = _mm_cmpeq_epi32(m_value, other.m_value);
+    return simd_mask<std::int64_t, simd_abi::sse>(
+        _mm_and_si128(halves_equal, _mm_shuffle_epi32(halves_equal, _MM_SHUFFLE(2, 3, 0, 1))));
+#endif
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int64_t, simd_abi::sse> operator>(simd const& other) const {
+    return other < *this;
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int64_t, simd_abi::sse> operator<=(simd const& other) const {
+    return !(other < *this);
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int64_t, simd_abi::sse> operator>=(simd const& other) const {
+    return !(*this < other);
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<std::int64_t, simd_abi::sse> operator!=(simd const& other) const {
+    return !(*this == other);
+  }
+};
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::sse> choose(
+    simd_mask<std::int64_t, simd_abi::sse> const& a, simd<std::int64_t, simd_abi::sse> const& b, simd<std::int64_t, simd_abi::sse> const& c) {
+  return simd<std::int64_t, simd_abi::sse>(_mm_or_si128(_mm_and_si128(a.get(), b.get()), _mm_andnot_si128(a.get(), c.get())));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::sse> abs(simd<std::int64_t, simd_abi::sse> const& a) {
+#ifdef __AVX512VL__
+  return simd<std::int64_t, simd_abi::sse>(_mm_abs_epi64(a.get()));
+#else
+  __m128i const sign = _mm_srai_epi32(_mm_shuffle_epi32(a.get(), _MM_SHUFFLE(3, 3, 1, 1)), 31);
+  return simd<std::int64_t, simd_abi::sse>(_mm_sub_epi64(_mm_xor_si128(a.get(), sign), sign));
+#endif
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::sse> max(
+    simd<std::int64_t, simd_abi::sse> const& a, simd<std::int64_t, simd_abi::sse> const& b) {
+#ifdef __AVX512VL__
+  return simd<std::int64_t, simd_abi::sse>(_mm_max_epi64(a.get(), b.get()));
+#else
+  return choose(b < a, a, b);
+#endif
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::sse> min(
+    simd<std::int64_t, simd_abi::sse> const& a, simd<std::int64_t, simd_abi::sse> const& b) {
+#ifdef __AVX512VL__
+  return simd<std::int64_t, simd_abi::sse>(_mm_min_epi64(a.get(), b.get()));
+#else
+  return choose(a < b, a, b);
+#endif
+}
+
+
+/* Horizontal sums, minima and maxima, folding the upper half of the lanes
+   onto the lower half like the fallbacks in simd_common.hpp.
+ */
+
+SIMD_ALWAYS_INLINE inline float reduce(simd<float, simd_abi::sse> const& a, std::plus<>) {
+  __m128 const t = _mm_add_ps(a.get(), _mm_movehl_ps(a.get(), a.get()));
+  return _mm_cvtss_f32(_mm_add_ss(t, _mm_shuffle_ps(t, t, 1)));
+}
+
+SIMD_ALWAYS_INLINE inline float hmin(simd<float, simd_abi::sse> const& a) {
+  __m128 const t = _mm_min_ps(a.get(), _mm_movehl_ps(a.get(), a.get()));
+  return _mm_cvtss_f32(_mm_min_ss(t, _mm_shuffle_ps(t, t, 1)));
+}
+
+SIMD_ALWAYS_INLINE inline float hmax(simd<float, simd_abi::sse> const& a) {
+  __m128 const t = _mm_max_ps(a.get(), _mm_movehl_ps(a.get(), a.get()));
+  return _mm_cvtss_f32(_mm_max_ss(t, _mm_shuffle_ps(t, t, 1)));
+}
+
+SIMD_ALWAYS_INLINE inline double reduce(simd<double, simd_abi::sse> const& a, std::plus<>) {
+  return _mm_cvtsd_f64(_mm_add_sd(a.get(), _mm_unpackhi_pd(a.get(), a.get())));
+}
+
+SIMD_ALWAYS_INLINE inline double hmin(simd<double, simd_abi::sse> const& a) {
+  return _mm_cvtsd_f64(_mm_min_sd(a.get(), _mm_unpackhi_pd(a.get(), a.get())));
+}
+
+SIMD_ALWAYS_INLINE inline double hmax(simd<double, simd_abi::sse> const& a) {
+  return _mm_cvtsd_f64(_mm_max_sd(a.get(), _mm_unpackhi_pd(a.get(), a.get())));
+}
+
+/* Conversions, the building blocks of static_simd_cast and friends.
+   cvtt* truncate and cvt* round in the current rounding mode; both give
+   0x80000000 for lanes that do not fit in an int32_t.
+ */
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::sse> convert(
+    simd<std::int32_t, simd_abi::sse> const& a, simd<float, simd_abi::sse> const*, impl::truncating_tag) {
+  return simd<float, simd_abi::sse>(_mm_cvtepi32_ps(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::sse> convert(
+    simd<float, simd_abi::sse> const& a, simd<std::int32_t, simd_abi::sse> const*, impl::truncating_tag) {
+  return simd<std::int32_t, simd_abi::sse>(_mm_cvttps_epi32(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::sse> convert(
+    simd<float, simd_abi::sse> const& a, simd<std::int32_t, simd_abi::sse> const*, impl::rounding_tag) {
+  return simd<std::int32_t, simd_abi::sse>(_mm_cvtps_epi32(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::sse> convert(
+    simd<float, simd_abi::sse> const& a, simd<std::int32_t, simd_abi::sse> const*, impl::saturating_tag) {
+  // flip 0x80000000 to 0x7FFFFFFF where a is too large, and clear NaN lanes
+  __m128 const too_large = _mm_cmpge_ps(a.get(), _mm_set1_ps(2147483648.0f));
+  __m128i const r = _mm_xor_si128(_mm_cvttps_epi32(a.get()), _mm_castps_si128(too_large));
+  return simd<std::int32_t, simd_abi::sse>(_mm_and_si128(r, _mm_castps_si128(_mm_cmpord_ps(a.get(), a.get()))));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::sse> convert(
+    simd<double, simd_abi::sse> const& lo, simd<double, simd_abi::sse> const& hi,
+    simd<float, simd_abi::sse> const*, impl::truncating_tag) {
+  return simd<float, simd_abi::sse>(_mm_movelh_ps(_mm_cvtpd_ps(lo.get()), _mm_cvtpd_ps(hi.get())));
+}
+
+SIMD_ALWAYS_INLINE inline void convert(
+    simd<float, simd_abi::sse> const& a, simd<double, simd_abi::sse>* lo, simd<double, simd_abi::sse>* hi,
+    impl::truncating_tag) {
+  *lo = simd<double, simd_abi::sse>(_mm_cvtps_pd(a.get()));
+  *hi = simd<double, simd_abi::sse>(_mm_cvtps_pd(_mm_movehl_ps(a.get(), a.get())));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::sse> convert(
+    simd<double, simd_abi::sse> const& lo, simd<double, simd_abi::sse> const& hi,
+    simd<std::int32_t, simd_abi::sse> const*, impl::truncating_tag) {
+  return simd<std::int32_t, simd_abi::sse>(_mm_unpacklo_epi64(_mm_cvttpd_epi32(lo.get()), _mm_cvttpd_epi32(hi.get())));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::sse> convert(
+    simd<double, simd_abi::sse> const& lo, simd<double, simd_abi::sse> const& hi,
+    simd<std::int32_t, simd_abi::sse> const*, impl::rounding_tag) {
+  return simd<std::int32_t, simd_abi::sse>(_mm_unpacklo_epi64(_mm_cvtpd_epi32(lo.get()), _mm_cvtpd_epi32(hi.get())));
+}
+
+SIMD_ALWAYS_INLINE inline void convert(
+    simd<std::int32_t, simd_abi::sse> const& a, simd<double, simd_abi::sse>* lo, simd<double, simd_abi::sse>* hi,
+    impl::truncating_tag) {
+  *lo = simd<double, simd_abi::sse>(_mm_cvtepi32_pd(a.get()));
+  *hi = simd<double, simd_abi::sse>(_mm_cvtepi32_pd(_mm_unpackhi_epi64(a.get(), a.get())));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::sse> convert(
+    simd<std::int64_t, simd_abi::sse> const& lo, simd<std::int64_t, simd_abi::sse> const& hi,
+    simd<std::int32_t, simd_abi::sse> const*, impl::truncating_tag) {
+  __m128 const r = _mm_shuffle_ps(_mm_castsi128_ps(lo.get()), _mm_castsi128_ps(hi.get()), _MM_SHUFFLE(2, 0, 2, 0));
+  return simd<std::int32_t, simd_abi::sse>(_mm_castps_si128(r));
+}
+
+SIMD_ALWAYS_INLINE inline void convert(
+    simd<std::int32_t, simd_abi::sse> const& a, simd<std::int64_t, simd_abi::sse>* lo, simd<std::int64_t, simd_abi::sse>* hi,
+    impl::truncating_tag) {
+  __m128i const sign = _mm_srai_epi32(a.get(), 31);
+  *lo = simd<std::int64_t, simd_abi::sse>(_mm_unpacklo_epi32(a.get(), sign));
+  *hi = simd<std::int64_t, simd_abi::sse>(_mm_unpackhi_epi32(a.get(), sign));
+}
+
+
+/* Permutations within one register are single shuffles. */
+
+template <int I0, int I1, int I2, int I3>
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::sse> permute(
+    simd<float, simd_abi::sse> const& a, std::integer_sequence<int, I0, I1, I2, I3>) {
+  return simd<float, simd_abi::sse>(_mm_shuffle_ps(a.get(), a.get(), _MM_SHUFFLE(I3, I2, I1, I0)));
+}
+
+template <int I0, int I1>
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::sse> permute(
+    simd<double, simd_abi::sse> const& a, std::integer_sequence<int, I0, I1>) {
+  return simd<double, simd_abi::sse>(_mm_shuffle_pd(a.get(), a.get(), I0 | (I1 << 1)));
+}
+
+template <int I0, int I1, int I2, int I3>
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::sse> permute(
+    simd<std::int32_t, simd_abi::sse> const& a, std::integer_sequence<int, I0, I1, I2, I3>) {
+  return simd<std::int32_t, simd_abi::sse>(_mm_shuffle_epi32(a.get(), _MM_SHUFFLE(I3, I2, I1, I0)));
+}
+
+template <int I0, int I1>
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::sse> permute(
+    simd<std::int64_t, simd_abi::sse> const& a, std::integer_sequence<int, I0, I1>) {
+  return simd<std::int64_t, simd_abi::sse>(_mm_shuffle_epi32(a.get(), _MM_SHUFFLE(2 * I1 + 1, 2 * I1, 2 * I0 + 1, 2 * I0)));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::sse> interleave_lo(
+    simd<float, simd_abi::sse> const& a, simd<float, simd_abi::sse> const& b) {
+  return simd<float, simd_abi::sse>(_mm_unpacklo_ps(a.get(), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::sse> interleave_hi(
+    simd<float, simd_abi::sse> const& a, simd<float, simd_abi::sse> const& b) {
+  return simd<float, simd_abi::sse>(_mm_unpackhi_ps(a.get(), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::sse> interleave_lo(
+    simd<double, simd_abi::sse> const& a, simd<double, simd_abi::sse> const& b) {
+  return simd<double, simd_abi::sse>(_mm_unpacklo_pd(a.get(), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::sse> interleave_hi(
+    simd<double, simd_abi::sse> const& a, simd<double, simd_abi::sse> const& b) {
+  return simd<double, simd_abi::sse>(_mm_unpackhi_pd(a.get(), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::sse> interleave_lo(
+    simd<std::int32_t, simd_abi::sse> const& a, simd<std::int32_t, simd_abi::sse> const& b) {
+  return simd<std::int32_t, simd_abi::sse>(_mm_unpacklo_epi32(a.get(), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int32_t, simd_abi::sse> interleave_hi(
+    simd<std::int32_t, simd_abi::sse> const& a, simd<std::int32_t, simd_abi::sse> const& b) {
+  return simd<std::int32_t, simd_abi::sse>(_mm_unpackhi_epi32(a.get(), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::sse> interleave_lo(
+    simd<std::int64_t, simd_abi::sse> const& a, simd<std::int64_t, simd_abi::sse> const& b) {
+  return simd<std::int64_t, simd_abi::sse>(_mm_unpacklo_epi64(a.get(), b.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<std::int64_t, simd_abi::sse> interleave_hi(
+    simd<std::int64_t, simd_abi::sse> const& a, simd<std::int64_t, simd_abi::sse> const& b) {
+  return simd<std::int64_t, simd_abi::sse>(_mm_unpackhi_epi64(a.get(), b.get()));
+}
+
 }
 
 #endif
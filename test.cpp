@@ -41,8 +41,15 @@
 //@HEADER
 */
 
+#include <algorithm>
+#include <functional>
 #include <iostream>
 #include <iomanip>
+#include <cstring>
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <type_traits>
 
 #include "simd.hpp"
 
@@ -71,6 +78,70 @@ void test_binary_op(
   }
 }
 
+template <class T>
+long long ulp_distance(T a, T b) {
+  if (a != a || b != b) return ((a != a) && (b != b)) ? 0 : std::numeric_limits<long long>::max();
+  if (a == b) return 0;
+  using bits_type = typename std::conditional<sizeof(T) == 8, std::int64_t, std::int32_t>::type;
+  bits_type ia, ib;
+  std::memcpy(&ia, &a, sizeof(T));
+  std::memcpy(&ib, &b, sizeof(T));
+  if (ia < 0) ia = std::numeric_limits<bits_type>::min() - ia;
+  if (ib < 0) ib = std::numeric_limits<bits_type>::min() - ib;
+  return std::llabs(static_cast<long long>(ia) - static_cast<long long>(ib));
+}
+
+template <class Abi, class T, class UnaryOp>
+void test_unary_op(
+    T const* a,
+    int n,
+    UnaryOp const& unary_op,
+    long long max_ulp) {
+  constexpr int size = simd::simd<T, Abi>::size();
+  using pack_abi = simd::simd_abi::pack<size>;
+  for (int offset = 0; offset + size <= n; offset += size) {
+    simd::simd<T, Abi> native_a(a + offset, simd::element_aligned_tag());
+    simd::simd<T, pack_abi> pack_a(a + offset, simd::element_aligned_tag());
+    simd::simd_storage<T, Abi> stored_native_answer(unary_op(native_a));
+    simd::simd_storage<T, pack_abi> stored_pack_answer(unary_op(pack_a));
+    for (int i = 0; i < size; ++i) {
+      if (ulp_distance(stored_native_answer[i], stored_pack_answer[i]) > max_ulp) {
+        std::cerr << std::setprecision(17) << "input " << a[offset + i]
+          << ": got " << stored_native_answer[i]
+          << ", expected " << stored_pack_answer[i] << '\n';
+        std::abort();
+      }
+    }
+  }
+}
+
+template <class Abi, class T, class BinaryOp>
+void test_binary_op(
+    T const* a,
+    T const* b,
+    int n,
+    BinaryOp const& binary_op,
+    long long max_ulp) {
+  constexpr int size = simd::simd<T, Abi>::size();
+  using pack_abi = simd::simd_abi::pack<size>;
+  for (int offset = 0; offset + size <= n; offset += size) {
+    simd::simd<T, Abi> native_a(a + offset, simd::element_aligned_tag());
+    simd::simd<T, Abi> native_b(b + offset, simd::element_aligned_tag());
+    simd::simd<T, pack_abi> pack_a(a + offset, simd::element_aligned_tag());
+    simd::simd<T, pack_abi> pack_b(b + offset, simd::element_aligned_tag());
+    simd::simd_storage<T, Abi> stored_native_answer(binary_op(native_a, native_b));
+    simd::simd_storage<T, pack_abi> stored_pack_answer(binary_op(pack_a, pack_b));
+    for (int i = 0; i < size; ++i) {
+      if (ulp_distance(stored_native_answer[i], stored_pack_answer[i]) > max_ulp) {
+        std::cerr << std::setprecision(17) << "inputs " << a[offset + i] << ", " << b[offset + i]
+          << ": got " << stored_native_answer[i]
+          << ", expected " << stored_pack_answer[i] << '\n';
+        std::abort();
+      }
+    }
+  }
+}
+
 struct plus {
   template <class T>
   T operator()(T const& a, T const& b) const {
@@ -99,6 +170,1223 @@ struct divides {
   }
 };
 
+struct exp_op {
+  template <class T>
+  T operator()(T const& a) const {
+    return simd::exp(a);
+  }
+};
+
+struct log_op {
+  template <class T>
+  T operator()(T const& a) const {
+    return simd::log(a);
+  }
+};
+
+struct sin_op {
+  template <class T>
+  T operator()(T const& a) const {
+    return simd::sin(a);
+  }
+};
+
+struct cos_op {
+  template <class T>
+  T operator()(T const& a) const {
+    return simd::cos(a);
+  }
+};
+
+struct sincos_sin_op {
+  template <class T>
+  T operator()(T const& a) const {
+    T s, c;
+    simd::sincos(a, &s, &c);
+    return s;
+  }
+};
+
+struct sincos_cos_op {
+  template <class T>
+  T operator()(T const& a) const {
+    T s, c;
+    simd::sincos(a, &s, &c);
+    return c;
+  }
+};
+
+struct atan_op {
+  template <class T>
+  T operator()(T const& a) const {
+    return simd::atan(a);
+  }
+};
+
+struct asin_op {
+  template <class T>
+  T operator()(T const& a) const {
+    return simd::asin(a);
+  }
+};
+
+struct acos_op {
+  template <class T>
+  T operator()(T const& a) const {
+    return simd::acos(a);
+  }
+};
+
+struct log2_op {
+  template <class T>
+  T operator()(T const& a) const {
+    return simd::log2(a);
+  }
+};
+
+struct log10_op {
+  template <class T>
+  T operator()(T const& a) const {
+    return simd::log10(a);
+  }
+};
+
+struct log1p_op {
+  template <class T>
+  T operator()(T const& a) const {
+    return simd::log1p(a);
+  }
+};
+
+struct expm1_op {
+  template <class T>
+  T operator()(T const& a) const {
+    return simd::expm1(a);
+  }
+};
+
+struct exp2_op {
+  template <class T>
+  T operator()(T const& a) const {
+    return simd::exp2(a);
+  }
+};
+
+struct sinh_op {
+  template <class T>
+  T operator()(T const& a) const {
+    return simd::sinh(a);
+  }
+};
+
+struct cosh_op {
+  template <class T>
+  T operator()(T const& a) const {
+    return simd::cosh(a);
+  }
+};
+
+struct tanh_op {
+  template <class T>
+  T operator()(T const& a) const {
+    return simd::tanh(a);
+  }
+};
+
+struct erf_op {
+  template <class T>
+  T operator()(T const& a) const {
+    return simd::erf(a);
+  }
+};
+
+struct erfc_op {
+  template <class T>
+  T operator()(T const& a) const {
+    return simd::erfc(a);
+  }
+};
+
+struct atan2_op {
+  template <class T>
+  T operator()(T const& a, T const& b) const {
+    return simd::atan2(a, b);
+  }
+};
+
+struct floor_op {
+  template <class T>
+  T operator()(T const& a) const {
+    return simd::floor(a);
+  }
+};
+
+struct ceil_op {
+  template <class T>
+  T operator()(T const& a) const {
+    return simd::ceil(a);
+  }
+};
+
+struct trunc_op {
+  template <class T>
+  T operator()(T const& a) const {
+    return simd::trunc(a);
+  }
+};
+
+struct round_op {
+  template <class T>
+  T operator()(T const& a) const {
+    return simd::round(a);
+  }
+};
+
+struct nearbyint_op {
+  template <class T>
+  T operator()(T const& a) const {
+    return simd::nearbyint(a);
+  }
+};
+
+struct fmod_op {
+  template <class T>
+  T operator()(T const& a, T const& b) const {
+    return simd::fmod(a, b);
+  }
+};
+
+struct remainder_op {
+  template <class T>
+  T operator()(T const& a, T const& b) const {
+    return simd::remainder(a, b);
+  }
+};
+
+struct ilogb_op {
+  template <class T>
+  T operator()(T const& a) const {
+    return simd::ilogb(a);
+  }
+};
+
+struct logb_op {
+  template <class T>
+  T operator()(T const& a) const {
+    return simd::logb(a);
+  }
+};
+
+struct frexp_mantissa_op {
+  template <class T>
+  T operator()(T const& a) const {
+    T e;
+    return simd::frexp(a, &e);
+  }
+};
+
+struct frexp_exponent_op {
+  template <class T>
+  T operator()(T const& a) const {
+    T e;
+    simd::frexp(a, &e);
+    return e;
+  }
+};
+
+struct ldexp_op {
+  template <class T>
+  T operator()(T const& a, T const& b) const {
+    return simd::ldexp(a, b);
+  }
+};
+
+struct pow_op {
+  template <class T>
+  T operator()(T const& a, T const& b) const {
+    return simd::pow(a, b);
+  }
+};
+
+struct rcp_op {
+  template <class T>
+  T operator()(T const& a) const {
+    return simd::rcp(a);
+  }
+};
+
+struct rsqrt_op {
+  template <class T>
+  T operator()(T const& a) const {
+    return simd::rsqrt(a);
+  }
+};
+
+struct rsqrt_three_steps_op {
+  template <class T>
+  T operator()(T const& a) const {
+    return simd::rsqrt<3>(a);
+  }
+};
+
+struct fast_div_op {
+  template <class T>
+  T operator()(T const& a, T const& b) const {
+    return simd::fast_div(a, b);
+  }
+};
+
+struct fast_exp_op {
+  template <class T>
+  T operator()(T const& a) const {
+    return simd::fast::exp(a);
+  }
+};
+
+struct fast_log_op {
+  template <class T>
+  T operator()(T const& a) const {
+    return simd::fast::log(a);
+  }
+};
+
+struct fast_sqrt_op {
+  template <class T>
+  T operator()(T const& a) const {
+    return simd::fast::sqrt(a);
+  }
+};
+
+struct fast_cbrt_op {
+  template <class T>
+  T operator()(T const& a) const {
+    return simd::fast::cbrt(a);
+  }
+};
+
+struct rcp_estimate_op {
+  template <class T>
+  T operator()(T const& a) const {
+    return simd::rcp<0>(a);
+  }
+};
+
+struct rsqrt_estimate_op {
+  template <class T>
+  T operator()(T const& a) const {
+    return simd::rsqrt<0>(a);
+  }
+};
+
+struct precise_div_op {
+  template <class T>
+  T operator()(T const& a, T const& b) const {
+    return simd::precise::div(a, b);
+  }
+};
+
+struct precise_exp_op {
+  template <class T>
+  T operator()(T const& a) const {
+    return simd::precise::exp(a);
+  }
+};
+
+struct precise_log_op {
+  template <class T>
+  T operator()(T const& a) const {
+    return simd::precise::log(a);
+  }
+};
+
+struct precise_sin_op {
+  template <class T>
+  T operator()(T const& a) const {
+    return simd::precise::sin(a);
+  }
+};
+
+struct precise_sqrt_op {
+  template <class T>
+  T operator()(T const& a) const {
+    return simd::precise::sqrt(a);
+  }
+};
+
+struct precise_cbrt_op {
+  template <class T>
+  T operator()(T const& a) const {
+    return simd::precise::cbrt(a);
+  }
+};
+
+struct bitwise_op {
+  template <class T>
+  T operator()(T const& a, T const& b) const {
+    return (a & b) | (~a ^ b);
+  }
+};
+
+struct shift_op {
+  template <class T>
+  T operator()(T const& a) const {
+    return (a << 3) ^ (a >> 5);
+  }
+};
+
+struct compare_op {
+  template <class T>
+  T operator()(T const& a, T const& b) const {
+    return choose(a < b, a - b, choose(a == b, ~a, -b));
+  }
+};
+
+struct min_max_op {
+  template <class T>
+  T operator()(T const& a, T const& b) const {
+    return simd::min(a, b) - simd::abs(simd::max(a, b));
+  }
+};
+
+struct static_cast_op {
+  template <class U, class T, class Abi>
+  void operator()(simd::simd<T, Abi> const& a, simd::simd<U, Abi>* r) const {
+    *r = simd::static_simd_cast<U>(a);
+  }
+  template <class U, class T, class Abi>
+  void operator()(simd::simd<T, Abi> const& lo, simd::simd<T, Abi> const& hi, simd::simd<U, Abi>* r) const {
+    *r = simd::static_simd_cast<U>(lo, hi);
+  }
+  template <class U, class T, class Abi>
+  void operator()(simd::simd<T, Abi> const& a, simd::simd<U, Abi>* lo, simd::simd<U, Abi>* hi) const {
+    simd::static_simd_cast(a, lo, hi);
+  }
+};
+
+struct rounding_cast_op {
+  template <class U, class T, class Abi>
+  void operator()(simd::simd<T, Abi> const& a, simd::simd<U, Abi>* r) const {
+    *r = simd::rounding_simd_cast<U>(a);
+  }
+  template <class U, class T, class Abi>
+  void operator()(simd::simd<T, Abi> const& lo, simd::simd<T, Abi> const& hi, simd::simd<U, Abi>* r) const {
+    *r = simd::rounding_simd_cast<U>(lo, hi);
+  }
+  template <class U, class T, class Abi>
+  void operator()(simd::simd<T, Abi> const& a, simd::simd<U, Abi>* lo, simd::simd<U, Abi>* hi) const {
+    simd::rounding_simd_cast(a, lo, hi);
+  }
+};
+
+struct saturating_cast_op {
+  template <class U, class T, class Abi>
+  void operator()(simd::simd<T, Abi> const& a, simd::simd<U, Abi>* r) const {
+    *r = simd::saturating_simd_cast<U>(a);
+  }
+  template <class U, class T, class Abi>
+  void operator()(simd::simd<T, Abi> const& lo, simd::simd<T, Abi> const& hi, simd::simd<U, Abi>* r) const {
+    *r = simd::saturating_simd_cast<U>(lo, hi);
+  }
+  template <class U, class T, class Abi>
+  void operator()(simd::simd<T, Abi> const& a, simd::simd<U, Abi>* lo, simd::simd<U, Abi>* hi) const {
+    simd::saturating_simd_cast(a, lo, hi);
+  }
+};
+
+// an accuracy tier's function on an ABI against the C library, lane by lane
+template <class Abi, class T, class SimdOp, class ScalarOp>
+void test_tier_op(T const* a, int n, SimdOp const& simd_op, ScalarOp const& scalar_op, long long max_ulp) {
+  using simd_t = simd::simd<T, Abi>;
+  for (int offset = 0; offset + simd_t::size() <= n; offset += simd_t::size()) {
+    simd::simd_storage<T, Abi> answer(simd_op(simd_t(a + offset, simd::element_aligned_tag())));
+    for (int i = 0; i < simd_t::size(); ++i) {
+      T const expected = scalar_op(a[offset + i]);
+      if (ulp_distance(answer[i], expected) > max_ulp) {
+        std::cerr << std::setprecision(17) << "input " << a[offset + i]
+          << ": got " << answer[i] << ", expected " << expected << '\n';
+        std::abort();
+      }
+    }
+  }
+}
+
+// the same for two arguments
+template <class Abi, class T, class SimdOp, class ScalarOp>
+void test_tier_op(T const* a, T const* b, int n, SimdOp const& simd_op, ScalarOp const& scalar_op, long long max_ulp) {
+  using simd_t = simd::simd<T, Abi>;
+  for (int offset = 0; offset + simd_t::size() <= n; offset += simd_t::size()) {
+    simd::simd_storage<T, Abi> answer(simd_op(
+          simd_t(a + offset, simd::element_aligned_tag()),
+          simd_t(b + offset, simd::element_aligned_tag())));
+    for (int i = 0; i < simd_t::size(); ++i) {
+      T const expected = scalar_op(a[offset + i], b[offset + i]);
+      if (ulp_distance(answer[i], expected) > max_ulp) {
+        std::cerr << std::setprecision(17) << "inputs " << a[offset + i] << ", " << b[offset + i]
+          << ": got " << answer[i] << ", expected " << expected << '\n';
+        std::abort();
+      }
+    }
+  }
+}
+
+// n arguments spread evenly over the binades 2^lo to 2^hi, with random mantissas and, if asked, signs
+template <class T>
+void fill_binades(T* a, int n, int lo, int hi, bool is_signed, std::mt19937_64& engine) {
+  constexpr int digits = std::numeric_limits<T>::digits;
+  for (int i = 0; i < n; ++i) {
+    T const m = T(1) + std::ldexp(T(engine() >> (65 - digits)), 1 - digits);
+    T const x = std::ldexp(m, lo + (hi - lo) * i / (n - 1));
+    a[i] = (is_signed && (engine() & 1)) ? -x : x;
+  }
+}
+
+// compile-time exponents against the C library, lane by lane
+template <int N, class Abi, class T>
+void test_integer_pow(T const* a, int n, long long max_ulp) {
+  using simd_t = simd::simd<T, Abi>;
+  for (int offset = 0; offset + simd_t::size() <= n; offset += simd_t::size()) {
+    simd::simd_storage<T, Abi> answer(simd::pow<N>(simd_t(a + offset, simd::element_aligned_tag())));
+    for (int i = 0; i < simd_t::size(); ++i) {
+      T const expected = std::pow(a[offset + i], T(N));
+      if (ulp_distance(answer[i], expected) > max_ulp) {
+        std::cerr << std::setprecision(17) << "pow<" << N << "> of " << a[offset + i]
+          << ": got " << answer[i] << ", expected " << expected << '\n';
+        std::abort();
+      }
+    }
+  }
+}
+
+template <class T, class Abi>
+void test_math_functions() {
+  T const inf = std::numeric_limits<T>::infinity();
+  T const nan = std::numeric_limits<T>::quiet_NaN();
+  T const exp_args[] = {
+    0.0, -0.0, 1.0, -1.0, 0.5, -0.25, 3.7, -12.5,
+    80.0, -80.0, -100.0, 700.0, -730.0, inf, -inf, nan};
+  T const log_args[] = {
+    1.0, 2.0, 0.5, 1e-3, 7.25, 1e30, 1e-30, 1.4142135,
+    std::numeric_limits<T>::denorm_min(), std::numeric_limits<T>::max(),
+    0.0, -0.0, -1.0, inf, -inf, nan};
+  test_unary_op<Abi>(exp_args, 16, exp_op(), 1);
+  test_unary_op<Abi>(log_args, 16, log_op(), 1);
+  test_unary_op<Abi>(log_args, 16, log2_op(), 1);
+  test_unary_op<Abi>(log_args, 16, log10_op(), 2);
+  test_unary_op<Abi>(exp_args, 16, exp2_op(), 1);
+  T const log1p_args[] = {
+    0.0, -0.0, 1e-20, -1e-10, 0.25, -0.3, -0.75, 1.5,
+    100.0, 1e30, -1.0, -2.0, std::numeric_limits<T>::denorm_min(), inf, -inf, nan};
+  test_unary_op<Abi>(log1p_args, 16, log1p_op(), 1);
+  test_unary_op<Abi>(log1p_args, 16, expm1_op(), 2);
+  test_unary_op<Abi>(exp_args, 16, expm1_op(), 2);
+  T const trig_args[] = {
+    0.0, -0.0, 0.5, -0.75, 1.5707963, 3.1415927, -4.712389, 10.0,
+    100.25, -1234.5, 5000.0, 1e-20, 1e6, inf, -inf, nan};
+  test_unary_op<Abi>(trig_args, 16, sin_op(), 2);
+  test_unary_op<Abi>(trig_args, 16, cos_op(), 2);
+  test_unary_op<Abi>(trig_args, 16, sincos_sin_op(), 2);
+  test_unary_op<Abi>(trig_args, 16, sincos_cos_op(), 2);
+  T const atan_args[] = {
+    0.0, -0.0, 0.25, -0.5, 0.7, -1.0, 2.0, -2.5,
+    10.0, -1e10, 1e-10, 1e30, inf, -inf, nan, 0.4142};
+  test_unary_op<Abi>(atan_args, 16, atan_op(), 2);
+  T const asin_args[] = {
+    0.0, -0.0, 0.1, -0.3, 0.49, 0.5, -0.6, 0.9,
+    -0.975, 0.99, 1.0, -1.0, 1e-20, 1.5, -inf, nan};
+  test_unary_op<Abi>(asin_args, 16, asin_op(), 2);
+  test_unary_op<Abi>(asin_args, 16, acos_op(), 2);
+  T const atan2_y[] = {
+    0.0, -0.0, 0.0, -0.0, 1.0, 1.0, -1.0, -1.0,
+    3.0, -0.5, inf, -inf, inf, 2.0, -2.0, nan};
+  T const atan2_x[] = {
+    0.0, 0.0, -0.0, -0.0, 1.0, -1.0, 1.0, -1.0,
+    -0.25, 7.0, inf, -inf, 1.0, -inf, inf, 1.0};
+  test_binary_op<Abi>(atan2_y, atan2_x, 16, atan2_op(), 2);
+  T const pow_base[] = {
+    2.0, 0.5, 10.0, 1.0001, 3.0, -2.0, -2.0, -8.0,
+    0.0, -0.0, -0.0, inf, -inf, -1.0, 1.0, nan};
+  T const pow_exponent[] = {
+    0.5, -3.25, 12.0, 5000.0, 3.0, 3.0, 0.5, -1.0,
+    -1.0, -3.0, 2.0, -2.0, 3.0, inf, nan, 0.0};
+  test_binary_op<Abi>(pow_base, pow_exponent, 16, pow_op(), 1);
+  T const hyperbolic_args[] = {
+    0.0, -0.0, 0.3, -0.6, 0.625, 1.0, -2.5, 8.0,
+    -20.0, 89.0, 710.0, 1e-20, 1e-3, inf, -inf, nan};
+  test_unary_op<Abi>(hyperbolic_args, 16, sinh_op(), 3);
+  test_unary_op<Abi>(hyperbolic_args, 16, cosh_op(), 3);
+  test_unary_op<Abi>(hyperbolic_args, 16, tanh_op(), 3);
+  T const erf_args[] = {
+    0.0, -0.0, 0.1, -0.5, 0.84375, -1.0, 1.25, -2.0,
+    2.857, 4.5, 9.5, 27.0, 1e-20, inf, -inf, nan};
+  test_unary_op<Abi>(erf_args, 16, erf_op(), 3);
+  test_unary_op<Abi>(erf_args, 16, erfc_op(), 4);
+  T const rounding_args[] = {
+    0.0, -0.0, 0.5, -0.5, 1.5, -2.5, 0.49999997, -0.7,
+    3.25, -1e10, 4503599.5, 8388609.0, 1e30, inf, -inf, nan};
+  test_unary_op<Abi>(rounding_args, 16, floor_op(), 0);
+  test_unary_op<Abi>(rounding_args, 16, ceil_op(), 0);
+  test_unary_op<Abi>(rounding_args, 16, trunc_op(), 0);
+  test_unary_op<Abi>(rounding_args, 16, round_op(), 0);
+  test_unary_op<Abi>(rounding_args, 16, nearbyint_op(), 0);
+  T const fmod_a[] = {
+    7.5, -7.5, 1e30, -1e-30, 5.0, 0.0, -0.0, 3.0,
+    1e-40, 6.0, 2.5, inf, 1.0, nan, std::numeric_limits<T>::max(), -9.0};
+  T const fmod_b[] = {
+    2.0, 2.0, 3.0, 1e-31, -5.0, 1.0, 1.0, 0.0,
+    std::numeric_limits<T>::denorm_min(), 4.0, 1.0, 1.0, inf, 1.0, 0.3, 6.0};
+  test_binary_op<Abi>(fmod_a, fmod_b, 16, fmod_op(), 0);
+  test_binary_op<Abi>(fmod_a, fmod_b, 16, remainder_op(), 0);
+  T const exponent_args[] = {
+    1.0, -3.0, 0.75, 1e-3, 1e30, -1e-30, std::numeric_limits<T>::min(), std::numeric_limits<T>::max(),
+    std::numeric_limits<T>::denorm_min(), -std::numeric_limits<T>::denorm_min() * T(5), 0.0, -0.0, 6.5, inf, -inf, nan};
+  T const ldexp_n[] = {
+    0.0, 3.0, -1.0, 20.0, -200.0, 100.0, -10.0, 1.0,
+    60.0, -1.0, 5.0, 5.0, -2000.0, 1.0, -1.0, 1.0};
+  test_unary_op<Abi>(exponent_args, 16, frexp_mantissa_op(), 0);
+  // the C library leaves the exponent of infinity and NaN unspecified
+  test_unary_op<Abi>(exponent_args, 12, frexp_exponent_op(), 0);
+  test_unary_op<Abi>(exponent_args, 16, ilogb_op(), 0);
+  test_unary_op<Abi>(exponent_args, 16, logb_op(), 0);
+  test_binary_op<Abi>(exponent_args, ldexp_n, 16, ldexp_op(), 0);
+  // exponents far outside the int range over- or underflow every finite a
+  T const huge_ldexp_a[] = {
+    std::numeric_limits<T>::denorm_min(), std::numeric_limits<T>::max(), 1.0, -3.0,
+    -std::numeric_limits<T>::denorm_min(), -std::numeric_limits<T>::max(), 0.0, 1.5,
+    std::numeric_limits<T>::denorm_min(), std::numeric_limits<T>::max(), -1.0, 2.0,
+    -std::numeric_limits<T>::min(), 0.25, inf, -0.0};
+  T const huge_ldexp_n[] = {
+    1e30, -1e30, 1e30, -1e30, 1e30, -1e30, 1e30, inf,
+    1e10, -1e10, -inf, -1e20, 5e9, -3e9, -1e30, 1e30};
+  test_binary_op<Abi>(huge_ldexp_a, huge_ldexp_n, 16, ldexp_op(), 0);
+  T const integer_pow_args[] = {
+    1.5, -2.0, 0.1, 3.0, -7.25, 1e-3, 42.0, -0.0,
+    0.75, 2.5, -1.0, 11.0, 0.3, -4.0, 1e3, 6.0};
+  test_integer_pow<0, Abi>(integer_pow_args, 16, 0);
+  test_integer_pow<1, Abi>(integer_pow_args, 16, 0);
+  test_integer_pow<3, Abi>(integer_pow_args, 16, 2);
+  test_integer_pow<-2, Abi>(integer_pow_args, 16, 2);
+  // pack computes exact reciprocals
+  T const rcp_args[] = {
+    1.0, -2.0, 3.0, 0.1, 1e-3, 7.25, -1e20, 1e-20,
+    1.0625, 1.9375, 0.0, -0.0, inf, -inf, nan, 12345.0};
+  test_unary_op<Abi>(rcp_args, 16, rcp_op(), 4);
+  test_unary_op<Abi>(rcp_args, 16, rsqrt_op(), 4);
+  test_unary_op<Abi>(rcp_args, 16, rsqrt_three_steps_op(), 2);
+  test_binary_op<Abi>(pow_exponent, rcp_args, 16, fast_div_op(), 4);
+  // divisors whose reciprocals are subnormal, which the estimates flush
+  T const big = T(1) / std::numeric_limits<T>::min();
+  T const huge_a[] = {
+    -5.7e36, 1.0, -3.5, 1e30, 0.0, -0.0, 7.25, -1e36,
+    std::numeric_limits<T>::max(), -std::numeric_limits<T>::max(), 2.0, -0.1, 1e25, 12345.0, inf, nan};
+  T const huge_b[] = {
+    -1.18e38, big, -big, big * T(1.5), big * T(3.75), -big * T(0.999), -std::numeric_limits<T>::max(), 1.7e38,
+    big, std::numeric_limits<T>::max(), -big, big * T(2.5), -big * T(1.25), big * T(0.5), big, big};
+  test_tier_op<Abi>(huge_a, huge_b, 16, fast_div_op(), [](T x, T y) { return x / y; }, 3);
+  // negative subnormals are negative, not zero
+  T const negative_args[] = {
+    -std::numeric_limits<T>::denorm_min(), -std::numeric_limits<T>::min() / T(2), -std::numeric_limits<T>::min(), -1.0,
+    -std::numeric_limits<T>::denorm_min() * T(3), -1e-30, -inf, -std::numeric_limits<T>::min() * T(0.75)};
+  test_unary_op<Abi>(negative_args, 8, rsqrt_op(), 0);
+  test_unary_op<Abi>(negative_args, 8, rsqrt_three_steps_op(), 0);
+  // the documented bound of each accuracy tier
+  using simd_t = simd::simd<T, Abi>;
+  using storage_t = simd::simd_storage<T, Abi>;
+  test_tier_op<Abi>(exp_args, 16, precise_exp_op(), [](T x) { return std::exp(x); }, 1);
+  test_tier_op<Abi>(log_args, 16, precise_log_op(), [](T x) { return std::log(x); }, 1);
+  test_tier_op<Abi>(trig_args, 16, precise_sin_op(), [](T x) { return std::sin(x); }, 2);
+  test_tier_op<Abi>(log_args, 16, precise_sqrt_op(), [](T x) { return std::sqrt(x); }, 0);
+  // the C library's cbrt can be off by more than an ulp itself
+  test_tier_op<Abi>(integer_pow_args, 16, precise_cbrt_op(), [](T x) { return T(std::cbrt(static_cast<long double>(x))); }, 1);
+  T const cbrt_args[] = {
+    27.0, -50653.0, 1e-300, 6.5, -0.001, 3.0, 1e30, 0.7,
+    std::numeric_limits<T>::denorm_min(), std::numeric_limits<T>::max(), 0.0, -0.0, -8.0, inf, -inf, nan};
+  test_tier_op<Abi>(cbrt_args, 16, precise_cbrt_op(), [](T x) { return T(std::cbrt(static_cast<long double>(x))); }, 1);
+  // perfect cubes come out exact
+  ASSERT_EQ(storage_t(simd::cbrt(simd_t(T(-50653.0))))[0], T(-37.0));
+  ASSERT_EQ(storage_t(simd::cbrt(simd_t(T(0.125))))[0], T(0.5));
+  // ulp_distance takes -0 for +0, so signed zeros are checked here
+  ASSERT_EQ(std::signbit(storage_t(simd::tanh(simd_t(T(-0.0))))[0]), true);
+  ASSERT_EQ(std::signbit(storage_t(simd::tanh(simd_t(T(0.0))))[0]), false);
+  ASSERT_EQ(storage_t(simd::ldexp(simd_t(std::numeric_limits<T>::denorm_min()), simd_t(T(1e30))))[0], inf);
+  ASSERT_EQ(storage_t(simd::ldexp(simd_t(std::numeric_limits<T>::max()), simd_t(T(-1e30))))[0], T(0));
+  T const odd_pow_base[] = {-0.0, -0.0, -inf, -std::numeric_limits<T>::min(), 0.0, -inf};
+  T const odd_pow_exponent[] = {3.0, 1.0, -1.0, 3.0, 3.0, 3.0};
+  for (int i = 0; i < 6; ++i) {
+    T const answer = storage_t(simd::pow(simd_t(odd_pow_base[i]), simd_t(odd_pow_exponent[i])))[0];
+    T const expected = std::pow(odd_pow_base[i], odd_pow_exponent[i]);
+    ASSERT_EQ(answer, expected);
+    ASSERT_EQ(std::signbit(answer), std::signbit(expected));
+  }
+  // so do log2 of powers of two and exp2 of integers
+  ASSERT_EQ(storage_t(simd::log2(simd_t(std::numeric_limits<T>::denorm_min())))[0], T(std::numeric_limits<T>::min_exponent - std::numeric_limits<T>::digits));
+  ASSERT_EQ(storage_t(simd::log2(simd_t(T(1024.0))))[0], T(10.0));
+  ASSERT_EQ(storage_t(simd::exp2(simd_t(T(-20.0))))[0], T(1.0) / T(1048576.0));
+  T const fast_exp_args[] = {
+    0.0, -0.0, 1.0, -1.0, 0.5, -0.25, 3.7, -12.5,
+    80.0, -80.0, 88.5, -86.5, 1e-10, inf, -inf, nan};
+  T const fast_log_args[] = {
+    1.0, 2.0, 0.5, 1e-3, 7.25, 1e30, 1e-30, 1.4142135,
+    0.7071068, std::numeric_limits<T>::max(),
+    0.0, -0.0, -1.0, inf, -inf, nan};
+  test_tier_op<Abi>(fast_exp_args, 16, fast_exp_op(), [](T x) { return std::exp(x); }, 2);
+  test_tier_op<Abi>(fast_log_args, 16, fast_log_op(), [](T x) { return std::log(x); }, 1);
+  T const fast_sqrt_args[] = {
+    1.0, 2.0, 0.5, 1e-3, 7.25, 1e30, 1e-30, 3.0,
+    0.1, std::numeric_limits<T>::max(), 0.0, -0.0, -1.0, inf, -inf, nan};
+  test_tier_op<Abi>(fast_sqrt_args, 16, fast_sqrt_op(), [](T x) { return std::sqrt(x); }, 3);
+  test_tier_op<Abi>(negative_args, 8, fast_sqrt_op(), [](T x) { return std::sqrt(x); }, 0);
+  T const fast_cbrt_args[] = {
+    27.0, -50653.0, 1e-30, 6.5, -0.001, 3.0, 1e30, 0.7,
+    -1.0, std::numeric_limits<T>::max(), 0.0, -0.0, -8.0, inf, -inf, nan};
+  test_tier_op<Abi>(fast_cbrt_args, 16, fast_cbrt_op(), [](T x) { return T(std::cbrt(static_cast<long double>(x))); }, 1);
+  // fast flushes subnormal results and arguments
+  ASSERT_EQ(storage_t(simd::fast::exp(simd_t(T(-720.0))))[0], T(0));
+  ASSERT_EQ(storage_t(simd::fast::exp(simd_t(sizeof(T) == 8 ? T(-708.25) : T(-86.75))))[0], T(0));
+  ASSERT_EQ(storage_t(simd::fast::cbrt(simd_t(-std::numeric_limits<T>::denorm_min())))[0], T(0));
+  ASSERT_EQ(storage_t(simd::fast::log(simd_t(std::numeric_limits<T>::denorm_min())))[0], -inf);
+  // both tiers over the whole normal range, and exp over its domain
+  constexpr int n = 1024;
+  int const lo = std::numeric_limits<T>::min_exponent - 1;
+  int const hi = std::numeric_limits<T>::max_exponent - 1;
+  std::mt19937_64 engine(42);
+  T positive[n], a[n], b[n], x[n];
+  fill_binades(positive, n, lo, hi, false, engine);
+  fill_binades(a, n, lo, hi, true, engine);
+  fill_binades(b, n, hi, lo, true, engine);
+  T const x_lo = sizeof(T) == 8 ? T(-708.0) : T(-86.5);
+  T const x_hi = sizeof(T) == 8 ? T(709.78) : T(88.72);
+  for (int i = 0; i < n; ++i) {
+    x[i] = x_lo + (x_hi - x_lo) * T(i) / T(n - 1);
+    // keep the quotients normal
+    T const q = std::abs(a[i] / b[i]);
+    if (!(std::numeric_limits<T>::min() <= q && q <= std::numeric_limits<T>::max())) a[i] = b[i] * T(0.75);
+  }
+  test_tier_op<Abi>(x, n, precise_exp_op(), [](T y) { return std::exp(y); }, 1);
+  test_tier_op<Abi>(positive, n, precise_log_op(), [](T y) { return std::log(y); }, 1);
+  test_tier_op<Abi>(a, n, precise_sin_op(), [](T y) { return std::sin(y); }, 2);
+  test_tier_op<Abi>(positive, n, precise_sqrt_op(), [](T y) { return std::sqrt(y); }, 0);
+  test_tier_op<Abi>(a, n, precise_cbrt_op(), [](T y) { return T(std::cbrt(static_cast<long double>(y))); }, 1);
+  test_tier_op<Abi>(a, b, n, precise_div_op(), [](T y, T z) { return y / z; }, 0);
+  test_tier_op<Abi>(x, n, fast_exp_op(), [](T y) { return std::exp(y); }, 2);
+  test_tier_op<Abi>(positive, n, fast_log_op(), [](T y) { return std::log(y); }, 1);
+  test_tier_op<Abi>(positive, n, fast_sqrt_op(), [](T y) { return std::sqrt(y); }, 3);
+  test_tier_op<Abi>(a, n, fast_cbrt_op(), [](T y) { return T(std::cbrt(static_cast<long double>(y))); }, 1);
+  test_tier_op<Abi>(a, b, n, fast_div_op(), [](T y, T z) { return y / z; }, 3);
+  // the bare estimates, where the reciprocals are normal
+  constexpr int estimate_bits = simd::reciprocal_estimate_bits(static_cast<simd_t const*>(nullptr));
+  fill_binades(positive, n, lo, hi - 2, false, engine);
+  test_tier_op<Abi>(positive, n, rcp_estimate_op(), [](T y) { return T(1) / y; }, 1ll << (std::numeric_limits<T>::digits + 1 - estimate_bits));
+  test_tier_op<Abi>(positive, n, rsqrt_estimate_op(), [](T y) { return T(1) / std::sqrt(y); }, 1ll << (std::numeric_limits<T>::digits + 1 - estimate_bits));
+}
+
+template <class T, class Abi>
+void test_integer_ops() {
+  T const lo = std::numeric_limits<T>::min();
+  T const hi = std::numeric_limits<T>::max();
+  // small enough that products do not overflow
+  T const a[] = {
+    0, 1, -1, 7, -7, 100, -12345, 46340,
+    3, -46340, 2, 999, -1000, 65535, -32768, 12};
+  T const b[] = {
+    1, -1, 3, -2, 7, -100, 12345, 46340,
+    -5, -46340, 1000, -999, 3, 1, 2, -12};
+  test_binary_op<Abi>(a, b, 16, plus(), 0);
+  test_binary_op<Abi>(a, b, 16, minus(), 0);
+  test_binary_op<Abi>(a, b, 16, multiplies(), 0);
+  test_binary_op<Abi>(a, b, 16, divides(), 0);
+  T const bits[] = {
+    -1, 0, lo, hi, 1, -2, T(lo + 1), T(hi - 1),
+    0x5A5A, -0x5A5A, 123456, -123456, 1 << 20, -(1 << 20), 3, -3};
+  T const other_bits[] = {
+    -1, 0, hi, lo, -2, 1, T(lo + 1), -0x5A5A,
+    0x5A5A, -0x5A5A, 123456, 123456, 1 << 20, lo, -3, -3};
+  test_binary_op<Abi>(bits, other_bits, 16, bitwise_op(), 0);
+  test_unary_op<Abi>(bits, 16, shift_op(), 0);
+  test_binary_op<Abi>(bits, other_bits, 16, compare_op(), 0);
+  test_binary_op<Abi>(bits, other_bits, 16, min_max_op(), 0);
+  using simd_t = simd::simd<T, Abi>;
+  simd_t const x(bits, simd::element_aligned_tag());
+  ASSERT_EQ(all_of(x == x), true);
+  ASSERT_EQ(any_of(x < x), false);
+  ASSERT_EQ(any_of(x < simd_t(T(0))), true);
+  ASSERT_EQ(all_of(simd_t(lo) < x || simd_t(lo) == x), true);
+}
+
+// an ABI converts n lanes of a at a time, as one simd, a pair of them or into a pair
+template <class Abi, class U, class T, class CastOp>
+void cast_lanes(T const* a, U* r, int n, CastOp const& cast_op, std::integral_constant<int, 0> /* same lanes */) {
+  using from_t = simd::simd<T, Abi>;
+  using to_t = simd::simd<U, Abi>;
+  for (int offset = 0; offset + from_t::size() <= n; offset += from_t::size()) {
+    to_t result;
+    cast_op(from_t(a + offset, simd::element_aligned_tag()), &result);
+    result.copy_to(r + offset, simd::element_aligned_tag());
+  }
+}
+
+template <class Abi, class U, class T, class CastOp>
+void cast_lanes(T const* a, U* r, int n, CastOp const& cast_op, std::integral_constant<int, 1> /* twice the lanes */) {
+  using from_t = simd::simd<T, Abi>;
+  using to_t = simd::simd<U, Abi>;
+  for (int offset = 0; offset + to_t::size() <= n; offset += to_t::size()) {
+    to_t result;
+    cast_op(from_t(a + offset, simd::element_aligned_tag()),
+        from_t(a + offset + from_t::size(), simd::element_aligned_tag()), &result);
+    result.copy_to(r + offset, simd::element_aligned_tag());
+  }
+}
+
+template <class Abi, class U, class T, class CastOp>
+void cast_lanes(T const* a, U* r, int n, CastOp const& cast_op, std::integral_constant<int, 2> /* half the lanes */) {
+  using from_t = simd::simd<T, Abi>;
+  using to_t = simd::simd<U, Abi>;
+  for (int offset = 0; offset + from_t::size() <= n; offset += from_t::size()) {
+    to_t lo, hi;
+    cast_op(from_t(a + offset, simd::element_aligned_tag()), &lo, &hi);
+    lo.copy_to(r + offset, simd::element_aligned_tag());
+    hi.copy_to(r + offset + to_t::size(), simd::element_aligned_tag());
+  }
+}
+
+template <class U, class Abi, class T, class CastOp, class ScalarOp>
+void test_cast(T const* a, int n, CastOp const& cast_op, ScalarOp const& scalar_op) {
+  constexpr int from_size = simd::simd<T, Abi>::size();
+  constexpr int to_size = simd::simd<U, Abi>::size();
+  U r[16];
+  cast_lanes<Abi>(a, r, n, cast_op, std::integral_constant<int, from_size == to_size ? 0 : (from_size < to_size ? 1 : 2)>());
+  for (int i = 0; i < n; ++i) {
+    if (ulp_distance(r[i], U(scalar_op(a[i]))) != 0) {
+      std::cerr << std::setprecision(17) << "input " << a[i]
+        << ": got " << r[i] << ", expected " << U(scalar_op(a[i])) << '\n';
+      std::abort();
+    }
+  }
+}
+
+template <class U, class T>
+U saturated(T x) {
+  if (x != x) return U(0);
+  if (x <= T(std::numeric_limits<U>::min())) return std::numeric_limits<U>::min();
+  if (x >= -T(std::numeric_limits<U>::min())) return std::numeric_limits<U>::max();
+  return static_cast<U>(x);
+}
+
+template <class Abi>
+void test_conversions() {
+  using std::int32_t;
+  using std::int64_t;
+  double const inf = std::numeric_limits<double>::infinity();
+  double const nan = std::numeric_limits<double>::quiet_NaN();
+  // within int32_t, with ties for the rounding casts
+  double const d[] = {
+    0.5, 1.5, 2.5, -0.5, -2.5, 1e9, -1e9, 3.7,
+    -3.7, 0.0, -0.0, 2147483647.0, -2147483648.0, 123456.789, 1e-300, 7.0};
+  float const f[] = {
+    0.5f, 1.5f, 2.5f, -0.5f, -2.5f, 1e9f, -1e9f, 3.7f,
+    -3.7f, 0.0f, -0.0f, 2147483520.0f, -2147483648.0f, 123456.79f, 1e-30f, 7.0f};
+  int32_t const i[] = {
+    -1, 0, std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::max(), 1, -2, 16777217, -16777219,
+    0x5A5A, -0x5A5A, 123456, -123456, 1 << 20, -(1 << 20), 3, -3};
+  int64_t const l[] = {
+    -1, 0, std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max(), 1, -2, 9007199254740993, -3000000000,
+    int64_t(1) << 32, 2147483647, 2147483648, -2147483648, -2147483649, 0x5A5A5A5A5A, -123456, 3};
+  test_cast<float, Abi>(d, 16, static_cast_op(), [](double x) { return static_cast<float>(x); });
+  test_cast<double, Abi>(f, 16, static_cast_op(), [](float x) { return static_cast<double>(x); });
+  test_cast<int32_t, Abi>(d, 16, static_cast_op(), [](double x) { return static_cast<int32_t>(x); });
+  test_cast<int32_t, Abi>(f, 16, static_cast_op(), [](float x) { return static_cast<int32_t>(x); });
+  test_cast<int64_t, Abi>(d, 16, static_cast_op(), [](double x) { return static_cast<int64_t>(x); });
+  test_cast<double, Abi>(i, 16, static_cast_op(), [](int32_t x) { return static_cast<double>(x); });
+  test_cast<float, Abi>(i, 16, static_cast_op(), [](int32_t x) { return static_cast<float>(x); });
+  test_cast<int64_t, Abi>(i, 16, static_cast_op(), [](int32_t x) { return static_cast<int64_t>(x); });
+  test_cast<int32_t, Abi>(l, 16, static_cast_op(), [](int64_t x) { return static_cast<int32_t>(x); });
+  test_cast<double, Abi>(l, 16, static_cast_op(), [](int64_t x) { return static_cast<double>(x); });
+  test_cast<int32_t, Abi>(d, 16, rounding_cast_op(), [](double x) { return static_cast<int32_t>(std::nearbyint(x)); });
+  test_cast<int32_t, Abi>(f, 16, rounding_cast_op(), [](float x) { return static_cast<int32_t>(std::nearbyint(x)); });
+  test_cast<int64_t, Abi>(d, 16, rounding_cast_op(), [](double x) { return static_cast<int64_t>(std::nearbyint(x)); });
+  test_cast<float, Abi>(d, 16, rounding_cast_op(), [](double x) { return static_cast<float>(x); });
+  // out of range of int32_t and int64_t
+  double const wide_d[] = {
+    nan, inf, -inf, 3e9, -3e9, 2147483647.5, 2147483648.0, -2147483648.5,
+    -2147483649.0, 9.3e18, -9.3e18, 9223372036854775808.0, -9223372036854775808.0, 1.5, -1.5, 0.0};
+  float const wide_f[] = {
+    float(nan), float(inf), float(-inf), 3e9f, -3e9f, 2147483648.0f, -2147483648.0f, 2147483520.0f,
+    -2147483904.0f, 0.5f, -0.5f, 1e20f, -1e20f, 7.9f, -7.9f, 0.0f};
+  test_cast<int32_t, Abi>(wide_d, 16, saturating_cast_op(), [](double x) { return saturated<int32_t>(x); });
+  test_cast<int32_t, Abi>(wide_f, 16, saturating_cast_op(), [](float x) { return saturated<int32_t>(x); });
+  test_cast<int64_t, Abi>(wide_d, 16, saturating_cast_op(), [](double x) { return saturated<int64_t>(x); });
+  test_cast<int32_t, Abi>(l, 16, saturating_cast_op(), [](int64_t x) { return saturated<int32_t>(x); });
+  test_cast<int64_t, Abi>(i, 16, saturating_cast_op(), [](int32_t x) { return static_cast<int64_t>(x); });
+}
+
+// fixed_size<16> against the native ABI on each of its parts, which it must match exactly
+template <class T, class UnaryOp>
+void test_fixed_size_op(T const* a, UnaryOp const& unary_op) {
+  using native_t = simd::simd<T, simd::simd_abi::native>;
+  using fixed_t = simd::simd<T, simd::simd_abi::fixed_size<16>>;
+  simd::simd_storage<T, simd::simd_abi::fixed_size<16>> fixed_answer(unary_op(fixed_t(a, simd::element_aligned_tag())));
+  for (int offset = 0; offset < 16; offset += native_t::size()) {
+    simd::simd_storage<T, simd::simd_abi::native> native_answer(unary_op(native_t(a + offset, simd::element_aligned_tag())));
+    for (int i = 0; i < native_t::size(); ++i) {
+      ASSERT_EQ(ulp_distance(fixed_answer[offset + i], native_answer[i]), 0);
+    }
+  }
+}
+
+template <class T, class BinaryOp>
+void test_fixed_size_op(T const* a, T const* b, BinaryOp const& binary_op) {
+  using native_t = simd::simd<T, simd::simd_abi::native>;
+  using fixed_t = simd::simd<T, simd::simd_abi::fixed_size<16>>;
+  simd::simd_storage<T, simd::simd_abi::fixed_size<16>> fixed_answer(
+      binary_op(fixed_t(a, simd::element_aligned_tag()), fixed_t(b, simd::element_aligned_tag())));
+  for (int offset = 0; offset < 16; offset += native_t::size()) {
+    simd::simd_storage<T, simd::simd_abi::native> native_answer(
+        binary_op(native_t(a + offset, simd::element_aligned_tag()), native_t(b + offset, simd::element_aligned_tag())));
+    for (int i = 0; i < native_t::size(); ++i) {
+      ASSERT_EQ(ulp_distance(fixed_answer[offset + i], native_answer[i]), 0);
+    }
+  }
+}
+
+template <class T>
+void test_fixed_size() {
+  T const inf = std::numeric_limits<T>::infinity();
+  T const nan = std::numeric_limits<T>::quiet_NaN();
+  T const a[] = {
+    0.0, -0.0, 1.0, -1.0, 0.5, -0.25, 3.7, -12.5,
+    80.0, -80.0, 1e-30, 700.0, -730.0, inf, -inf, nan};
+  T const b[] = {
+    1.5, 2.0, -0.5, 1e-3, 7.25, 1e30, -1e-30, 3.0,
+    0.1, std::numeric_limits<T>::max(), 0.0, -0.0, -1.0, inf, 2.5, 1.0};
+  test_fixed_size_op(a, b, plus());
+  test_fixed_size_op(a, b, multiplies());
+  test_fixed_size_op(a, b, divides());
+  test_fixed_size_op(a, b, atan2_op());
+  test_fixed_size_op(a, b, pow_op());
+  test_fixed_size_op(a, b, min_max_op());
+  test_fixed_size_op(a, exp_op());
+  test_fixed_size_op(a, log_op());
+  test_fixed_size_op(a, sincos_sin_op());
+  test_fixed_size_op(a, sincos_cos_op());
+  test_fixed_size_op(a, frexp_exponent_op());
+  test_fixed_size_op(a, rsqrt_op());
+  test_fixed_size_op(a, fast_exp_op());
+  test_fixed_size_op(b, fast_sqrt_op());
+  using fixed_t = simd::fixed_size_simd<T, 16>;
+  fixed_t const x(a, simd::element_aligned_tag());
+  ASSERT_EQ(all_of(x == x), false);
+  ASSERT_EQ(any_of(x < fixed_t(T(0))), true);
+  ASSERT_EQ(all_of(fixed_t(b, simd::element_aligned_tag()) < fixed_t(inf) || !(x == x)), false);
+}
+
+// vector_aligned, overaligned and nontemporal copies must move the same lanes as element_aligned ones
+template <class T, class Abi>
+void test_aligned_copies() {
+  using simd_t = simd::simd<T, Abi>;
+  constexpr int n = simd_t::size();
+  static_assert(alignof(simd::simd_storage<T, Abi>) >= simd::memory_alignment<simd_t>::value,
+      "simd_storage must be vector aligned");
+  alignas(64) T in[2 * n];
+  alignas(64) T out[2 * n];
+  for (int i = 0; i < 2 * n; ++i) in[i] = T(i + 1);
+  simd_t const x(in, simd::vector_aligned_tag());
+  x.copy_to(out, simd::vector_aligned_tag());
+  for (int i = 0; i < n; ++i) ASSERT_EQ(out[i], in[i]);
+  simd_t y;
+  y.copy_from(in + 1, simd::overaligned_tag<sizeof(T)>());
+  y.copy_to(out + n, simd::overaligned_tag<simd::memory_alignment<simd_t>::value>());
+  for (int i = 0; i < n; ++i) ASSERT_EQ(out[n + i], in[i + 1]);
+  x.copy_to(out + n, simd::nontemporal_tag());
+  simd::nontemporal_fence();
+  for (int i = 0; i < n; ++i) ASSERT_EQ(out[n + i], in[i]);
+  simd::simd_storage<T, Abi> const s(x);
+  ASSERT_EQ(std::memcmp(s.data(), in, sizeof(T) * n), 0);
+}
+
+// masked copies of the first k lanes, for every k, leave the other lanes and elements alone
+template <class T, class Abi>
+void test_masked_copies() {
+  using simd_t = simd::simd<T, Abi>;
+  constexpr int n = simd_t::size();
+  T in[n];
+  T out[n];
+  for (int i = 0; i < n; ++i) in[i] = T(i + 1);
+  for (int k = -1; k <= n + 1; ++k) {
+    auto const mask = simd::first_n_mask<simd_t>(k);
+    simd_t x(T(-1));
+    x.copy_from(in, mask, simd::element_aligned_tag());
+    x.copy_to(out, simd::element_aligned_tag());
+    for (int i = 0; i < n; ++i) ASSERT_EQ(out[i], i < k ? in[i] : T(-1));
+    for (int i = 0; i < n; ++i) out[i] = T(-7);
+    simd_t(in, simd::element_aligned_tag()).copy_to(out, mask, simd::element_aligned_tag());
+    for (int i = 0; i < n; ++i) ASSERT_EQ(out[i], i < k ? in[i] : T(-7));
+  }
+}
+
+// gathers and scatters through a permutation of a table, and the strided constructor
+template <class T, class I, class Abi>
+void test_gather_scatter() {
+  using simd_t = simd::simd<T, Abi>;
+  using index_t = simd::simd<I, Abi>;
+  constexpr int n = simd_t::size();
+  T table[4 * n];
+  T out[4 * n];
+  T lanes[n];
+  I index[n];
+  for (int i = 0; i < 4 * n; ++i) table[i] = T(i + 1);
+  for (int i = 0; i < n; ++i) index[i] = I((5 * i + 3) % (4 * n));
+  index_t const idx(index, simd::element_aligned_tag());
+  auto const mask = simd::first_n_mask<simd_t>(n / 2);
+  simd::gather(table, idx).copy_to(lanes, simd::element_aligned_tag());
+  for (int i = 0; i < n; ++i) ASSERT_EQ(lanes[i], table[index[i]]);
+  simd::gather(table, idx, mask, simd_t(T(-1))).copy_to(lanes, simd::element_aligned_tag());
+  for (int i = 0; i < n; ++i) ASSERT_EQ(lanes[i], i < n / 2 ? table[index[i]] : T(-1));
+  simd_t(table, 3).copy_to(lanes, simd::element_aligned_tag());
+  for (int i = 0; i < n; ++i) ASSERT_EQ(lanes[i], table[3 * i]);
+  simd_t const a(table, simd::element_aligned_tag());
+  for (int i = 0; i < 4 * n; ++i) out[i] = T(0);
+  simd::scatter(out, idx, a);
+  for (int i = 0; i < n; ++i) ASSERT_EQ(out[index[i]], table[i]);
+  for (int i = 0; i < 4 * n; ++i) out[i] = T(0);
+  simd::scatter(out, idx, a, mask);
+  for (int i = 0; i < n; ++i) ASSERT_EQ(out[index[i]], i < n / 2 ? table[i] : T(0));
+}
+
+// where(mask, x) op= y must give choose(mask, x op y, x), and masked copies only touch the mask
+template <class T, class Abi>
+void test_where() {
+  using simd_t = simd::simd<T, Abi>;
+  constexpr int n = simd_t::size();
+  T a[n];
+  T b[n];
+  T out[n];
+  for (int i = 0; i < n; ++i) {
+    a[i] = T(3 * i + 5);
+    b[i] = T(i % 3 + 1);
+  }
+  simd_t const x(a, simd::element_aligned_tag());
+  simd_t const y(b, simd::element_aligned_tag());
+  auto const mask = y < simd_t(T(2)) || simd::first_n_mask<simd_t>(n / 2);
+  simd::simd_storage<T, Abi> expected;
+  simd::simd_storage<T, Abi> actual;
+  simd_t z = x;
+  simd::where(mask, z) = y;
+  expected = simd::choose(mask, y, x);
+  actual = z;
+  ASSERT_EQ(std::memcmp(expected.data(), actual.data(), sizeof(T) * n), 0);
+  z = x;
+  simd::where(mask, z) += y;
+  expected = simd::choose(mask, x + y, x);
+  actual = z;
+  ASSERT_EQ(std::memcmp(expected.data(), actual.data(), sizeof(T) * n), 0);
+  z = x;
+  simd::where(mask, z) -= y;
+  expected = simd::choose(mask, x - y, x);
+  actual = z;
+  ASSERT_EQ(std::memcmp(expected.data(), actual.data(), sizeof(T) * n), 0);
+  z = x;
+  simd::where(mask, z) *= y;
+  expected = simd::choose(mask, x * y, x);
+  actual = z;
+  ASSERT_EQ(std::memcmp(expected.data(), actual.data(), sizeof(T) * n), 0);
+  z = x;
+  simd::where(mask, z) /= y;
+  expected = simd::choose(mask, x / y, x);
+  actual = z;
+  ASSERT_EQ(std::memcmp(expected.data(), actual.data(), sizeof(T) * n), 0);
+  z = x;
+  simd::where(mask, z).copy_from(b, simd::element_aligned_tag());
+  expected = simd::choose(mask, y, x);
+  actual = z;
+  ASSERT_EQ(std::memcmp(expected.data(), actual.data(), sizeof(T) * n), 0);
+  for (int i = 0; i < n; ++i) out[i] = a[i];
+  simd::where(mask, y).copy_to(out, simd::element_aligned_tag());
+  simd_t(out, simd::element_aligned_tag()).copy_to(actual.data(), simd::element_aligned_tag());
+  ASSERT_EQ(std::memcmp(expected.data(), actual.data(), sizeof(T) * n), 0);
+}
+
+// horizontal reductions against scalar loops, on integer values so that every order is exact
+template <class T, class Abi>
+void test_reductions() {
+  using simd_t = simd::simd<T, Abi>;
+  constexpr int n = simd_t::size();
+  T a[n];
+  T b[n];
+  for (int i = 0; i < n; ++i) {
+    a[i] = T((i * 7) % 11 - 5);
+    b[i] = T(i % 3 == 0 ? 2 : 1);
+  }
+  simd_t const x(a, simd::element_aligned_tag());
+  auto const mask = simd::first_n_mask<simd_t>((n + 1) / 2);
+  T sum = 0, masked_sum = 0, product = 1;
+  T lo = a[0], hi = a[0], masked_lo = a[0], masked_hi = a[0];
+  for (int i = 0; i < n; ++i) {
+    sum += a[i];
+    product *= b[i];
+    lo = std::min(lo, a[i]);
+    hi = std::max(hi, a[i]);
+    if (i < (n + 1) / 2) {
+      masked_sum += a[i];
+      masked_lo = std::min(masked_lo, a[i]);
+      masked_hi = std::max(masked_hi, a[i]);
+    }
+  }
+  ASSERT_EQ(simd::reduce(x), sum);
+  ASSERT_EQ(simd::reduce(simd_t(b, simd::element_aligned_tag()), std::multiplies<>()), product);
+  ASSERT_EQ(simd::hmin(x), lo);
+  ASSERT_EQ(simd::hmax(x), hi);
+  ASSERT_EQ(simd::reduce(x, mask), masked_sum);
+  ASSERT_EQ(simd::hmin(x, mask), masked_lo);
+  ASSERT_EQ(simd::hmax(x, mask), masked_hi);
+  ASSERT_EQ(simd::reduce(x, simd::first_n_mask<simd_t>(0), T(1), std::multiplies<>()), T(1));
+}
+
+// every comparison against the scalar one lane by lane, with a NaN lane for floating point,
+// read back through to_bitmask, and the mask inspection functions built on it
+template <class T, class Abi>
+void test_comparisons() {
+  using simd_t = simd::simd<T, Abi>;
+  using mask_t = typename simd_t::mask_type;
+  constexpr int n = simd_t::size();
+  T a[n];
+  T b[n];
+  for (int i = 0; i < n; ++i) {
+    a[i] = T(i % 3);
+    b[i] = T(1);
+  }
+  if (std::numeric_limits<T>::has_quiet_NaN) a[n - 1] = std::numeric_limits<T>::quiet_NaN();
+  simd_t const x(a, simd::element_aligned_tag());
+  simd_t const y(b, simd::element_aligned_tag());
+  std::uint64_t lt = 0, gt = 0, le = 0, ge = 0, eq = 0, ne = 0;
+  for (int i = 0; i < n; ++i) {
+    std::uint64_t const bit = std::uint64_t(1) << i;
+    if (a[i] < b[i]) lt |= bit;
+    if (a[i] > b[i]) gt |= bit;
+    if (a[i] <= b[i]) le |= bit;
+    if (a[i] >= b[i]) ge |= bit;
+    if (a[i] == b[i]) eq |= bit;
+    if (a[i] != b[i]) ne |= bit;
+  }
+  ASSERT_EQ(simd::to_bitmask(x < y), lt);
+  ASSERT_EQ(simd::to_bitmask(x > y), gt);
+  ASSERT_EQ(simd::to_bitmask(x <= y), le);
+  ASSERT_EQ(simd::to_bitmask(x >= y), ge);
+  ASSERT_EQ(simd::to_bitmask(x == y), eq);
+  ASSERT_EQ(simd::to_bitmask(x != y), ne);
+  ASSERT_EQ(simd::to_bitmask(simd::from_bitmask<mask_t>(ge)), ge);
+  ASSERT_EQ(simd::to_bitmask(simd::from_bitmask<mask_t>(~std::uint64_t(0))), n == 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << n) - 1);
+  auto const mask = x >= y;
+  int count = 0, first = -1, last = -1;
+  for (int i = 0; i < n; ++i) {
+    if ((ge >> i) & 1) {
+      ++count;
+      if (first < 0) first = i;
+      last = i;
+    }
+  }
+  ASSERT_EQ(simd::popcount(mask), count);
+  ASSERT_EQ(simd::find_first_set(mask), first);
+  ASSERT_EQ(simd::find_last_set(mask), last);
+  ASSERT_EQ(simd::none_of(mask), count == 0);
+  ASSERT_EQ(simd::none_of(mask_t(false)), true);
+  ASSERT_EQ(simd::find_first_set(mask_t(false)), -1);
+  ASSERT_EQ(simd::find_last_set(mask_t(false)), -1);
+  ASSERT_EQ(simd::popcount(mask_t(true)), n);
+}
+
+// lane permutations against the lane indices they are defined by
+template <class T, class Abi>
+void test_permutations() {
+  using simd_t = simd::simd<T, Abi>;
+  constexpr int n = simd_t::size();
+  T a[n];
+  T b[n];
+  for (int i = 0; i < n; ++i) {
+    a[i] = T(i + 1);
+    b[i] = T(-i - 1);
+  }
+  simd_t const x(a, simd::element_aligned_tag());
+  simd_t const y(b, simd::element_aligned_tag());
+  T ab[2 * n];
+  for (int i = 0; i < n; ++i) {
+    ab[2 * i] = a[i];
+    ab[2 * i + 1] = b[i];
+  }
+  simd::simd_storage<T, Abi> actual;
+  actual = simd::rotate<1>(x);
+  for (int i = 0; i < n; ++i) ASSERT_EQ(actual[i], a[(i + 1) % n]);
+  actual = simd::rotate<-1>(x);
+  for (int i = 0; i < n; ++i) ASSERT_EQ(actual[i], a[(i + n - 1) % n]);
+  actual = simd::broadcast_lane<n - 1>(x);
+  for (int i = 0; i < n; ++i) ASSERT_EQ(actual[i], a[n - 1]);
+  actual = simd::reverse(x);
+  for (int i = 0; i < n; ++i) ASSERT_EQ(actual[i], a[n - 1 - i]);
+  actual = simd::interleave_lo(x, y);
+  for (int i = 0; i < n; ++i) ASSERT_EQ(actual[i], ab[i]);
+  actual = simd::interleave_hi(x, y);
+  for (int i = 0; i < n; ++i) ASSERT_EQ(actual[i], ab[n + i]);
+  for (int k = 0; k <= n; ++k) {
+    actual = simd::shift_in(x, y, k);
+    for (int i = 0; i < n; ++i) ASSERT_EQ(actual[i], i + k < n ? a[i + k] : b[i + k - n]);
+  }
+}
+
+// scans on small integers, exact in every order, in one register and over arrays with a tail
+template <class T, class Abi>
+void test_scans() {
+  using simd_t = simd::simd<T, Abi>;
+  constexpr int n = simd_t::size();
+  constexpr int m = 3 * n + n / 2 + 1;
+  T a[m];
+  T inclusive[m];
+  T exclusive[m];
+  T sum = T(5);
+  for (int i = 0; i < m; ++i) {
+    a[i] = T((i * 7) % 5 - 2);
+    exclusive[i] = sum;
+    sum += a[i];
+    inclusive[i] = sum;
+  }
+  simd::simd_storage<T, Abi> actual;
+  actual = simd::inclusive_scan(simd_t(a, simd::element_aligned_tag()));
+  for (int i = 0; i < n; ++i) ASSERT_EQ(actual[i], inclusive[i] - T(5));
+  actual = simd::exclusive_scan(simd_t(a, simd::element_aligned_tag()));
+  for (int i = 0; i < n; ++i) ASSERT_EQ(actual[i], exclusive[i] - T(5));
+  T out[m];
+  ASSERT_EQ(simd::inclusive_scan<simd_t>(a, out, m, T(5)), sum);
+  for (int i = 0; i < m; ++i) ASSERT_EQ(out[i], inclusive[i]);
+  ASSERT_EQ(simd::exclusive_scan<simd_t>(a, out, m, T(5)), sum);
+  for (int i = 0; i < m; ++i) ASSERT_EQ(out[i], exclusive[i]);
+  for (int i = 0; i < m; ++i) out[i] = a[i];
+  simd::inclusive_scan<simd_t>(out, out, m, T(5));
+  for (int i = 0; i < m; ++i) ASSERT_EQ(out[i], inclusive[i]);
+  ASSERT_EQ(simd::exclusive_scan<simd_t>(a, out, 0, T(5)), T(5));
+}
+
+// compress_store and expand_load against the lanes of the mask, checking nothing is written past the count
+template <class T, class Abi>
+void test_compress_expand() {
+  using simd_t = simd::simd<T, Abi>;
+  constexpr int n = simd_t::size();
+  T a[n];
+  T out[n + 1];
+  for (int i = 0; i < n; ++i) a[i] = T(i + 1);
+  simd_t const x(a, simd::element_aligned_tag());
+  for (std::uint64_t bits : {std::uint64_t(0), std::uint64_t(0x5555555555555555), std::uint64_t(0xB6DB6DB6DB6DB6DB), ~std::uint64_t(0)}) {
+    auto const mask = simd::from_bitmask<typename simd_t::mask_type>(bits);
+    for (int i = 0; i <= n; ++i) out[i] = T(-1);
+    int const count = simd::compress_store(out, mask, x);
+    ASSERT_EQ(count, simd::popcount(mask));
+    int k = 0;
+    for (int i = 0; i < n; ++i) {
+      if ((bits >> i) & 1) ASSERT_EQ(out[k++], a[i]);
+    }
+    for (int i = count; i <= n; ++i) ASSERT_EQ(out[i], T(-1));
+    simd::simd_storage<T, Abi> expanded;
+    expanded = simd::expand_load(out, mask);
+    for (int i = 0; i < n; ++i) ASSERT_EQ(expanded[i], ((bits >> i) & 1) ? a[i] : T(0));
+  }
+}
+
 int main() {
   double const a[] = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0};
   double const b[] = {1.1, 2.2, 3.3, 4.4, 5.5, 6.6, 7.7, 8.8};
@@ -106,4 +1394,109 @@ int main() {
   test_binary_op<simd::simd_abi::native>(a, b, minus());
   test_binary_op<simd::simd_abi::native>(a, b, multiplies());
   test_binary_op<simd::simd_abi::native>(a, b, divides());
+  test_math_functions<double, simd::simd_abi::native>();
+  test_math_functions<float, simd::simd_abi::native>();
+  test_integer_ops<std::int32_t, simd::simd_abi::native>();
+  test_integer_ops<std::int64_t, simd::simd_abi::native>();
+  test_conversions<simd::simd_abi::native>();
+  test_fixed_size<double>();
+  test_fixed_size<float>();
+  test_aligned_copies<double, simd::simd_abi::native>();
+  test_aligned_copies<float, simd::simd_abi::native>();
+  test_aligned_copies<std::int32_t, simd::simd_abi::native>();
+  test_aligned_copies<std::int64_t, simd::simd_abi::native>();
+  test_aligned_copies<double, simd::simd_abi::fixed_size<16>>();
+  test_masked_copies<double, simd::simd_abi::native>();
+  test_masked_copies<float, simd::simd_abi::native>();
+  test_masked_copies<std::int32_t, simd::simd_abi::native>();
+  test_masked_copies<std::int64_t, simd::simd_abi::native>();
+  test_masked_copies<double, simd::simd_abi::pack<8>>();
+  test_masked_copies<float, simd::simd_abi::fixed_size<16>>();
+  test_gather_scatter<double, std::int64_t, simd::simd_abi::native>();
+  test_gather_scatter<float, std::int32_t, simd::simd_abi::native>();
+  test_gather_scatter<std::int32_t, std::int32_t, simd::simd_abi::native>();
+  test_gather_scatter<std::int64_t, std::int64_t, simd::simd_abi::native>();
+  test_gather_scatter<double, std::int64_t, simd::simd_abi::fixed_size<16>>();
+  test_where<double, simd::simd_abi::native>();
+  test_where<float, simd::simd_abi::native>();
+  test_where<std::int32_t, simd::simd_abi::native>();
+  test_where<std::int64_t, simd::simd_abi::native>();
+  test_where<float, simd::simd_abi::fixed_size<16>>();
+  test_reductions<double, simd::simd_abi::native>();
+  test_reductions<float, simd::simd_abi::native>();
+  test_reductions<std::int32_t, simd::simd_abi::native>();
+  test_reductions<std::int64_t, simd::simd_abi::native>();
+  test_reductions<double, simd::simd_abi::pack<3>>();
+  test_reductions<float, simd::simd_abi::fixed_size<16>>();
+  test_comparisons<double, simd::simd_abi::native>();
+  test_comparisons<float, simd::simd_abi::native>();
+  test_comparisons<std::int32_t, simd::simd_abi::native>();
+  test_comparisons<std::int64_t, simd::simd_abi::native>();
+  test_comparisons<double, simd::simd_abi::pack<3>>();
+  test_comparisons<float, simd::simd_abi::fixed_size<16>>();
+  test_permutations<double, simd::simd_abi::native>();
+  test_permutations<float, simd::simd_abi::native>();
+  test_permutations<std::int32_t, simd::simd_abi::native>();
+  test_permutations<std::int64_t, simd::simd_abi::native>();
+  test_permutations<double, simd::simd_abi::pack<3>>();
+  test_permutations<float, simd::simd_abi::fixed_size<16>>();
+  test_scans<double, simd::simd_abi::native>();
+  test_scans<float, simd::simd_abi::native>();
+  test_scans<std::int32_t, simd::simd_abi::native>();
+  test_scans<std::int64_t, simd::simd_abi::native>();
+  test_scans<double, simd::simd_abi::pack<3>>();
+  test_scans<float, simd::simd_abi::fixed_size<16>>();
+  test_compress_expand<double, simd::simd_abi::native>();
+  test_compress_expand<float, simd::simd_abi::native>();
+  test_compress_expand<std::int32_t, simd::simd_abi::native>();
+  test_compress_expand<std::int64_t, simd::simd_abi::native>();
+  test_compress_expand<double, simd::simd_abi::pack<3>>();
+  test_compress_expand<float, simd::simd_abi::fixed_size<16>>();
+#if defined(__AVX512F__) && defined(__AVX512VL__) && !defined(SIMD_FORCE_SCALAR)
+  test_binary_op<simd::simd_abi::avx512_256>(a, b, plus());
+  test_binary_op<simd::simd_abi::avx512_256>(a, b, minus());
+  test_binary_op<simd::simd_abi::avx512_256>(a, b, multiplies());
+  test_binary_op<simd::simd_abi::avx512_256>(a, b, divides());
+  test_math_functions<double, simd::simd_abi::avx512_256>();
+  test_math_functions<float, simd::simd_abi::avx512_256>();
+  test_integer_ops<std::int32_t, simd::simd_abi::avx512_256>();
+  test_integer_ops<std::int64_t, simd::simd_abi::avx512_256>();
+  test_conversions<simd::simd_abi::avx512_256>();
+  test_aligned_copies<double, simd::simd_abi::avx512_256>();
+  test_aligned_copies<float, simd::simd_abi::avx512_256>();
+  test_aligned_copies<std::int32_t, simd::simd_abi::avx512_256>();
+  test_aligned_copies<std::int64_t, simd::simd_abi::avx512_256>();
+  test_masked_copies<double, simd::simd_abi::avx512_256>();
+  test_masked_copies<float, simd::simd_abi::avx512_256>();
+  test_masked_copies<std::int32_t, simd::simd_abi::avx512_256>();
+  test_masked_copies<std::int64_t, simd::simd_abi::avx512_256>();
+  test_gather_scatter<double, std::int64_t, simd::simd_abi::avx512_256>();
+  test_gather_scatter<float, std::int32_t, simd::simd_abi::avx512_256>();
+  test_gather_scatter<std::int32_t, std::int32_t, simd::simd_abi::avx512_256>();
+  test_gather_scatter<std::int64_t, std::int64_t, simd::simd_abi::avx512_256>();
+  test_where<double, simd::simd_abi::avx512_256>();
+  test_where<float, simd::simd_abi::avx512_256>();
+  test_where<std::int32_t, simd::simd_abi::avx512_256>();
+  test_where<std::int64_t, simd::simd_abi::avx512_256>();
+  test_reductions<double, simd::simd_abi::avx512_256>();
+  test_reductions<float, simd::simd_abi::avx512_256>();
+  test_reductions<std::int32_t, simd::simd_abi::avx512_256>();
+  test_reductions<std::int64_t, simd::simd_abi::avx512_256>();
+  test_comparisons<double, simd::simd_abi::avx512_256>();
+  test_comparisons<float, simd::simd_abi::avx512_256>();
+  test_comparisons<std::int32_t, simd::simd_abi::avx512_256>();
+  test_comparisons<std::int64_t, simd::simd_abi::avx512_256>();
+  test_permutations<double, simd::simd_abi::avx512_256>();
+  test_permutations<float, simd::simd_abi::avx512_256>();
+  test_permutations<std::int32_t, simd::simd_abi::avx512_256>();
+  test_permutations<std::int64_t, simd::simd_abi::avx512_256>();
+  test_scans<double, simd::simd_abi::avx512_256>();
+  test_scans<float, simd::simd_abi::avx512_256>();
+  test_scans<std::int32_t, simd::simd_abi::avx512_256>();
+  test_scans<std::int64_t, simd::simd_abi::avx512_256>();
+  test_compress_expand<double, simd::simd_abi::avx512_256>();
+  test_compress_expand<float, simd::simd_abi::avx512_256>();
+  test_compress_expand<std::int32_t, simd::simd_abi::avx512_256>();
+  test_compress_expand<std::int64_t, simd::simd_abi::avx512_256>();
+#endif
 }
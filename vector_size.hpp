@@ -120,6 +120,35 @@ class simd_mask<double, simd_abi::vector_size<N>> {
   }
 };
 
+template <int N>
+class simd_mask<std::int64_t, simd_abi::vector_size<N>> {
+  typedef long long native_type __attribute__((vector_size(N)));
+  native_type m_value;
+ public:
+  using value_type = bool;
+  using simd_type = simd<std::int64_t, simd_abi::vector_size<N>>;
+  using abi_type = simd_abi::vector_size<N>;
+  SIMD_ALWAYS_INLINE inline simd_mask() = default;
+  SIMD_ALWAYS_INLINE inline static constexpr int size() { return N / sizeof(long long); }
+  SIMD_ALWAYS_INLINE inline simd_mask(bool value)
+    :m_value(static_cast<long long>(value))
+  {}
+  SIMD_ALWAYS_INLINE inline simd_mask(native_type value)
+    :m_value(value)
+  {}
+  SIMD_ALWAYS_INLINE inline long long operator[](int i) { return reinterpret_cast<long long*>(&m_value)[i]; }
+  SIMD_ALWAYS_INLINE inline native_type const& get() const { return m_value; }
+  SIMD_ALWAYS_INLINE inline simd_mask operator||(simd_mask const& other) const {
+    return simd_mask(m_value || other.m_value);
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask operator&&(simd_mask const& other) const {
+    return simd_mask(m_value && other.m_value);
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask operator!() const {
+    return simd_mask(!m_value);
+  }
+};
+
 template <class T, int N>
 SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline bool all_of(simd_mask<T, simd_abi::vector_size<N>> const& a) {
   bool result = true;
@@ -146,7 +175,7 @@ class simd<T, simd_abi::vector_size<N>> {
   SIMD_ALWAYS_INLINE inline simd() = default;
   SIMD_ALWAYS_INLINE inline static constexpr int size() { return N / sizeof(T); }
   SIMD_ALWAYS_INLINE inline simd(T value) { for(int i=0; i<size(); i++) reinterpret_cast<T*>(&m_value)[i] = value; }
-  explicit SIMD_ALWAYS_INLINE inline simd(const native_type& value):m_value(value) {}
+  SIMD_ALWAYS_INLINE inline explicit simd(const native_type& value):m_value(value) {}
   SIMD_ALWAYS_INLINE inline
   simd(storage_type const& value) {
     copy_from(value.data(), element_aligned_tag());
@@ -178,11 +207,37 @@ class simd<T, simd_abi::vector_size<N>> {
   SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd operator-() const {
     return simd(-m_value);
   }
+  SIMD_ALWAYS_INLINE simd operator&(simd const& other) const {
+    return simd(m_value & other.m_value);
+  }
+  SIMD_ALWAYS_INLINE simd operator|(simd const& other) const {
+    return simd(m_value | other.m_value);
+  }
+  SIMD_ALWAYS_INLINE simd operator^(simd const& other) const {
+    return simd(m_value ^ other.m_value);
+  }
+  SIMD_ALWAYS_INLINE simd operator~() const {
+    return simd(~m_value);
+  }
+  SIMD_ALWAYS_INLINE simd operator<<(int shift) const {
+    return simd(m_value << shift);
+  }
+  SIMD_ALWAYS_INLINE simd operator>>(int shift) const {
+    return simd(m_value >> shift);
+  }
   SIMD_ALWAYS_INLINE void copy_from(T const* ptr, element_aligned_tag) {
     SIMD_PRAGMA for (int i = 0; i < size(); ++i) reinterpret_cast<T*>(&m_value)[i] = ptr[i];
   }
   SIMD_ALWAYS_INLINE void copy_to(T* ptr, element_aligned_tag) const {
-    SIMD_PRAGMA for (int i = 0; i < size(); ++i) ptr[i] = reinterpret_cast<T*>(&m_value)[i];
+    SIMD_PRAGMA for (int i = 0; i < size(); ++i) ptr[i] = reinterpret_cast<T const*>(&m_value)[i];
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE void copy_from(T const* ptr, mask_type const& mask, Flags /*flags*/) {
+    impl::masked_copy_from(this, ptr, mask);
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE void copy_to(T* ptr, mask_type const& mask, Flags /*flags*/) const {
+    impl::masked_copy_to(*this, ptr, mask);
   }
   SIMD_ALWAYS_INLINE constexpr T operator[](int i) const { return m_value[i]; }
   SIMD_ALWAYS_INLINE native_type const& get() const { return m_value; }
@@ -193,12 +248,24 @@ class simd<T, simd_abi::vector_size<N>> {
   SIMD_ALWAYS_INLINE simd_mask<T, simd_abi::vector_size<N>> operator==(simd const& other) const {
     return simd_mask<T, simd_abi::vector_size<N>>(m_value == other.m_value);
   }
+  SIMD_ALWAYS_INLINE simd_mask<T, simd_abi::vector_size<N>> operator>(simd const& other) const {
+    return simd_mask<T, simd_abi::vector_size<N>>(m_value > other.m_value);
+  }
+  SIMD_ALWAYS_INLINE simd_mask<T, simd_abi::vector_size<N>> operator<=(simd const& other) const {
+    return simd_mask<T, simd_abi::vector_size<N>>(m_value <= other.m_value);
+  }
+  SIMD_ALWAYS_INLINE simd_mask<T, simd_abi::vector_size<N>> operator>=(simd const& other) const {
+    return simd_mask<T, simd_abi::vector_size<N>>(m_value >= other.m_value);
+  }
+  SIMD_ALWAYS_INLINE simd_mask<T, simd_abi::vector_size<N>> operator!=(simd const& other) const {
+    return simd_mask<T, simd_abi::vector_size<N>>(m_value != other.m_value);
+  }
 };
 
 template <class T, int N>
 SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::vector_size<N>> abs(simd<T, simd_abi::vector_size<N>> const& a) {
   simd<T, simd_abi::vector_size<N>> result;
-  using std::sqrt;
+  using std::abs;
   SIMD_PRAGMA for (int i = 0; i < a.size(); ++i) result.get()[i] = abs(a[i]);
   return result;
 }
@@ -211,30 +278,20 @@ SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::vector_size<N>> sqr
   return result;
 }
 
-template <class T, int N>
-SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::vector_size<N>> cbrt(simd<T, simd_abi::vector_size<N>> const& a) {
-  simd<T, simd_abi::vector_size<N>> result;
-  using std::cbrt;
-  SIMD_PRAGMA for (int i = 0; i < a.size(); ++i) result.get()[i] = cbrt(a[i]);
-  return result;
-}
-
-template <class T, int N>
-SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::vector_size<N>> exp(simd<T, simd_abi::vector_size<N>> const& a) {
-  simd<T, simd_abi::vector_size<N>> result;
-  using std::exp;
-  SIMD_PRAGMA for (int i = 0; i < a.size(); ++i) result.get()[i] = exp(a[i]);
-  return result;
-}
-
 template <class T, int N>
 SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::vector_size<N>> fma(
     simd<T, simd_abi::vector_size<N>> const& a,
     simd<T, simd_abi::vector_size<N>> const& b,
     simd<T, simd_abi::vector_size<N>> const& c) {
+#ifdef __FP_FAST_FMA
+  // a lane loop the compiler turns into vector fma instructions; a * b + c might not be fused
   simd<T, simd_abi::vector_size<N>> result;
-  SIMD_PRAGMA for (int i = 0; i < a.size(); ++i) result.get()[i] = (a[i] * b[i]) + c[i];
+  using std::fma;
+  SIMD_PRAGMA for (int i = 0; i < a.size(); ++i) result.get()[i] = fma(a[i], b[i], c[i]);
   return result;
+#else
+  return simd<T, simd_abi::vector_size<N>>((a.get() * b.get()) + c.get());
+#endif
 }
 
 template <class T, int N>
@@ -261,6 +318,137 @@ SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::vector_size<N>> min
   return choose(a < b, a, b);
 }
 
+template <int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<float, simd_abi::vector_size<N>> roundeven(simd<float, simd_abi::vector_size<N>> const& a) {
+  typedef float native_type __attribute__((vector_size(N)));
+  typedef int bits_type __attribute__((vector_size(N)));
+  using simd_t = simd<float, simd_abi::vector_size<N>>;
+  // adding and subtracting 2^23 drops the fraction bits; larger values are already integral
+  bits_type const sign_mask = (bits_type)simd_t(-0.f).get();
+  bits_type const sign = (bits_type)a.get() & sign_mask;
+  native_type const two23 = simd_t(8388608.f).get();
+  native_type const magic = (native_type)(sign | (bits_type)two23);
+  bits_type const rounded = (bits_type)((a.get() + magic) - magic) | sign;
+  bits_type const is_small = (native_type)((bits_type)a.get() & ~sign_mask) < two23;
+  return simd_t((native_type)((is_small & rounded) | (~is_small & (bits_type)a.get())));
+}
+
+template <int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<float, simd_abi::vector_size<N>> pow2i(simd<float, simd_abi::vector_size<N>> const& n) {
+  typedef float native_type __attribute__((vector_size(N)));
+  typedef int bits_type __attribute__((vector_size(N)));
+  // the low bits of 2^23 + 127 + n hold the biased exponent of 2^n
+  native_type const biased = n.get() + 8388735.f;
+  return simd<float, simd_abi::vector_size<N>>((native_type)((bits_type)biased << 23));
+}
+
+template <int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<float, simd_abi::vector_size<N>> getexp(simd<float, simd_abi::vector_size<N>> const& a) {
+  typedef float native_type __attribute__((vector_size(N)));
+  typedef int bits_type __attribute__((vector_size(N)));
+  bits_type const biased = ((bits_type)a.get() >> 23) & 0xFF;
+  return simd<float, simd_abi::vector_size<N>>((native_type)(biased | 0x4B000000) - 8388735.f);
+}
+
+template <int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<float, simd_abi::vector_size<N>> getmant(simd<float, simd_abi::vector_size<N>> const& a) {
+  typedef float native_type __attribute__((vector_size(N)));
+  typedef int bits_type __attribute__((vector_size(N)));
+  return simd<float, simd_abi::vector_size<N>>((native_type)(((bits_type)a.get() & 0x007FFFFF) | 0x3F800000));
+}
+
+template <int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<double, simd_abi::vector_size<N>> roundeven(simd<double, simd_abi::vector_size<N>> const& a) {
+  typedef double native_type __attribute__((vector_size(N)));
+  typedef long long bits_type __attribute__((vector_size(N)));
+  using simd_t = simd<double, simd_abi::vector_size<N>>;
+  // adding and subtracting 2^52 drops the fraction bits; larger values are already integral
+  bits_type const sign_mask = (bits_type)simd_t(-0.).get();
+  bits_type const sign = (bits_type)a.get() & sign_mask;
+  native_type const two52 = simd_t(4503599627370496.).get();
+  native_type const magic = (native_type)(sign | (bits_type)two52);
+  bits_type const rounded = (bits_type)((a.get() + magic) - magic) | sign;
+  bits_type const is_small = (native_type)((bits_type)a.get() & ~sign_mask) < two52;
+  return simd_t((native_type)((is_small & rounded) | (~is_small & (bits_type)a.get())));
+}
+
+template <int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<double, simd_abi::vector_size<N>> pow2i(simd<double, simd_abi::vector_size<N>> const& n) {
+  typedef double native_type __attribute__((vector_size(N)));
+  typedef long long bits_type __attribute__((vector_size(N)));
+  // the low bits of 2^52 + 1023 + n hold the biased exponent of 2^n
+  native_type const biased = n.get() + 4503599627371519.;
+  return simd<double, simd_abi::vector_size<N>>((native_type)((bits_type)biased << 52));
+}
+
+template <int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<double, simd_abi::vector_size<N>> getexp(simd<double, simd_abi::vector_size<N>> const& a) {
+  typedef double native_type __attribute__((vector_size(N)));
+  typedef long long bits_type __attribute__((vector_size(N)));
+  bits_type const biased = ((bits_type)a.get() >> 52) & 0x7FF;
+  return simd<double, simd_abi::vector_size<N>>((native_type)(biased | 0x4330000000000000) - 4503599627371519.);
+}
+
+template <int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<double, simd_abi::vector_size<N>> getmant(simd<double, simd_abi::vector_size<N>> const& a) {
+  typedef double native_type __attribute__((vector_size(N)));
+  typedef long long bits_type __attribute__((vector_size(N)));
+  return simd<double, simd_abi::vector_size<N>>((native_type)(((bits_type)a.get() & 0x000FFFFFFFFFFFFF) | 0x3FF0000000000000));
+}
+
+template <int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<float, simd_abi::vector_size<N>> copysign(
+    simd<float, simd_abi::vector_size<N>> const& a, simd<float, simd_abi::vector_size<N>> const& b) {
+  typedef float native_type __attribute__((vector_size(N)));
+  typedef int bits_type __attribute__((vector_size(N)));
+  bits_type const sign_mask = (bits_type)simd<float, simd_abi::vector_size<N>>(-0.f).get();
+  return simd<float, simd_abi::vector_size<N>>((native_type)(((bits_type)a.get() & ~sign_mask) | ((bits_type)b.get() & sign_mask)));
+}
+
+template <int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<double, simd_abi::vector_size<N>> copysign(
+    simd<double, simd_abi::vector_size<N>> const& a, simd<double, simd_abi::vector_size<N>> const& b) {
+  typedef double native_type __attribute__((vector_size(N)));
+  typedef long long bits_type __attribute__((vector_size(N)));
+  bits_type const sign_mask = (bits_type)simd<double, simd_abi::vector_size<N>>(-0.).get();
+  return simd<double, simd_abi::vector_size<N>>((native_type)(((bits_type)a.get() & ~sign_mask) | ((bits_type)b.get() & sign_mask)));
+}
+
+
+#if defined(__clang__) || (defined(__GNUC__) && (__GNUC__ >= 12))
+
+template <class T, int N, int... Idx>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::vector_size<N>> permute(
+    simd<T, simd_abi::vector_size<N>> const& a, std::integer_sequence<int, Idx...>) {
+  return simd<T, simd_abi::vector_size<N>>(__builtin_shufflevector(a.get(), a.get(), Idx...));
+}
+
+namespace impl {
+
+// lane i of the result is lane H * size() + i of the interleaving of a and b
+template <int H, class T, int N, int... I>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::vector_size<N>> interleave(
+    simd<T, simd_abi::vector_size<N>> const& a, simd<T, simd_abi::vector_size<N>> const& b, std::integer_sequence<int, I...>) {
+  constexpr int n = int(sizeof...(I));
+  return simd<T, simd_abi::vector_size<N>>(__builtin_shufflevector(a.get(), b.get(), (((H * n + I) % 2) * n + (H * n + I) / 2)...));
+}
+
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::vector_size<N>> interleave_lo(
+    simd<T, simd_abi::vector_size<N>> const& a, simd<T, simd_abi::vector_size<N>> const& b) {
+  return impl::interleave<0>(a, b, std::make_integer_sequence<int, simd<T, simd_abi::vector_size<N>>::size()>());
+}
+
+template <class T, int N>
+SIMD_ALWAYS_INLINE SIMD_HOST_DEVICE inline simd<T, simd_abi::vector_size<N>> interleave_hi(
+    simd<T, simd_abi::vector_size<N>> const& a, simd<T, simd_abi::vector_size<N>> const& b) {
+  return impl::interleave<1>(a, b, std::make_integer_sequence<int, simd<T, simd_abi::vector_size<N>>::size()>());
+}
+
+#endif
+
 }
 
 #endif
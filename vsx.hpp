@@ -158,6 +158,14 @@ class simd<float, simd_abi::vsx> {
   SIMD_ALWAYS_INLINE void copy_to(float* ptr, element_aligned_tag) const {
     vec_vsx_st(m_value, 0, ptr);
   }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE void copy_from(float const* ptr, mask_type const& mask, Flags /*flags*/) {
+    impl::masked_copy_from(this, ptr, mask);
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE void copy_to(float* ptr, mask_type const& mask, Flags /*flags*/) const {
+    impl::masked_copy_to(*this, ptr, mask);
+  }
   SIMD_ALWAYS_INLINE constexpr __vector float get() const { return m_value; }
   SIMD_ALWAYS_INLINE simd_mask<float, simd_abi::vsx> operator<(simd const& other) const {
     return simd_mask<float, simd_abi::vsx>(vec_cmplt(m_value, other.m_value));
@@ -165,6 +173,18 @@ class simd<float, simd_abi::vsx> {
   SIMD_ALWAYS_INLINE simd_mask<float, simd_abi::vsx> operator==(simd const& other) const {
     return simd_mask<float, simd_abi::vsx>(vec_cmpeq(m_value, other.m_value));
   }
+  SIMD_ALWAYS_INLINE simd_mask<float, simd_abi::vsx> operator>(simd const& other) const {
+    return simd_mask<float, simd_abi::vsx>(vec_cmpgt(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE simd_mask<float, simd_abi::vsx> operator<=(simd const& other) const {
+    return simd_mask<float, simd_abi::vsx>(vec_cmple(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE simd_mask<float, simd_abi::vsx> operator>=(simd const& other) const {
+    return simd_mask<float, simd_abi::vsx>(vec_cmpge(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE simd_mask<float, simd_abi::vsx> operator!=(simd const& other) const {
+    return !(*this == other);
+  }
 };
 
 SIMD_ALWAYS_INLINE inline simd<float, simd_abi::vsx> abs(simd<float, simd_abi::vsx> const& a) {
@@ -175,6 +195,18 @@ SIMD_ALWAYS_INLINE inline simd<float, simd_abi::vsx> sqrt(simd<float, simd_abi::
   return simd<float, simd_abi::vsx>(vec_sqrt(a.get()));
 }
 
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::vsx> floor(simd<float, simd_abi::vsx> const& a) {
+  return simd<float, simd_abi::vsx>(vec_floor(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::vsx> ceil(simd<float, simd_abi::vsx> const& a) {
+  return simd<float, simd_abi::vsx>(vec_ceil(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<float, simd_abi::vsx> trunc(simd<float, simd_abi::vsx> const& a) {
+  return simd<float, simd_abi::vsx>(vec_trunc(a.get()));
+}
+
 SIMD_ALWAYS_INLINE inline simd<float, simd_abi::vsx> fma(
     simd<float, simd_abi::vsx> const& a,
     simd<float, simd_abi::vsx> const& b,
@@ -308,6 +340,14 @@ class simd<double, simd_abi::vsx> {
   SIMD_ALWAYS_INLINE inline void copy_to(double* ptr, element_aligned_tag) const {
     vec_vsx_st(m_value, 0, ptr);
   }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline void copy_from(double const* ptr, mask_type const& mask, Flags /*flags*/) {
+    impl::masked_copy_from(this, ptr, mask);
+  }
+  template <class Flags>
+  SIMD_ALWAYS_INLINE inline void copy_to(double* ptr, mask_type const& mask, Flags /*flags*/) const {
+    impl::masked_copy_to(*this, ptr, mask);
+  }
   SIMD_ALWAYS_INLINE inline constexpr __vector double get() const { return m_value; }
   SIMD_ALWAYS_INLINE inline simd_mask<double, simd_abi::vsx> operator<(simd const& other) const {
     return simd_mask<double, simd_abi::vsx>(vec_cmplt(m_value, other.m_value));
@@ -315,6 +355,18 @@ class simd<double, simd_abi::vsx> {
   SIMD_ALWAYS_INLINE inline simd_mask<double, simd_abi::vsx> operator==(simd const& other) const {
     return simd_mask<double, simd_abi::vsx>(vec_cmpeq(m_value, other.m_value));
   }
+  SIMD_ALWAYS_INLINE inline simd_mask<double, simd_abi::vsx> operator>(simd const& other) const {
+    return simd_mask<double, simd_abi::vsx>(vec_cmpgt(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<double, simd_abi::vsx> operator<=(simd const& other) const {
+    return simd_mask<double, simd_abi::vsx>(vec_cmple(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<double, simd_abi::vsx> operator>=(simd const& other) const {
+    return simd_mask<double, simd_abi::vsx>(vec_cmpge(m_value, other.m_value));
+  }
+  SIMD_ALWAYS_INLINE inline simd_mask<double, simd_abi::vsx> operator!=(simd const& other) const {
+    return !(*this == other);
+  }
 };
 
 SIMD_ALWAYS_INLINE inline simd<double, simd_abi::vsx> abs(simd<double, simd_abi::vsx> const& a) {
@@ -325,6 +377,18 @@ SIMD_ALWAYS_INLINE inline simd<double, simd_abi::vsx> sqrt(simd<double, simd_abi
   return simd<double, simd_abi::vsx>(vec_sqrt(a.get()));
 }
 
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::vsx> floor(simd<double, simd_abi::vsx> const& a) {
+  return simd<double, simd_abi::vsx>(vec_floor(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::vsx> ceil(simd<double, simd_abi::vsx> const& a) {
+  return simd<double, simd_abi::vsx>(vec_ceil(a.get()));
+}
+
+SIMD_ALWAYS_INLINE inline simd<double, simd_abi::vsx> trunc(simd<double, simd_abi::vsx> const& a) {
+  return simd<double, simd_abi::vsx>(vec_trunc(a.get()));
+}
+
 SIMD_ALWAYS_INLINE inline simd<double, simd_abi::vsx> fma(
     simd<double, simd_abi::vsx> const& a,
     simd<double, simd_abi::vsx> const& b,